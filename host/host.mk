@@ -0,0 +1,78 @@
+#---------------------------------------------------------------------------------
+# Host (x86-64 Linux) build of the game logic, included by the top level Makefile
+# for the `host`, `host-sim` and `host-clean` goals.
+#
+# The game sources are compiled with the native compiler against the tonc.h and
+# maxmod.h shims in host/include. Graphics and the soundbank header are still
+# generated with grit and mmutil (from devkitPro's tools), grit outputs C here.
+#---------------------------------------------------------------------------------
+HOST_CC        ?= gcc
+HOST_STD       ?= gnu23
+GRIT           ?= grit
+MMUTIL         ?= mmutil
+
+HOST_BUILD     := build_host
+HOST_TARGET    := $(HOST_BUILD)/gbalatro_host
+SIM_TARGET     := $(HOST_BUILD)/gbalatro_sim
+
+# main.c is replaced by host/source/host_main.c, or host/sim/sim_main.c for the simulator, and
+# list.c isn't part of the game, see CFILES in the Makefile
+GAME_SOURCES   := $(filter-out source/main.c source/list.c,$(wildcard source/*.c)) \
+                  $(filter-out host/source/host_main.c,$(wildcard host/source/*.c))
+HOST_SOURCES   := $(GAME_SOURCES) host/source/host_main.c
+SIM_SOURCES    := $(GAME_SOURCES) $(wildcard host/sim/*.c)
+HOST_PNGFILES  := $(wildcard graphics/*.png)
+HOST_GFX_C     := $(patsubst graphics/%.png,$(HOST_BUILD)/gfx/%.c,$(HOST_PNGFILES))
+HOST_GFX_H     := $(HOST_GFX_C:.c=.h)
+HOST_AUDIO     := $(wildcard audio/*.*)
+
+HOST_GFX_OBJS  := $(patsubst %.c,%.o,$(HOST_GFX_C))
+HOST_OBJS      := $(patsubst %.c,$(HOST_BUILD)/obj/%.o,$(HOST_SOURCES)) $(HOST_GFX_OBJS)
+SIM_OBJS       := $(patsubst %.c,$(HOST_BUILD)/obj/%.o,$(SIM_SOURCES)) $(HOST_GFX_OBJS)
+
+# Warnings about printf formats are off because u32 is `unsigned long` on the GBA
+# The pools check for stale handles, see POOL_HANDLES
+HOST_CFLAGS    := -g -O2 -Wall -Werror -Wno-format -std=$(HOST_STD) -DPOOL_DEBUG \
+                  -iquote include -iquote host/sim -Ihost/include -I$(HOST_BUILD)/gfx \
+                  -I$(HOST_BUILD) \
+                  $(GIT_C_FLAGS) -MMD -MP
+HOST_LDFLAGS   := -lm
+
+.PHONY: host host-sim host-clean
+
+host: $(HOST_TARGET)
+
+host-sim: $(SIM_TARGET)
+
+$(HOST_TARGET): $(HOST_OBJS)
+	@echo linking $@
+	@$(HOST_CC) -o $@ $^ $(HOST_LDFLAGS)
+
+$(SIM_TARGET): $(SIM_OBJS)
+	@echo linking $@
+	@$(HOST_CC) -o $@ $^ $(HOST_LDFLAGS)
+
+$(HOST_BUILD)/obj/%.o: %.c $(HOST_GFX_H) $(HOST_BUILD)/soundbank.h
+	@mkdir -p $(dir $@)
+	@echo $<
+	@$(HOST_CC) $(HOST_CFLAGS) -c $< -o $@
+
+$(HOST_BUILD)/gfx/%.o: $(HOST_BUILD)/gfx/%.c
+	@$(HOST_CC) $(HOST_CFLAGS) -c $< -o $@
+
+$(HOST_BUILD)/gfx/%.c $(HOST_BUILD)/gfx/%.h: graphics/%.png graphics/%.grit
+	@mkdir -p $(dir $@)
+	@echo "grit $(notdir $<)"
+	@$(GRIT) $< -ftc -o$(HOST_BUILD)/gfx/$*
+
+$(HOST_BUILD)/soundbank.h: $(HOST_AUDIO)
+	@mkdir -p $(dir $@)
+	@$(MMUTIL) $^ -o$(HOST_BUILD)/soundbank.bin -h$@
+
+host-clean:
+	@echo clean host ...
+	@rm -fr $(HOST_BUILD)
+
+.SECONDARY:
+
+-include $(shell find $(HOST_BUILD) -name '*.d' 2>/dev/null)
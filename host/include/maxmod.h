@@ -0,0 +1,26 @@
+/**
+ * @file maxmod.h
+ *
+ * @brief Host shim for the maxmod functions used by the game
+ *
+ * Every function is a no-op apart from @ref mmEffectEx() which counts the sound effects
+ * played so host tools can check the game's audio cues without an audio backend.
+ */
+#ifndef MAXMOD_H
+#define MAXMOD_H
+
+#include "mm_types.h"
+
+void mmInitDefault(mm_addr soundbank, mm_word number_of_channels);
+void mmVBlank(void);
+void mmFrame(void);
+void mmStart(mm_word module_ID, mm_pmode mode);
+void mmStop(void);
+mm_sfxhand mmEffectEx(mm_sound_effect* sound);
+
+/**
+ * @brief Number of sound effects played through @ref mmEffectEx() since startup
+ */
+extern mm_word host_mm_effects_played;
+
+#endif // MAXMOD_H
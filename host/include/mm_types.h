@@ -0,0 +1,38 @@
+/**
+ * @file mm_types.h
+ *
+ * @brief Host shim for the maxmod types used by the game
+ */
+#ifndef MM_TYPES_H
+#define MM_TYPES_H
+
+#include <stdint.h>
+
+typedef uint8_t mm_byte;
+typedef uint16_t mm_hword;
+typedef uint32_t mm_word;
+typedef uint16_t mm_sfxhand;
+typedef void* mm_addr;
+typedef uint8_t mm_bool;
+
+typedef enum
+{
+    MM_PLAY_LOOP,
+    MM_PLAY_ONCE
+} mm_pmode;
+
+typedef struct
+{
+    union
+    {
+        mm_word id;
+        mm_word sample;
+    };
+
+    mm_hword rate;
+    mm_sfxhand handle;
+    mm_byte volume;
+    mm_byte panning;
+} mm_sound_effect;
+
+#endif // MM_TYPES_H
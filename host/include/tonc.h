@@ -0,0 +1,818 @@
+/**
+ * @file tonc.h
+ *
+ * @brief Host shim for the parts of libtonc used by the game
+ *
+ * Host Shim
+ * =========
+ *
+ *  - Only used by `make host`, the GBA build uses the real libtonc.
+ *
+ *  - Video memory, OAM, palette and the IO registers are plain in-memory arrays (see
+ *    host_tonc.c) so the game logic can read and write them exactly like on hardware.
+ *    Nothing is rendered.
+ *
+ *  - The key register is writable through @ref host_set_keys() to drive the input.
+ *
+ *  - The functions mirror the libtonc implementations closely enough for the game logic
+ *    (fixed point, affine matrices, OAM attributes) to produce the same values as on the GBA.
+ *    TTE functions only keep track of the cursor and discard the text.
+ */
+#ifndef TONC_H
+#define TONC_H
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @name Types
+ * @{
+ */
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef volatile uint8_t vu8;
+typedef volatile uint16_t vu16;
+typedef volatile uint32_t vu32;
+typedef volatile int16_t vs16;
+typedef volatile int32_t vs32;
+typedef unsigned int uint;
+
+typedef s32 FIXED;
+typedef u16 COLOR;
+typedef u16 SCR_ENTRY;
+typedef u16 SE;
+
+typedef struct
+{
+    u32 data[8];
+} TILE, TILE4;
+
+typedef struct
+{
+    u32 data[16];
+} TILE8;
+
+typedef TILE CHARBLOCK[512];
+typedef TILE8 CHARBLOCK8[256];
+typedef SCR_ENTRY SCREENBLOCK[1024];
+
+typedef struct
+{
+    s32 x, y;
+} POINT, POINT32;
+
+typedef struct
+{
+    s32 left, top;
+    s32 right, bottom;
+} RECT, RECT32;
+
+typedef struct
+{
+    s16 x, y;
+} BG_POINT;
+
+typedef struct
+{
+    u16 attr0;
+    u16 attr1;
+    u16 attr2;
+    s16 fill;
+} OBJ_ATTR;
+
+typedef struct
+{
+    u16 fill0[3];
+    s16 pa;
+    u16 fill1[3];
+    s16 pb;
+    u16 fill2[3];
+    s16 pc;
+    u16 fill3[3];
+    s16 pd;
+} OBJ_AFFINE;
+
+typedef struct
+{
+    s16 pa, pb;
+    s16 pc, pd;
+    s32 dx, dy;
+} BG_AFFINE;
+
+typedef struct
+{
+    s32 tex_x;
+    s32 tex_y;
+    s16 scr_x;
+    s16 scr_y;
+    s16 sx;
+    s16 sy;
+    u16 alpha;
+} AFF_SRC_EX, BgAffineSource;
+
+typedef void (*fnptr)(void);
+
+/** @} */
+
+/**
+ * @name Attributes
+ * @{
+ */
+
+#define INLINE        static inline
+#define ALIGN4        __attribute__((aligned(4)))
+#define EWRAM_DATA    /* Plain .data on the host */
+#define EWRAM_BSS     /* Plain .bss on the host */
+#define IWRAM_DATA    /* Plain .data on the host */
+#define IWRAM_CODE    /* Plain .text on the host */
+#define EWRAM_CODE    /* Plain .text on the host */
+#define BIT(n)        (1 << (n))
+#define STR(x)        #x
+#define XSTR(x)       STR(x)
+#define countof(_arr) (sizeof(_arr) / sizeof(_arr[0]))
+
+/** @} */
+
+/**
+ * @name Memory map
+ * @{
+ */
+
+#define SCREEN_WIDTH  240
+#define SCREEN_HEIGHT 160
+
+#define PAL_SIZE  0x00400
+#define VRAM_SIZE 0x18000
+#define OAM_SIZE  0x00400
+#define IO_SIZE   0x00400
+
+extern u16 host_pal_mem[PAL_SIZE / sizeof(u16)];
+extern u16 host_vram[VRAM_SIZE / sizeof(u16)];
+extern u16 host_oam_mem[OAM_SIZE / sizeof(u16)];
+extern u16 host_io_mem[IO_SIZE / sizeof(u16)];
+
+#define MEM_IO   ((uintptr_t)host_io_mem)
+#define MEM_PAL  ((uintptr_t)host_pal_mem)
+#define MEM_VRAM ((uintptr_t)host_vram)
+#define MEM_OAM  ((uintptr_t)host_oam_mem)
+#define REG_BASE MEM_IO
+
+#define pal_bg_mem  ((COLOR*)MEM_PAL)
+#define pal_obj_mem ((COLOR*)(MEM_PAL + 0x0200))
+#define pal_bg_bank ((PALBANK*)MEM_PAL)
+#define pal_obj_bank ((PALBANK*)(MEM_PAL + 0x0200))
+
+#define tile_mem  ((CHARBLOCK*)MEM_VRAM)
+#define tile8_mem ((CHARBLOCK8*)MEM_VRAM)
+#define se_mem    ((SCREENBLOCK*)MEM_VRAM)
+#define se_mat    ((SCREENMAT*)MEM_VRAM)
+
+#define oam_mem     ((OBJ_ATTR*)MEM_OAM)
+#define obj_mem     ((OBJ_ATTR*)MEM_OAM)
+#define obj_aff_mem ((OBJ_AFFINE*)MEM_OAM)
+
+typedef COLOR PALBANK[16];
+typedef SCR_ENTRY SCREENLINE[32];
+typedef SCREENLINE SCREENMAT[32];
+
+/** @} */
+
+/**
+ * @name IO registers
+ * @{
+ */
+
+#define REG_DISPCNT  *(vu32*)(REG_BASE + 0x0000)
+#define REG_DISPSTAT *(vu16*)(REG_BASE + 0x0004)
+#define REG_VCOUNT   *(vu16*)(REG_BASE + 0x0006)
+
+#define REG_BGCNT   ((vu16*)(REG_BASE + 0x0008))
+#define REG_BG0CNT  *(vu16*)(REG_BASE + 0x0008)
+#define REG_BG1CNT  *(vu16*)(REG_BASE + 0x000A)
+#define REG_BG2CNT  *(vu16*)(REG_BASE + 0x000C)
+#define REG_BG3CNT  *(vu16*)(REG_BASE + 0x000E)
+#define REG_BG_OFS  ((BG_POINT*)(REG_BASE + 0x0010))
+#define REG_BG0HOFS *(vu16*)(REG_BASE + 0x0010)
+#define REG_BG0VOFS *(vu16*)(REG_BASE + 0x0012)
+#define REG_BG1HOFS *(vu16*)(REG_BASE + 0x0014)
+#define REG_BG1VOFS *(vu16*)(REG_BASE + 0x0016)
+#define REG_BG2HOFS *(vu16*)(REG_BASE + 0x0018)
+#define REG_BG2VOFS *(vu16*)(REG_BASE + 0x001A)
+
+#define REG_BG_AFFINE ((BG_AFFINE*)(REG_BASE + 0x0000))
+#define REG_BG2PA     *(vs16*)(REG_BASE + 0x0020)
+#define REG_BG2X      *(vs32*)(REG_BASE + 0x0028)
+#define REG_BG2Y      *(vs32*)(REG_BASE + 0x002C)
+
+#define REG_WIN0H     *(vu16*)(REG_BASE + 0x0040)
+#define REG_WIN1H     *(vu16*)(REG_BASE + 0x0042)
+#define REG_WIN0V     *(vu16*)(REG_BASE + 0x0044)
+#define REG_WIN1V     *(vu16*)(REG_BASE + 0x0046)
+#define REG_WININ     *(vu16*)(REG_BASE + 0x0048)
+#define REG_WIN0CNT   *(vu8*)(REG_BASE + 0x0048)
+#define REG_WIN1CNT   *(vu8*)(REG_BASE + 0x0049)
+#define REG_WINOUT    *(vu16*)(REG_BASE + 0x004A)
+#define REG_WINOUTCNT *(vu8*)(REG_BASE + 0x004A)
+#define REG_WINOBJCNT *(vu8*)(REG_BASE + 0x004B)
+
+#define REG_BLDCNT   *(vu16*)(REG_BASE + 0x0050)
+#define REG_BLDALPHA *(vu16*)(REG_BASE + 0x0052)
+#define REG_BLDY     *(vu16*)(REG_BASE + 0x0054)
+
+// The pointers of DMA_REC don't fit the 32 bit registers on the host, see host_dma
+#define REG_DMA       ((volatile DMA_REC*)host_dma)
+#define REG_DMA0CNT   *(vu32*)(REG_BASE + 0x00B8)
+#define REG_DMA3SAD   *(vu32*)(REG_BASE + 0x00D4)
+#define REG_DMA3DAD   *(vu32*)(REG_BASE + 0x00D8)
+#define REG_DMA3CNT   *(vu32*)(REG_BASE + 0x00DC)
+
+#define REG_TM      ((volatile TMR_REC*)(REG_BASE + 0x0100))
+#define REG_TM0D    *(vu16*)(REG_BASE + 0x0100)
+#define REG_TM0CNT  *(vu16*)(REG_BASE + 0x0102)
+#define REG_TM1D    *(vu16*)(REG_BASE + 0x0104)
+#define REG_TM1CNT  *(vu16*)(REG_BASE + 0x0106)
+#define REG_TM2D    *(vu16*)(REG_BASE + 0x0108)
+#define REG_TM2CNT  *(vu16*)(REG_BASE + 0x010A)
+#define REG_TM3D    *(vu16*)(REG_BASE + 0x010C)
+#define REG_TM3CNT  *(vu16*)(REG_BASE + 0x010E)
+
+#define REG_KEYINPUT *(vu16*)(REG_BASE + 0x0130)
+#define REG_KEYCNT   *(vu16*)(REG_BASE + 0x0132)
+
+#define REG_IE  *(vu16*)(REG_BASE + 0x0200)
+#define REG_IF  *(vu16*)(REG_BASE + 0x0202)
+#define REG_IME *(vu16*)(REG_BASE + 0x0208)
+
+typedef struct
+{
+    const void* src;
+    void* dst;
+    u32 cnt;
+} DMA_REC;
+
+// The DMA channels, VBlankIntrWait() runs the HBlank transfers of the visible lines
+extern DMA_REC host_dma[4];
+
+typedef struct
+{
+    union
+    {
+        u16 start, count;
+    } __attribute__((packed));
+
+    u16 cnt;
+} TMR_REC;
+
+/** @} */
+
+/**
+ * @name Register bits
+ * @{
+ */
+
+#define DCNT_MODE0  0x0000
+#define DCNT_MODE1  0x0001
+#define DCNT_MODE2  0x0002
+#define DCNT_OBJ_1D 0x0040
+#define DCNT_BLANK  0x0080
+#define DCNT_BG0    0x0100
+#define DCNT_BG1    0x0200
+#define DCNT_BG2    0x0400
+#define DCNT_BG3    0x0800
+#define DCNT_OBJ    0x1000
+#define DCNT_WIN0   0x2000
+#define DCNT_WIN1   0x4000
+#define DCNT_WINOBJ 0x8000
+
+#define BG_MOSAIC 0x0040
+#define BG_4BPP   0
+#define BG_8BPP   0x0080
+#define BG_WRAP   0x2000
+#define BG_SIZE0  0
+#define BG_SIZE1  0x4000
+#define BG_SIZE2  0x8000
+#define BG_SIZE3  0xC000
+
+#define BG_REG_32x32 0
+#define BG_AFF_16x16 0
+#define BG_AFF_32x32 0x4000
+#define BG_AFF_64x64 0x8000
+
+#define BG_CBB_SHIFT  2
+#define BG_SBB_SHIFT  8
+#define BG_PRIO_SHIFT 0
+#define BG_CBB(n)     ((n) << BG_CBB_SHIFT)
+#define BG_SBB(n)     ((n) << BG_SBB_SHIFT)
+#define BG_PRIO(n)    ((n) << BG_PRIO_SHIFT)
+
+#define WIN_BG0 0x0001
+#define WIN_BG1 0x0002
+#define WIN_BG2 0x0004
+#define WIN_BG3 0x0008
+#define WIN_OBJ 0x0010
+#define WIN_ALL 0x001F
+#define WIN_BLD 0x0020
+
+#define BLD_BG0   0x0001
+#define BLD_BG1   0x0002
+#define BLD_BG2   0x0004
+#define BLD_BG3   0x0008
+#define BLD_OBJ   0x0010
+#define BLD_ALL   0x001F
+#define BLD_BACKDROP 0x0020
+#define BLD_OFF   0
+#define BLD_STD   0x0040
+#define BLD_WHITE 0x0080
+#define BLD_BLACK 0x00C0
+
+#define BLD_TOP_SHIFT  0
+#define BLD_MODE_SHIFT 6
+#define BLD_BOT_SHIFT  8
+#define BLD_BUILD(top, bot, mode) \
+    ((((bot) & 63) << BLD_BOT_SHIFT) | (((mode) & 3) << BLD_MODE_SHIFT) | ((top) & 63))
+
+#define BLDA_EVA_SHIFT  0
+#define BLDA_EVB_SHIFT  8
+#define BLDA_BUILD(eva, evb) (((eva) & 31) | (((evb) & 31) << BLDA_EVB_SHIFT))
+
+#define IRQ_VBLANK 0x0001
+#define IRQ_HBLANK 0x0002
+#define IRQ_VCOUNT 0x0004
+#define IRQ_TIMER0 0x0008
+#define IRQ_TIMER1 0x0010
+#define IRQ_TIMER2 0x0020
+#define IRQ_TIMER3 0x0040
+
+enum eIrqIndex
+{
+    II_VBLANK = 0,
+    II_HBLANK,
+    II_VCOUNT,
+    II_TIMER0,
+    II_TIMER1,
+    II_TIMER2,
+    II_TIMER3,
+    II_SERIAL,
+    II_DMA0,
+    II_DMA1,
+    II_DMA2,
+    II_DMA3,
+    II_KEYPAD,
+    II_GAMEPAK,
+    II_MAX
+};
+
+#define TM_FREQ_SYS  0
+#define TM_FREQ_1    0
+#define TM_FREQ_64   0x0001
+#define TM_FREQ_256  0x0002
+#define TM_FREQ_1024 0x0003
+#define TM_CASCADE   0x0004
+#define TM_IRQ       0x0040
+#define TM_ENABLE    0x0080
+
+#define DMA_DST_INC    0
+#define DMA_DST_DEC    0x00200000
+#define DMA_DST_FIXED  0x00400000
+#define DMA_DST_RELOAD 0x00600000
+#define DMA_SRC_INC    0
+#define DMA_SRC_DEC    0x00800000
+#define DMA_SRC_FIXED  0x01000000
+#define DMA_REPEAT     0x02000000
+#define DMA_16         0
+#define DMA_32         0x04000000
+#define DMA_NOW        0
+#define DMA_AT_VBLANK  0x10000000
+#define DMA_AT_HBLANK  0x20000000
+#define DMA_IRQ        0x40000000
+#define DMA_ENABLE     0x80000000
+
+#define DMA_HDMA (DMA_ENABLE | DMA_REPEAT | DMA_AT_HBLANK | DMA_DST_RELOAD)
+
+/** @} */
+
+/**
+ * @name Keys
+ * @{
+ */
+
+#define KEY_A      0x0001
+#define KEY_B      0x0002
+#define KEY_SELECT 0x0004
+#define KEY_START  0x0008
+#define KEY_RIGHT  0x0010
+#define KEY_LEFT   0x0020
+#define KEY_UP     0x0040
+#define KEY_DOWN   0x0080
+#define KEY_R      0x0100
+#define KEY_L      0x0200
+#define KEY_MASK   0x03FF
+
+enum eKeyIndex
+{
+    KI_A = 0,
+    KI_B,
+    KI_SELECT,
+    KI_START,
+    KI_RIGHT,
+    KI_LEFT,
+    KI_UP,
+    KI_DOWN,
+    KI_R,
+    KI_L,
+    KI_MAX
+};
+#define KEY_ANY    0x03FF
+#define KEY_DIR    0x00F0
+
+extern u16 __key_curr, __key_prev;
+
+void key_poll(void);
+
+/**
+ * @brief Set the keys the fake key register reports as held, applied on the next key_poll()
+ *
+ * @param keys KEY_* flags of the held keys
+ */
+void host_set_keys(u16 keys);
+
+INLINE int bit_tribool(u32 flags, uint plus, uint minus)
+{
+    return ((flags >> plus) & 1) - ((flags >> minus) & 1);
+}
+
+INLINE u32 key_curr_state(void)
+{
+    return __key_curr;
+}
+
+INLINE u32 key_prev_state(void)
+{
+    return __key_prev;
+}
+
+INLINE u32 key_is_down(u32 key)
+{
+    return __key_curr & key;
+}
+
+INLINE u32 key_is_up(u32 key)
+{
+    return ~__key_curr & key;
+}
+
+INLINE u32 key_hit(u32 key)
+{
+    return (__key_curr & ~__key_prev) & key;
+}
+
+INLINE u32 key_released(u32 key)
+{
+    return (~__key_curr & __key_prev) & key;
+}
+
+INLINE u32 key_transit(u32 key)
+{
+    return (__key_curr ^ __key_prev) & key;
+}
+
+INLINE u32 key_held(u32 key)
+{
+    return (__key_curr & __key_prev) & key;
+}
+
+/** @} */
+
+/**
+ * @name Colors
+ * @{
+ */
+
+#define CLR_BLACK  0x0000
+#define CLR_RED    0x001F
+#define CLR_LIME   0x03E0
+#define CLR_YELLOW 0x03FF
+#define CLR_BLUE   0x7C00
+#define CLR_WHITE  0x7FFF
+
+INLINE COLOR RGB15(u32 red, u32 green, u32 blue)
+{
+    return red | (green << 5) | (blue << 10);
+}
+
+void clr_rgbscale(COLOR* dst, const COLOR* src, uint nclrs, COLOR clr);
+void clr_fade(const COLOR* srca, COLOR clr, COLOR* dst, uint nclrs, u32 alpha);
+
+/** @} */
+
+/**
+ * @name Math
+ * @{
+ */
+
+#define FIX_SHIFT 8
+#define FIX_SCALE (1 << FIX_SHIFT)
+#define FIX_MASK  (FIX_SCALE - 1)
+#define FIX_ONE   FIX_SCALE
+
+#define SIN_LUT_SIZE 512
+
+// Filled in at startup on the host, read-only for the game like the libtonc table
+extern s16 host_sin_lut[SIN_LUT_SIZE];
+#define sin_lut ((const s16*)host_sin_lut)
+
+#define ABS(x)            ((x) >= 0 ? (x) : -(x))
+#define SGN(x)            ((x) >= 0 ? 1 : -1)
+#define CLAMP(x, min, max) ((x) >= (max) ? ((max) - 1) : (((x) < (min)) ? (min) : (x)))
+
+INLINE int max(int a, int b)
+{
+    return a > b ? a : b;
+}
+
+INLINE int min(int a, int b)
+{
+    return a < b ? a : b;
+}
+
+INLINE int clamp(int x, int min, int max)
+{
+    return x >= max ? max - 1 : (x < min ? min : x);
+}
+
+INLINE FIXED int2fx(int d)
+{
+    return d << FIX_SHIFT;
+}
+
+INLINE FIXED float2fx(float f)
+{
+    return (FIXED)(f * FIX_SCALE);
+}
+
+INLINE u32 fx2uint(FIXED fx)
+{
+    return fx >> FIX_SHIFT;
+}
+
+INLINE u32 fx2ufrac(FIXED fx)
+{
+    return fx & FIX_MASK;
+}
+
+INLINE int fx2int(FIXED fx)
+{
+    return fx / FIX_SCALE;
+}
+
+INLINE float fx2float(FIXED fx)
+{
+    return fx / (float)FIX_SCALE;
+}
+
+INLINE FIXED fxadd(FIXED fa, FIXED fb)
+{
+    return fa + fb;
+}
+
+INLINE FIXED fxsub(FIXED fa, FIXED fb)
+{
+    return fa - fb;
+}
+
+INLINE FIXED fxmul(FIXED fa, FIXED fb)
+{
+    return (fa * fb) >> FIX_SHIFT;
+}
+
+INLINE FIXED fxdiv(FIXED fa, FIXED fb)
+{
+    return (fa * FIX_SCALE) / fb;
+}
+
+INLINE s32 lu_sin(uint theta)
+{
+    return sin_lut[(theta >> 7) & 0x1FF];
+}
+
+INLINE s32 lu_cos(uint theta)
+{
+    return sin_lut[((theta >> 7) + 128) & 0x1FF];
+}
+
+void sqran(int seed);
+int qran(void);
+
+INLINE int qran_range(int min, int max)
+{
+    return (qran() * (max - min) >> 15) + min;
+}
+
+/** @} */
+
+/**
+ * @name Memory and BIOS
+ * @{
+ */
+
+void memcpy16(void* dst, const void* src, uint hwcount);
+void memcpy32(void* dst, const void* src, uint wcount);
+void memset16(void* dst, u16 hw, uint hwcount);
+void memset32(void* dst, u32 wd, uint wcount);
+void* tonccpy(void* dst, const void* src, uint size);
+void* toncset(void* dst, u8 src, uint count);
+// DMA channel 3 copy of size bytes, a plain copy on the host
+void dma3_cpy(void* dst, const void* src, uint size);
+
+#define DMA_TRANSFER(_dst, _src, count, ch, mode) \
+    do                                            \
+    {                                             \
+        REG_DMA[ch].cnt = 0;                      \
+        REG_DMA[ch].src = (const void*)(_src);    \
+        REG_DMA[ch].dst = (void*)(_dst);          \
+        REG_DMA[ch].cnt = (count) | (mode);       \
+    } while (0)
+
+#define GRIT_CPY(dst, name) memcpy16(dst, name, name##Len / 2)
+
+void irq_init(fnptr isr);
+fnptr irq_add(enum eIrqIndex irq_id, fnptr isr);
+fnptr irq_set(enum eIrqIndex irq_id, fnptr isr, u32 opts);
+void VBlankIntrWait(void);
+
+/** @} */
+
+/**
+ * @name OAM
+ * @{
+ */
+
+#define ATTR0_REG     0
+#define ATTR0_AFF     0x0100
+#define ATTR0_HIDE    0x0200
+#define ATTR0_AFF_DBL 0x0300
+#define ATTR0_BLEND   0x0400
+#define ATTR0_WINDOW  0x0800
+#define ATTR0_MOSAIC  0x1000
+#define ATTR0_4BPP    0
+#define ATTR0_8BPP    0x2000
+#define ATTR0_SQUARE  0
+#define ATTR0_WIDE    0x4000
+#define ATTR0_TALL    0x8000
+
+#define ATTR0_Y_MASK     0x00FF
+#define ATTR0_Y_SHIFT    0
+#define ATTR0_MODE_MASK  0x0300
+#define ATTR0_MODE_SHIFT 8
+#define ATTR0_SHAPE_MASK 0xC000
+
+#define ATTR1_HFLIP   0x1000
+#define ATTR1_VFLIP   0x2000
+#define ATTR1_SIZE_8  0
+#define ATTR1_SIZE_16 0x4000
+#define ATTR1_SIZE_32 0x8000
+#define ATTR1_SIZE_64 0xC000
+
+#define ATTR1_SIZE_8x8   0
+#define ATTR1_SIZE_16x16 0x4000
+#define ATTR1_SIZE_32x32 0x8000
+#define ATTR1_SIZE_64x64 0xC000
+
+#define ATTR1_X_MASK      0x01FF
+#define ATTR1_X_SHIFT     0
+#define ATTR1_AFF_ID_MASK 0x3E00
+#define ATTR1_AFF_ID_SHIFT 9
+#define ATTR1_AFF_ID(n)   ((n) << ATTR1_AFF_ID_SHIFT)
+#define ATTR1_SIZE_MASK   0xC000
+
+#define ATTR2_ID_MASK      0x03FF
+#define ATTR2_ID_SHIFT     0
+#define ATTR2_ID(n)        ((n) << ATTR2_ID_SHIFT)
+#define ATTR2_PRIO_MASK    0x0C00
+#define ATTR2_PRIO_SHIFT   10
+#define ATTR2_PRIO(n)      ((n) << ATTR2_PRIO_SHIFT)
+#define ATTR2_PALBANK_MASK  0xF000
+#define ATTR2_PALBANK_SHIFT 12
+#define ATTR2_PALBANK(n)    ((n) << ATTR2_PALBANK_SHIFT)
+
+extern const u8 oam_sizes[3][4][2];
+
+void oam_init(OBJ_ATTR* obj, uint count);
+void oam_copy(OBJ_ATTR* dst, const OBJ_ATTR* src, uint count);
+void obj_copy(OBJ_ATTR* dst, const OBJ_ATTR* src, uint count);
+void obj_aff_copy(OBJ_AFFINE* dst, const OBJ_AFFINE* src, uint count);
+void obj_aff_rotscale(OBJ_AFFINE* oaff, FIXED sx, FIXED sy, u16 alpha);
+
+INLINE OBJ_ATTR* obj_set_attr(OBJ_ATTR* obj, u16 a0, u16 a1, u16 a2)
+{
+    obj->attr0 = a0;
+    obj->attr1 = a1;
+    obj->attr2 = a2;
+    return obj;
+}
+
+INLINE void obj_set_pos(OBJ_ATTR* obj, int x, int y)
+{
+    obj->attr0 = (obj->attr0 & ~ATTR0_Y_MASK) | (y & ATTR0_Y_MASK);
+    obj->attr1 = (obj->attr1 & ~ATTR1_X_MASK) | (x & ATTR1_X_MASK);
+}
+
+INLINE void obj_hide(OBJ_ATTR* obj)
+{
+    obj->attr0 = (obj->attr0 & ~ATTR0_MODE_MASK) | ATTR0_HIDE;
+}
+
+INLINE void obj_unhide(OBJ_ATTR* obj, u16 mode)
+{
+    obj->attr0 = (obj->attr0 & ~ATTR0_MODE_MASK) | mode;
+}
+
+INLINE const u8* obj_get_size(const OBJ_ATTR* obj)
+{
+    return oam_sizes[obj->attr0 >> 14][obj->attr1 >> 14];
+}
+
+INLINE int obj_get_width(const OBJ_ATTR* obj)
+{
+    return obj_get_size(obj)[0];
+}
+
+INLINE int obj_get_height(const OBJ_ATTR* obj)
+{
+    return obj_get_size(obj)[1];
+}
+
+INLINE void obj_aff_identity(OBJ_AFFINE* oaff)
+{
+    oaff->pa = 0x0100;
+    oaff->pb = 0;
+    oaff->pc = 0;
+    oaff->pd = 0x0100;
+}
+
+/** @} */
+
+/**
+ * @name Backgrounds
+ * @{
+ */
+
+#define SE_HFLIP 0x0400
+#define SE_VFLIP 0x0800
+
+extern const BG_AFFINE bg_aff_default;
+
+void bg_rotscale_ex(BG_AFFINE* bgaff, const AFF_SRC_EX* asx);
+
+/** @} */
+
+/**
+ * @name Text engine
+ * @{
+ */
+
+typedef struct
+{
+    const void* data;
+    u8* widths;
+    u8* heights;
+    u16 charOffset;
+    u16 charCount;
+    u8 charW;
+    u8 charH;
+    u8 cellW;
+    u8 cellH;
+    u16 cellSize;
+    u8 bpp;
+    u8 extra;
+} TFont;
+
+void tte_init_se(
+    int bgnr,
+    u16 bgcnt,
+    SCR_ENTRY se0,
+    u32 clrs,
+    u32 bupofs,
+    const TFont* font,
+    fnptr proc
+);
+void tte_init_con(void);
+void tte_set_pos(int x, int y);
+void tte_set_special(u16 special);
+int tte_write(const char* text);
+int tte_printf(const char* format, ...) __attribute__((format(printf, 1, 2)));
+void tte_erase_rect(int left, int top, int right, int bottom);
+void tte_erase_screen(void);
+
+/** @} */
+
+#endif // TONC_H
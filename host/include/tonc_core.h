@@ -0,0 +1,7 @@
+// Host shim, everything lives in tonc.h
+#ifndef TONC_CORE_H
+#define TONC_CORE_H
+
+#include "tonc.h"
+
+#endif // TONC_CORE_H
@@ -0,0 +1,7 @@
+// Host shim, everything lives in tonc.h
+#ifndef TONC_MATH_H
+#define TONC_MATH_H
+
+#include "tonc.h"
+
+#endif // TONC_MATH_H
@@ -0,0 +1,7 @@
+// Host shim, everything lives in tonc.h
+#ifndef TONC_MEMDEF_H
+#define TONC_MEMDEF_H
+
+#include "tonc.h"
+
+#endif // TONC_MEMDEF_H
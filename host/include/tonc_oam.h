@@ -0,0 +1,7 @@
+// Host shim, everything lives in tonc.h
+#ifndef TONC_OAM_H
+#define TONC_OAM_H
+
+#include "tonc.h"
+
+#endif // TONC_OAM_H
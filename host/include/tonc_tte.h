@@ -0,0 +1,7 @@
+// Host shim, everything lives in tonc.h
+#ifndef TONC_TTE_H
+#define TONC_TTE_H
+
+#include "tonc.h"
+
+#endif // TONC_TTE_H
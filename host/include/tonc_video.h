@@ -0,0 +1,7 @@
+// Host shim, everything lives in tonc.h
+#ifndef TONC_VIDEO_H
+#define TONC_VIDEO_H
+
+#include "tonc.h"
+
+#endif // TONC_VIDEO_H
@@ -0,0 +1,483 @@
+#include "sim.h"
+
+#include "pool.h"
+#include "scoring.h"
+#include "sprite.h"
+#include "util.h"
+#include "vector.h"
+
+#include <stdlib.h>
+
+typedef struct
+{
+    Card* cards[MAX_DECK_SIZE];
+
+    Card* deck[MAX_DECK_SIZE];
+    int deck_top;
+
+    CardObject* hand[MAX_HAND_SIZE];
+    int hand_size;
+
+    bool joker_avail[MAX_DEFINABLE_JOKERS];
+
+    SimRunState state;
+    u32 best_hand_score;
+} SimRun;
+
+static ScoreResult _score_result;
+
+static int s_score_bucket(u32 score)
+{
+    int bucket = 0;
+    while (score > 0)
+    {
+        bucket++;
+        score >>= 1;
+    }
+    return bucket;
+}
+
+static void s_deck_shuffle(SimRun* run)
+{
+    for (int i = run->deck_top; i > 0; i--)
+    {
+        int j = rand() % (i + 1);
+        Card* temp = run->deck[i];
+        run->deck[i] = run->deck[j];
+        run->deck[j] = temp;
+    }
+}
+
+static void s_hand_fill(SimRun* run)
+{
+    while (run->hand_size < DEFAULT_HAND_SIZE && run->deck_top >= 0)
+    {
+        run->hand[run->hand_size++] = card_object_new(run->deck[run->deck_top--]);
+    }
+
+    run->state.hand_size = run->hand_size;
+    run->state.deck_size = run->deck_top + 1;
+}
+
+static void s_card_objects_destroy(CardObject** card_objects, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        card_object_destroy(&card_objects[i]);
+    }
+}
+
+// Moves the selected cards out of the hand into out, keeping the hand order for both
+static int s_hand_take_selected(SimRun* run, const bool* selection, CardObject** out)
+{
+    int num_taken = 0;
+    int num_kept = 0;
+
+    for (int i = 0; i < run->hand_size; i++)
+    {
+        if (selection[i])
+        {
+            out[num_taken++] = run->hand[i];
+        }
+        else
+        {
+            run->hand[num_kept++] = run->hand[i];
+        }
+    }
+
+    run->hand_size = num_kept;
+    run->state.hand_size = num_kept;
+    return num_taken;
+}
+
+static void s_remove_joker(SimRun* run, JokerObject* joker_object)
+{
+    int idx = vector_find(get_jokers_list(), joker_object);
+    if (idx == -1)
+    {
+        return;
+    }
+
+    run->joker_avail[joker_object->joker->id] = true;
+    remove_owned_joker(idx);
+    joker_object_destroy(&joker_object);
+}
+
+static void s_remove_expired_jokers(SimRun* run, const ScoreResult* result)
+{
+    // Recorded once each, even past the last recorded step
+    for (int i = 0; i < result->num_expired_jokers; i++)
+    {
+        s_remove_joker(run, POOL_FROM_HANDLE(JokerObject, result->expired_jokers[i]));
+    }
+}
+
+static void s_play_selection(SimRun* run, bool* selection, int num_selected, SimStats* stats)
+{
+    CardObject* played[MAX_SELECTION_SIZE];
+
+    if (num_selected == 0 || num_selected > MAX_SELECTION_SIZE)
+    {
+        for (int i = 0; i < run->hand_size; i++)
+        {
+            selection[i] = (i == 0);
+        }
+    }
+
+    int num_played = s_hand_take_selected(run, selection, played);
+
+    run->state.hands--;
+
+    ScoreContext ctx = {
+        .hands_remaining = run->state.hands,
+        .discards_remaining = run->state.discards,
+        .deck_size = run->deck_top + 1,
+        .money = run->state.money,
+    };
+
+    score_hand(
+        played,
+        num_played,
+        run->hand,
+        run->hand_size,
+        get_jokers_list(),
+        get_jokers_event_index(),
+        &ctx,
+        &_score_result
+    );
+
+    run->state.score = u32_protected_add(run->state.score, _score_result.score);
+    run->state.money += _score_result.money_delta;
+    run->best_hand_score = max(run->best_hand_score, _score_result.score);
+
+    stats->hands_played++;
+    stats->hand_score_buckets[s_score_bucket(_score_result.score)]++;
+
+    s_remove_expired_jokers(run, &_score_result);
+    s_card_objects_destroy(played, num_played);
+}
+
+static void s_discard_selection(SimRun* run, bool* selection, SimStats* stats)
+{
+    CardObject* discarded[MAX_SELECTION_SIZE];
+
+    int num_discarded = s_hand_take_selected(run, selection, discarded);
+
+    run->state.discards--;
+    stats->discards_used++;
+
+    s_card_objects_destroy(discarded, num_discarded);
+}
+
+// Returns true if the blind was beaten
+static bool s_play_blind(SimRun* run, const SimPolicy* policy, SimStats* stats)
+{
+    SimRunState* state = &run->state;
+
+    state->score = 0;
+    state->requirement = blind_get_requirement(state->blind, state->ante);
+    state->hands = DEFAULT_MAX_HANDS;
+    state->discards = DEFAULT_MAX_DISCARDS;
+
+    for (int i = 0; i < MAX_DECK_SIZE; i++)
+    {
+        run->deck[i] = run->cards[i];
+    }
+    run->deck_top = MAX_DECK_SIZE - 1;
+    s_deck_shuffle(run);
+
+    s_hand_fill(run);
+
+    while (state->hands > 0 && state->score < state->requirement && run->hand_size > 0)
+    {
+        bool selection[MAX_HAND_SIZE] = {false};
+        enum SimAction action = policy->choose_action(state, selection);
+
+        int num_selected = 0;
+        for (int i = 0; i < run->hand_size; i++)
+        {
+            num_selected += selection[i];
+        }
+
+        if (action == SIM_ACTION_DISCARD && state->discards > 0 && num_selected > 0 &&
+            num_selected <= MAX_SELECTION_SIZE)
+        {
+            s_discard_selection(run, selection, stats);
+        }
+        else
+        {
+            s_play_selection(run, selection, num_selected, stats);
+        }
+
+        s_hand_fill(run);
+    }
+
+    s_card_objects_destroy(run->hand, run->hand_size);
+    run->hand_size = 0;
+    state->hand_size = 0;
+
+    return state->score >= state->requirement;
+}
+
+// Same roll as the in-game shop: a rarity first, any available Joker if none of that rarity is
+static int s_shop_roll_joker_id(SimRun* run)
+{
+    int joker_rarity = joker_get_random_rarity();
+    int matching_joker_ids[MAX_DEFINABLE_JOKERS];
+    int avail_joker_ids[MAX_DEFINABLE_JOKERS];
+    int match_count = 0;
+    int avail_count = 0;
+
+    for (int joker_id = 0; joker_id < get_joker_registry_size(); joker_id++)
+    {
+        if (!run->joker_avail[joker_id])
+        {
+            continue;
+        }
+
+        avail_joker_ids[avail_count++] = joker_id;
+        if (get_joker_registry_entry(joker_id)->rarity == joker_rarity)
+        {
+            matching_joker_ids[match_count++] = joker_id;
+        }
+    }
+
+    if (avail_count == 0)
+    {
+        return UNDEFINED;
+    }
+
+    int fallback_joker_id = avail_joker_ids[random() % avail_count];
+    return match_count > 0 ? matching_joker_ids[random() % match_count] : fallback_joker_id;
+}
+
+static void s_visit_shop(SimRun* run, const SimPolicy* policy, SimStats* stats)
+{
+    Joker* offered[MAX_SHOP_JOKERS] = {NULL};
+
+    for (int i = 0; i < MAX_SHOP_JOKERS; i++)
+    {
+        int joker_id = s_shop_roll_joker_id(run);
+        if (joker_id == UNDEFINED)
+        {
+            break;
+        }
+
+        run->joker_avail[joker_id] = false;
+        offered[i] = joker_new(joker_id);
+    }
+
+    for (int i = 0; i < MAX_SHOP_JOKERS && offered[i] != NULL; i++)
+    {
+        bool can_buy = run->state.money >= offered[i]->value &&
+                       vector_get_len(get_jokers_list()) < MAX_JOKERS_HELD_SIZE;
+
+        if (can_buy && policy->buy_joker(&run->state, offered[i]))
+        {
+            run->state.money -= offered[i]->value;
+            add_joker(joker_object_new(offered[i]));
+            stats->jokers_bought++;
+        }
+        else
+        {
+            run->joker_avail[offered[i]->id] = true;
+            joker_destroy(&offered[i]);
+        }
+    }
+}
+
+void sim_init(void)
+{
+    sprite_init();
+    card_init();
+    blind_init();
+    joker_init();
+    game_init();
+}
+
+static void s_record_pool_stats(SimStats* stats)
+{
+    const PoolStats* pool_stats[SIM_MAX_POOLS];
+    int num_pools = pool_get_stats(pool_stats, SIM_MAX_POOLS);
+
+    for (int i = 0; i < num_pools; i++)
+    {
+        stats->pool_high_water_marks[i] =
+            max(stats->pool_high_water_marks[i], pool_stats[i]->high_water_mark);
+        stats->pool_failed_gets[i] += pool_stats[i]->failed_gets;
+    }
+
+    pool_reset_stats();
+}
+
+void sim_run(const SimPolicy* policy, u32 seed, SimStats* stats)
+{
+    static SimRun run;
+
+    srand(seed);
+
+    run.hand_size = 0;
+    run.best_hand_score = 0;
+    run.state = (SimRunState){
+        .ante = STARTING_ANTE,
+        .blind = BLIND_TYPE_SMALL,
+        .money = STARTING_MONEY,
+        .hand = run.hand,
+        .jokers = get_jokers_list(),
+    };
+
+    for (int suit = 0; suit < NUM_SUITS; suit++)
+    {
+        for (int rank = 0; rank < NUM_RANKS; rank++)
+        {
+            run.cards[suit * NUM_RANKS + rank] = card_new(suit, rank);
+        }
+    }
+
+    for (int joker_id = 0; joker_id < MAX_DEFINABLE_JOKERS; joker_id++)
+    {
+        run.joker_avail[joker_id] = joker_id < get_joker_registry_size();
+    }
+
+    bool won = false;
+    while (s_play_blind(&run, policy, stats))
+    {
+        SimRunState* state = &run.state;
+
+        state->money += state->hands + blind_get_reward(state->blind) +
+                        calculate_interest_reward(state->money);
+
+        if (state->blind == BLIND_TYPE_BOSS)
+        {
+            stats->antes_cleared[state->ante]++;
+
+            if (state->ante == MAX_ANTE)
+            {
+                won = true;
+                break;
+            }
+
+            state->ante++;
+            state->blind = BLIND_TYPE_SMALL;
+        }
+        else
+        {
+            state->blind++;
+        }
+
+        s_visit_shop(&run, policy, stats);
+    }
+
+    stats->runs++;
+    stats->wins += won;
+    stats->best_hand_buckets[s_score_bucket(run.best_hand_score)]++;
+
+    while (!vector_is_empty(get_jokers_list()))
+    {
+        s_remove_joker(&run, vector_get_at_idx(get_jokers_list(), 0));
+    }
+
+    for (int i = 0; i < MAX_DECK_SIZE; i++)
+    {
+        card_destroy(&run.cards[i]);
+    }
+
+    s_record_pool_stats(stats);
+}
+
+void sim_stats_merge(SimStats* dst, const SimStats* src)
+{
+    dst->runs += src->runs;
+    dst->wins += src->wins;
+    dst->hands_played += src->hands_played;
+    dst->discards_used += src->discards_used;
+    dst->jokers_bought += src->jokers_bought;
+
+    for (int i = 0; i <= MAX_ANTE; i++)
+    {
+        dst->antes_cleared[i] += src->antes_cleared[i];
+    }
+
+    for (int i = 0; i < SIM_SCORE_BUCKETS; i++)
+    {
+        dst->hand_score_buckets[i] += src->hand_score_buckets[i];
+        dst->best_hand_buckets[i] += src->best_hand_buckets[i];
+    }
+
+    for (int i = 0; i < SIM_MAX_POOLS; i++)
+    {
+        dst->pool_high_water_marks[i] =
+            max(dst->pool_high_water_marks[i], src->pool_high_water_marks[i]);
+        dst->pool_failed_gets[i] += src->pool_failed_gets[i];
+    }
+}
+
+static void s_print_histogram(const uint64_t* buckets, uint64_t total, FILE* out)
+{
+    for (int i = 0; i < SIM_SCORE_BUCKETS; i++)
+    {
+        if (buckets[i] == 0)
+        {
+            continue;
+        }
+
+        u32 low = i == 0 ? 0 : (1u << (i - 1));
+        u32 high = i == 0 ? 0 : (u32)((1ull << i) - 1);
+        fprintf(
+            out,
+            "  %10u - %-10u %12llu  %6.2f%%\n",
+            low,
+            high,
+            (unsigned long long)buckets[i],
+            100.0 * buckets[i] / total
+        );
+    }
+}
+
+void sim_stats_print(const SimStats* stats, FILE* out)
+{
+    uint64_t runs = stats->runs > 0 ? stats->runs : 1;
+    uint64_t hands = stats->hands_played > 0 ? stats->hands_played : 1;
+
+    fprintf(out, "runs:             %llu\n", (unsigned long long)stats->runs);
+    fprintf(out, "win rate:         %.4f%%\n", 100.0 * stats->wins / runs);
+    fprintf(out, "hands per run:    %.2f\n", (double)stats->hands_played / runs);
+    fprintf(out, "discards per run: %.2f\n", (double)stats->discards_used / runs);
+    fprintf(out, "jokers per run:   %.2f\n", (double)stats->jokers_bought / runs);
+
+    fprintf(out, "\nante  cleared     of runs   of previous ante\n");
+    for (int ante = STARTING_ANTE; ante <= MAX_ANTE; ante++)
+    {
+        uint64_t reached = ante == STARTING_ANTE ? stats->runs : stats->antes_cleared[ante - 1];
+        fprintf(
+            out,
+            "%4d  %10llu  %7.3f%%  %7.3f%%\n",
+            ante,
+            (unsigned long long)stats->antes_cleared[ante],
+            100.0 * stats->antes_cleared[ante] / runs,
+            reached > 0 ? 100.0 * stats->antes_cleared[ante] / reached : 0.0
+        );
+    }
+
+    fprintf(out, "\nhand score distribution:\n");
+    s_print_histogram(stats->hand_score_buckets, hands, out);
+
+    fprintf(out, "\nbest hand per run distribution:\n");
+    s_print_histogram(stats->best_hand_buckets, runs, out);
+
+    const PoolStats* pool_stats[SIM_MAX_POOLS];
+    int num_pools = pool_get_stats(pool_stats, SIM_MAX_POOLS);
+
+    fprintf(out, "\npool              max used  capacity  failed gets\n");
+    for (int i = 0; i < num_pools; i++)
+    {
+        fprintf(
+            out,
+            "%-16s  %8u  %8u  %11llu\n",
+            pool_stats[i]->name,
+            stats->pool_high_water_marks[i],
+            pool_stats[i]->capacity,
+            (unsigned long long)stats->pool_failed_gets[i]
+        );
+    }
+}
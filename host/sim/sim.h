@@ -0,0 +1,186 @@
+/**
+ * @file sim.h
+ *
+ * @brief Headless full-run simulator for the host build
+ *
+ * Run Simulator
+ * =============
+ *
+ *  - @ref sim_run() plays a complete run without the UI: blinds of every ante are played with
+ *    hands and discards until the blind requirement is met or the hands run out, followed by a
+ *    shop visit after each cleared blind.
+ *
+ *  - Hands are scored with the same @ref score_hand() and Joker effects as the game, owned Jokers
+ *    go through @ref add_joker() so Joker modifiers (Four Fingers, Shortcut...) apply.
+ *
+ *  - Decisions (which cards to select, play or discard, which Jokers to buy) are made by a
+ *    @ref SimPolicy.
+ *
+ *  - The game logic keeps its state in globals so runs cannot share a process, the simulator
+ *    binary (sim_main.c) spreads them over one worker process per core instead of threads and
+ *    merges the @ref SimStats of every worker.
+ */
+#ifndef SIM_H
+#define SIM_H
+
+#include "blind.h"
+#include "card.h"
+#include "game.h"
+#include "joker.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <tonc.h>
+
+/**
+ * @def SIM_SCORE_BUCKETS
+ * @brief Number of power-of-two buckets in the score histograms, bucket 0 is a score of 0 and
+ * bucket n holds scores in [2^(n-1), 2^n)
+ */
+#define SIM_SCORE_BUCKETS 33
+// At least the number of POOL_ENTRYs in def_balatro_mempool.h
+#define SIM_MAX_POOLS 16
+
+/**
+ * @brief What to do with the selected cards
+ */
+enum SimAction
+{
+    SIM_ACTION_PLAY,
+    SIM_ACTION_DISCARD,
+};
+
+/**
+ * @brief The state of a run as seen by a @ref SimPolicy
+ */
+typedef struct
+{
+    int ante;
+    enum BlindType blind;
+
+    /**
+     * @brief Score so far in the current blind and the score required to beat it
+     */
+    u32 score;
+    u32 requirement;
+
+    int hands;
+    int discards;
+    int money;
+
+    CardObject** hand;
+    int hand_size;
+    int deck_size;
+
+    /**
+     * @brief The owned `JokerObject*`
+     */
+    Vector* jokers;
+} SimRunState;
+
+/**
+ * @brief Decision callbacks driving a simulated run
+ */
+typedef struct
+{
+    const char* name;
+
+    /**
+     * @brief Choose the cards to play or discard.
+     *
+     * Called with at least one hand remaining. Selecting no cards or more than
+     * @ref MAX_SELECTION_SIZE counts as a played high card of the first card, discarding with no
+     * discards remaining plays the selection instead.
+     *
+     * @param state the current run state
+     * @param selection output, `selection[i]` selects `state->hand[i]`, all false on entry
+     *
+     * @return whether to play or discard the selection
+     */
+    enum SimAction (*choose_action)(const SimRunState* state, bool* selection);
+
+    /**
+     * @brief Decide whether to buy a Joker offered in the shop
+     *
+     * Only called when the Joker is affordable and there is room for it.
+     *
+     * @param state the current run state
+     * @param joker the offered Joker, its price is `joker->value`
+     *
+     * @return true to buy the Joker
+     */
+    bool (*buy_joker)(const SimRunState* state, const Joker* joker);
+} SimPolicy;
+
+/**
+ * @brief Aggregated results of simulated runs, mergeable with @ref sim_stats_merge()
+ */
+typedef struct
+{
+    uint64_t runs;
+    uint64_t wins;
+
+    /**
+     * @brief Runs that beat the boss blind of each ante, indexed by ante
+     */
+    uint64_t antes_cleared[MAX_ANTE + 1];
+
+    uint64_t hands_played;
+    uint64_t discards_used;
+    uint64_t jokers_bought;
+
+    /**
+     * @brief Score of every played hand
+     */
+    uint64_t hand_score_buckets[SIM_SCORE_BUCKETS];
+
+    /**
+     * @brief Best hand score of every run
+     */
+    uint64_t best_hand_buckets[SIM_SCORE_BUCKETS];
+
+    /**
+     * @brief Highest number of objects in use of each pool in any run, in pool_get_stats() order
+     */
+    uint32_t pool_high_water_marks[SIM_MAX_POOLS];
+
+    /**
+     * @brief Gets that failed because the pool was full, in pool_get_stats() order
+     */
+    uint64_t pool_failed_gets[SIM_MAX_POOLS];
+} SimStats;
+
+/**
+ * @brief Initialize the game subsystems the simulator depends on, once per process
+ */
+void sim_init(void);
+
+/**
+ * @brief Simulate a complete run and add its results to stats
+ *
+ * @param policy the decision callbacks
+ * @param seed seed of the run, the same seed and policy always play the same run
+ * @param stats the stats to add the run to
+ */
+void sim_run(const SimPolicy* policy, u32 seed, SimStats* stats);
+
+void sim_stats_merge(SimStats* dst, const SimStats* src);
+
+/**
+ * @brief Print the win rate per ante, the score distributions and the pool usage
+ */
+void sim_stats_print(const SimStats* stats, FILE* out);
+
+/**
+ * @brief Look up a built-in policy by name
+ *
+ * @return the policy, or NULL if there is none with that name
+ */
+const SimPolicy* sim_get_policy(const char* name);
+
+/**
+ * @brief Print the names of the built-in policies
+ */
+void sim_print_policies(FILE* out);
+
+#endif // SIM_H
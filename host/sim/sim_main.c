@@ -0,0 +1,178 @@
+/**
+ * Monte Carlo run simulator for `make host-sim`.
+ *
+ * Usage: gbalatro_sim [-n runs] [-j workers] [-s seed] [-p policy]
+ *
+ * Runs are split over worker processes (one per core by default) since the game logic keeps its
+ * state in globals. Run i is always seeded from (seed, i) so the results do not depend on the
+ * number of workers.
+ */
+#include "sim.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define DEFAULT_NUM_RUNS 100000
+#define DEFAULT_SEED     1
+
+// splitmix64 finalizer, decorrelates the seeds of consecutive runs
+static u32 s_run_seed(u32 base_seed, uint64_t run_idx)
+{
+    uint64_t z = ((uint64_t)base_seed << 32) + run_idx + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return (u32)(z ^ (z >> 31));
+}
+
+static void s_worker(
+    const SimPolicy* policy,
+    u32 base_seed,
+    uint64_t num_runs,
+    int worker_idx,
+    int num_workers,
+    int out_fd
+)
+{
+    SimStats stats = {0};
+
+    sim_init();
+
+    for (uint64_t run_idx = worker_idx; run_idx < num_runs; run_idx += num_workers)
+    {
+        sim_run(policy, s_run_seed(base_seed, run_idx), &stats);
+    }
+
+    const char* buffer = (const char*)&stats;
+    size_t remaining = sizeof(stats);
+    while (remaining > 0)
+    {
+        ssize_t written = write(out_fd, buffer, remaining);
+        if (written <= 0)
+        {
+            exit(EXIT_FAILURE);
+        }
+        buffer += written;
+        remaining -= written;
+    }
+
+    close(out_fd);
+    exit(EXIT_SUCCESS);
+}
+
+static bool s_read_stats(int fd, SimStats* stats)
+{
+    char* buffer = (char*)stats;
+    size_t remaining = sizeof(*stats);
+    while (remaining > 0)
+    {
+        ssize_t num_read = read(fd, buffer, remaining);
+        if (num_read <= 0)
+        {
+            return false;
+        }
+        buffer += num_read;
+        remaining -= num_read;
+    }
+
+    return true;
+}
+
+static void s_usage(const char* name)
+{
+    fprintf(stderr, "usage: %s [-n runs] [-j workers] [-s seed] [-p policy]\npolicies:\n", name);
+    sim_print_policies(stderr);
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t num_runs = DEFAULT_NUM_RUNS;
+    int num_workers = sysconf(_SC_NPROCESSORS_ONLN);
+    u32 seed = DEFAULT_SEED;
+    const SimPolicy* policy = sim_get_policy("greedy");
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:j:s:p:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                num_runs = strtoull(optarg, NULL, 0);
+                break;
+            case 'j':
+                num_workers = atoi(optarg);
+                break;
+            case 's':
+                seed = strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                policy = sim_get_policy(optarg);
+                if (policy == NULL)
+                {
+                    s_usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            default:
+                s_usage(argv[0]);
+                return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    num_workers = max(1, num_workers);
+
+    int fds[num_workers];
+    pid_t pids[num_workers];
+
+    for (int i = 0; i < num_workers; i++)
+    {
+        int pipe_fds[2];
+        if (pipe(pipe_fds) != 0)
+        {
+            perror("pipe");
+            return EXIT_FAILURE;
+        }
+
+        pids[i] = fork();
+        if (pids[i] < 0)
+        {
+            perror("fork");
+            return EXIT_FAILURE;
+        }
+        else if (pids[i] == 0)
+        {
+            close(pipe_fds[0]);
+            s_worker(policy, seed, num_runs, i, num_workers, pipe_fds[1]);
+        }
+
+        close(pipe_fds[1]);
+        fds[i] = pipe_fds[0];
+    }
+
+    SimStats total = {0};
+    bool failed = false;
+
+    for (int i = 0; i < num_workers; i++)
+    {
+        SimStats stats;
+        if (s_read_stats(fds[i], &stats))
+        {
+            sim_stats_merge(&total, &stats);
+        }
+        else
+        {
+            fprintf(stderr, "worker %d failed\n", i);
+            failed = true;
+        }
+
+        close(fds[i]);
+        waitpid(pids[i], NULL, 0);
+    }
+
+    printf("policy:           %s\n", policy->name);
+    printf("workers:          %d\n", num_workers);
+    sim_stats_print(&total, stdout);
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
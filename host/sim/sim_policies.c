@@ -0,0 +1,153 @@
+#include "hand_analysis.h"
+#include "scoring.h"
+#include "sim.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define RANDOM_DISCARD_CHANCE 30 // Percent
+#define RANDOM_BUY_CHANCE     50 // Percent
+
+// The greedy policy discards when its best hand is weaker than this
+#define GREEDY_DISCARD_BELOW_HAND PAIR
+
+// Random policy: select 1 to 5 random cards, sometimes discard them, buy half of the Jokers
+static enum SimAction s_random_choose_action(const SimRunState* state, bool* selection)
+{
+    int num_to_select = 1 + rand() % min(MAX_SELECTION_SIZE, state->hand_size);
+
+    for (int num_selected = 0; num_selected < num_to_select;)
+    {
+        int idx = rand() % state->hand_size;
+        if (!selection[idx])
+        {
+            selection[idx] = true;
+            num_selected++;
+        }
+    }
+
+    if (state->discards > 0 && rand() % 100 < RANDOM_DISCARD_CHANCE)
+    {
+        return SIM_ACTION_DISCARD;
+    }
+
+    return SIM_ACTION_PLAY;
+}
+
+static bool s_random_buy_joker(const SimRunState* state, const Joker* joker)
+{
+    (void)state;
+    (void)joker;
+    return rand() % 100 < RANDOM_BUY_CHANCE;
+}
+
+// Greedy policy: play the subset with the highest base score (hand base values plus card chips),
+// discard the cards outside of it when it is weaker than a pair, buy every Joker possible
+static u32 s_estimate_score(const SimRunState* state, u32 subset, enum HandType* hand_type)
+{
+    u8 ranks[NUM_RANKS] = {0};
+    u8 suits[NUM_SUITS] = {0};
+    u32 card_chips = 0;
+
+    for (int i = 0; i < state->hand_size; i++)
+    {
+        if (subset & (1 << i))
+        {
+            Card* card = state->hand[i]->card;
+            ranks[card->rank]++;
+            suits[card->suit]++;
+            card_chips += card_get_value(card);
+        }
+    }
+
+    *hand_type = hand_get_type_from_distribution(ranks, suits);
+    const HandValues* base = score_get_hand_base_values(*hand_type);
+
+    return (base->chips + card_chips) * base->mult;
+}
+
+static enum SimAction s_greedy_choose_action(const SimRunState* state, bool* selection)
+{
+    u32 best_subset = 1;
+    u32 best_score = 0;
+    enum HandType best_hand_type = HIGH_CARD;
+
+    for (u32 subset = 1; subset < (1u << state->hand_size); subset++)
+    {
+        if (__builtin_popcount(subset) > MAX_SELECTION_SIZE)
+        {
+            continue;
+        }
+
+        enum HandType hand_type;
+        u32 score = s_estimate_score(state, subset, &hand_type);
+        if (score > best_score)
+        {
+            best_score = score;
+            best_subset = subset;
+            best_hand_type = hand_type;
+        }
+    }
+
+    if (best_hand_type < GREEDY_DISCARD_BELOW_HAND && state->discards > 0)
+    {
+        // Discard the lowest cards outside of the best hand
+        int num_selected = 0;
+        for (int rank = TWO; rank <= ACE && num_selected < MAX_SELECTION_SIZE; rank++)
+        {
+            for (int i = 0; i < state->hand_size && num_selected < MAX_SELECTION_SIZE; i++)
+            {
+                if (!(best_subset & (1 << i)) && state->hand[i]->card->rank == rank)
+                {
+                    selection[i] = true;
+                    num_selected++;
+                }
+            }
+        }
+
+        if (num_selected > 0)
+        {
+            return SIM_ACTION_DISCARD;
+        }
+    }
+
+    for (int i = 0; i < state->hand_size; i++)
+    {
+        selection[i] = best_subset & (1 << i);
+    }
+
+    return SIM_ACTION_PLAY;
+}
+
+static bool s_greedy_buy_joker(const SimRunState* state, const Joker* joker)
+{
+    (void)state;
+    (void)joker;
+    return true;
+}
+
+static const SimPolicy _policies[] = {
+    {"random", s_random_choose_action, s_random_buy_joker},
+    {"greedy", s_greedy_choose_action, s_greedy_buy_joker},
+};
+
+const SimPolicy* sim_get_policy(const char* name)
+{
+    for (size_t i = 0; i < sizeof(_policies) / sizeof(_policies[0]); i++)
+    {
+        if (strcmp(_policies[i].name, name) == 0)
+        {
+            return &_policies[i];
+        }
+    }
+
+    return NULL;
+}
+
+void sim_print_policies(FILE* out)
+{
+    for (size_t i = 0; i < sizeof(_policies) / sizeof(_policies[0]); i++)
+    {
+        fprintf(out, "  %s\n", _policies[i].name);
+    }
+}
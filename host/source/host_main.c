@@ -0,0 +1,168 @@
+/**
+ * Host entry point for `make host`.
+ *
+ * Runs the same init and per-frame update as main.c against the tonc/maxmod shim, with a
+ * pseudo-random key sequence standing in for a player. Nothing is rendered; the frame loop
+ * exists to profile the game logic with perf/callgrind.
+ *
+ * Usage: gbalatro_host [frames] [seed]
+ */
+#include "affine_background.h"
+#include "blind.h"
+#include "card.h"
+#include "game.h"
+#include "joker.h"
+#include "pool.h"
+#include "sprite.h"
+#include "tile_cache.h"
+
+#include <maxmod.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <tonc.h>
+
+#define DEFAULT_NUM_FRAMES 60 * 60 * 10 // 10 minutes of game time
+#define DEFAULT_SEED       1
+
+// One key press every KEY_PRESS_INTERVAL frames on average
+#define KEY_PRESS_INTERVAL 8
+
+// At least the number of POOL_ENTRYs in def_balatro_mempool.h
+#define MAX_POOLS 16
+
+// Weighted towards confirming and moving around, the way a player navigates the menus
+static const u16 INPUT_KEYS[] = {
+    KEY_A,
+    KEY_A,
+    KEY_A,
+    KEY_B,
+    KEY_LEFT,
+    KEY_RIGHT,
+    KEY_UP,
+    KEY_DOWN,
+    KEY_L,
+    KEY_R,
+    KEY_SELECT,
+    KEY_START,
+};
+
+// Kept apart from rand() so the input doesn't shift the game's own random sequence
+static u32 _input_seed = DEFAULT_SEED;
+
+static u32 s_input_rand(void)
+{
+    _input_seed = _input_seed * 1103515245 + 12345;
+    return (_input_seed >> 16) & 0x7FFF;
+}
+
+static void s_input_next_frame(void)
+{
+    u16 keys = 0;
+
+    if (s_input_rand() % KEY_PRESS_INTERVAL == 0)
+    {
+        keys = INPUT_KEYS[s_input_rand() % (sizeof(INPUT_KEYS) / sizeof(INPUT_KEYS[0]))];
+    }
+
+    host_set_keys(keys);
+}
+
+static void s_vblank_isr(void)
+{
+    affine_background_vblank();
+    mmVBlank();
+}
+
+static void init(void)
+{
+    irq_init(NULL);
+    irq_add(II_VBLANK, s_vblank_isr);
+#if !AFFINE_BG_HBLANK_DMA
+    irq_add(II_HBLANK, affine_background_hblank);
+#endif
+
+    REG_DISPCNT = DCNT_MODE1 | DCNT_OBJ_1D | DCNT_BG0 | DCNT_BG1 | DCNT_BG2 | DCNT_OBJ;
+
+    mmInitDefault(NULL, 12);
+    affine_background_init();
+    sprite_init();
+    card_init();
+    blind_init();
+    joker_init();
+    game_init();
+    game_change_state(GAME_STATE_SPLASH_SCREEN);
+}
+
+// Misses are the uploads to VRAM, per second of GBA time at 60 frames per second
+static void s_print_tile_cache(const char* name, const TileCache* cache, long num_frames)
+{
+    const TileCacheStats* stats = &cache->stats;
+    double seconds = (num_frames > 0 ? num_frames : 1) / 60.0;
+
+    printf(
+        "%-16s hits %u uploads %u (%.2f/s) evictions %u failed %u\n",
+        name,
+        (unsigned)stats->hits,
+        (unsigned)stats->misses,
+        stats->misses / seconds,
+        (unsigned)stats->evictions,
+        (unsigned)stats->failures
+    );
+    printf(
+        "%-16s free slots %d/%d largest free run %d\n",
+        "",
+        tile_cache_get_num_free(cache),
+        cache->num_slots,
+        tile_cache_get_largest_free_run(cache)
+    );
+}
+
+int main(int argc, char** argv)
+{
+    long num_frames = argc > 1 ? strtol(argv[1], NULL, 0) : DEFAULT_NUM_FRAMES;
+    _input_seed = argc > 2 ? strtoul(argv[2], NULL, 0) : DEFAULT_SEED;
+
+    init();
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (long frame = 0; frame < num_frames; frame++)
+    {
+        VBlankIntrWait();
+        sprite_draw();
+        affine_background_commit();
+        mmFrame();
+        s_input_next_frame();
+        key_poll();
+        affine_background_update();
+        game_update();
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    printf("frames:        %ld\n", num_frames);
+    printf("elapsed:       %.3f s\n", elapsed);
+    printf("us per frame:  %.3f\n", elapsed * 1e6 / (num_frames > 0 ? num_frames : 1));
+    printf("sfx played:    %u\n", (unsigned)host_mm_effects_played);
+
+    const PoolStats* pool_stats[MAX_POOLS];
+    int num_pools = pool_get_stats(pool_stats, MAX_POOLS);
+    char line[64];
+
+    printf("pools:\n");
+    for (int i = 0; i < num_pools; i++)
+    {
+        pool_stats_to_str(pool_stats[i], line, sizeof(line));
+        printf("  %s\n", line);
+    }
+
+    s_print_tile_cache("card tiles:", card_get_tile_cache(), num_frames);
+    s_print_tile_cache("joker tiles:", joker_get_tile_cache(), num_frames);
+    s_print_tile_cache("joker palettes:", joker_get_pb_cache(), num_frames);
+
+    return 0;
+}
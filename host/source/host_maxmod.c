@@ -0,0 +1,34 @@
+#include <maxmod.h>
+
+mm_word host_mm_effects_played = 0;
+
+void mmInitDefault(mm_addr soundbank, mm_word number_of_channels)
+{
+    (void)soundbank;
+    (void)number_of_channels;
+}
+
+void mmVBlank(void)
+{
+}
+
+void mmFrame(void)
+{
+}
+
+void mmStart(mm_word module_ID, mm_pmode mode)
+{
+    (void)module_ID;
+    (void)mode;
+}
+
+void mmStop(void)
+{
+}
+
+mm_sfxhand mmEffectEx(mm_sound_effect* sound)
+{
+    (void)sound;
+    host_mm_effects_played++;
+    return 0;
+}
@@ -0,0 +1,335 @@
+#include <tonc.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// clang-format off
+u16 host_pal_mem[PAL_SIZE / sizeof(u16)]   __attribute__((aligned(4)));
+u16 host_vram[VRAM_SIZE / sizeof(u16)]     __attribute__((aligned(4)));
+u16 host_oam_mem[OAM_SIZE / sizeof(u16)]   __attribute__((aligned(4)));
+u16 host_io_mem[IO_SIZE / sizeof(u16)]     __attribute__((aligned(4)));
+// clang-format on
+
+DMA_REC host_dma[4];
+
+u16 __key_curr = 0;
+u16 __key_prev = 0;
+
+const BG_AFFINE bg_aff_default = {256, 0, 0, 256, 0, 0};
+
+const u8 oam_sizes[3][4][2] = {
+    {{8, 8},  {16, 16}, {32, 32}, {64, 64}},
+    {{16, 8}, {32, 8},  {32, 16}, {64, 32}},
+    {{8, 16}, {8, 32},  {16, 32}, {32, 64}},
+};
+
+// Same layout as libtonc's sin_lut: 512 entries for a full circle in .12 fixed point
+s16 host_sin_lut[SIN_LUT_SIZE];
+
+static fnptr _isr_table[II_MAX] = {NULL};
+static int _qran_seed = 42;
+
+__attribute__((constructor)) static void s_host_tonc_init(void)
+{
+    for (int i = 0; i < SIN_LUT_SIZE; i++)
+    {
+        host_sin_lut[i] = (s16)lround(sin(i * 2 * M_PI / SIN_LUT_SIZE) * 4096.0);
+    }
+
+    // The key register is active-low, no key is held at startup
+    REG_KEYINPUT = KEY_MASK;
+}
+
+void host_set_keys(u16 keys)
+{
+    REG_KEYINPUT = ~keys & KEY_MASK;
+}
+
+void key_poll(void)
+{
+    __key_prev = __key_curr;
+    __key_curr = ~REG_KEYINPUT & KEY_MASK;
+}
+
+void clr_rgbscale(COLOR* dst, const COLOR* src, uint nclrs, COLOR clr)
+{
+    u32 r = clr & 31, g = (clr >> 5) & 31, b = (clr >> 10) & 31;
+
+    for (uint i = 0; i < nclrs; i++)
+    {
+        COLOR c = src[i];
+        dst[i] = RGB15(
+            ((c & 31) * r) >> 5,
+            (((c >> 5) & 31) * g) >> 5,
+            (((c >> 10) & 31) * b) >> 5
+        );
+    }
+}
+
+void clr_fade(const COLOR* srca, COLOR clr, COLOR* dst, uint nclrs, u32 alpha)
+{
+    int rb = clr & 31, gb = (clr >> 5) & 31, bb = (clr >> 10) & 31;
+
+    for (uint i = 0; i < nclrs; i++)
+    {
+        int ra = srca[i] & 31, ga = (srca[i] >> 5) & 31, ba = (srca[i] >> 10) & 31;
+        dst[i] = RGB15(
+            ra + (((rb - ra) * (int)alpha) >> 5),
+            ga + (((gb - ga) * (int)alpha) >> 5),
+            ba + (((bb - ba) * (int)alpha) >> 5)
+        );
+    }
+}
+
+void sqran(int seed)
+{
+    _qran_seed = seed;
+}
+
+int qran(void)
+{
+    _qran_seed = 1664525 * _qran_seed + 1013904223;
+    return (_qran_seed >> 16) & 0x7FFF;
+}
+
+void memcpy16(void* dst, const void* src, uint hwcount)
+{
+    memmove(dst, src, hwcount * sizeof(u16));
+}
+
+void memcpy32(void* dst, const void* src, uint wcount)
+{
+    memmove(dst, src, wcount * sizeof(u32));
+}
+
+void memset16(void* dst, u16 hw, uint hwcount)
+{
+    u16* d = dst;
+    while (hwcount--)
+    {
+        *d++ = hw;
+    }
+}
+
+void memset32(void* dst, u32 wd, uint wcount)
+{
+    u32* d = dst;
+    while (wcount--)
+    {
+        *d++ = wd;
+    }
+}
+
+void* tonccpy(void* dst, const void* src, uint size)
+{
+    return memmove(dst, src, size);
+}
+
+void* toncset(void* dst, u8 src, uint count)
+{
+    return memset(dst, src, count);
+}
+
+void dma3_cpy(void* dst, const void* src, uint size)
+{
+    memmove(dst, src, size);
+}
+
+void irq_init(fnptr isr)
+{
+    (void)isr;
+    for (int i = 0; i < II_MAX; i++)
+    {
+        _isr_table[i] = NULL;
+    }
+}
+
+fnptr irq_add(enum eIrqIndex irq_id, fnptr isr)
+{
+    fnptr old_isr = _isr_table[irq_id];
+    _isr_table[irq_id] = isr;
+    REG_IE |= BIT(irq_id);
+    return old_isr;
+}
+
+fnptr irq_set(enum eIrqIndex irq_id, fnptr isr, u32 opts)
+{
+    (void)opts;
+    return irq_add(irq_id, isr);
+}
+
+// Only what the game uses: an incrementing source and a fixed or reloaded destination
+static void s_run_hblank_dma(void)
+{
+    for (int ch = 0; ch < 4; ch++)
+    {
+        volatile DMA_REC* dma = &REG_DMA[ch];
+        u32 timing = dma->cnt & (DMA_AT_VBLANK | DMA_AT_HBLANK);
+        if (!(dma->cnt & DMA_ENABLE) || timing != DMA_AT_HBLANK)
+            continue;
+
+        uint size = (dma->cnt & 0xFFFF) * ((dma->cnt & DMA_32) ? 4 : 2);
+        memcpy(dma->dst, dma->src, size);
+        dma->src = (const u8*)dma->src + size;
+
+        if (!(dma->cnt & DMA_REPEAT))
+        {
+            dma->cnt &= ~DMA_ENABLE;
+        }
+    }
+}
+
+void VBlankIntrWait(void)
+{
+    // Run the HBlank handlers and DMAs for the visible lines, then the VBlank handler
+    for (int line = 0; line < SCREEN_HEIGHT; line++)
+    {
+        REG_VCOUNT = line;
+        if (_isr_table[II_HBLANK] != NULL && (REG_IE & IRQ_HBLANK))
+        {
+            _isr_table[II_HBLANK]();
+        }
+        s_run_hblank_dma();
+    }
+
+    REG_VCOUNT = SCREEN_HEIGHT;
+    if (_isr_table[II_VBLANK] != NULL && (REG_IE & IRQ_VBLANK))
+    {
+        _isr_table[II_VBLANK]();
+    }
+}
+
+void oam_init(OBJ_ATTR* obj, uint count)
+{
+    u32* dst = (u32*)obj;
+    for (uint i = 0; i < count; i++)
+    {
+        *dst++ = ATTR0_HIDE;
+        *dst++ = 0;
+    }
+}
+
+void oam_copy(OBJ_ATTR* dst, const OBJ_ATTR* src, uint count)
+{
+    memmove(dst, src, count * sizeof(OBJ_ATTR));
+}
+
+void obj_copy(OBJ_ATTR* dst, const OBJ_ATTR* src, uint count)
+{
+    for (uint i = 0; i < count; i++)
+    {
+        dst[i].attr0 = src[i].attr0;
+        dst[i].attr1 = src[i].attr1;
+        dst[i].attr2 = src[i].attr2;
+    }
+}
+
+void obj_aff_copy(OBJ_AFFINE* dst, const OBJ_AFFINE* src, uint count)
+{
+    for (uint i = 0; i < count; i++)
+    {
+        dst[i].pa = src[i].pa;
+        dst[i].pb = src[i].pb;
+        dst[i].pc = src[i].pc;
+        dst[i].pd = src[i].pd;
+    }
+}
+
+void obj_aff_rotscale(OBJ_AFFINE* oaff, FIXED sx, FIXED sy, u16 alpha)
+{
+    int ss = lu_sin(alpha), cc = lu_cos(alpha);
+
+    oaff->pa = cc * sx >> 12;
+    oaff->pb = -ss * sx >> 12;
+    oaff->pc = ss * sy >> 12;
+    oaff->pd = cc * sy >> 12;
+}
+
+void bg_rotscale_ex(BG_AFFINE* bgaff, const AFF_SRC_EX* asx)
+{
+    int sx = asx->sx, sy = asx->sy;
+    int sina = lu_sin(asx->alpha), cosa = lu_cos(asx->alpha);
+
+    FIXED pa, pb, pc, pd;
+    pa = sx * cosa >> 12;
+    pb = -sx * sina >> 12;
+    pc = sy * sina >> 12;
+    pd = sy * cosa >> 12;
+
+    bgaff->pa = pa;
+    bgaff->pb = pb;
+    bgaff->pc = pc;
+    bgaff->pd = pd;
+
+    bgaff->dx = asx->tex_x - (pa * asx->scr_x + pb * asx->scr_y);
+    bgaff->dy = asx->tex_y - (pc * asx->scr_x + pd * asx->scr_y);
+}
+
+// The text engine only keeps track of the cursor, nothing is drawn on the host
+static POINT _tte_cursor = {0, 0};
+
+void tte_init_se(
+    int bgnr,
+    u16 bgcnt,
+    SCR_ENTRY se0,
+    u32 clrs,
+    u32 bupofs,
+    const TFont* font,
+    fnptr proc
+)
+{
+    (void)bgnr;
+    (void)bgcnt;
+    (void)se0;
+    (void)clrs;
+    (void)bupofs;
+    (void)font;
+    (void)proc;
+}
+
+void tte_init_con(void)
+{
+}
+
+void tte_set_pos(int x, int y)
+{
+    _tte_cursor.x = x;
+    _tte_cursor.y = y;
+}
+
+void tte_set_special(u16 special)
+{
+    (void)special;
+}
+
+int tte_write(const char* text)
+{
+    int len = strlen(text);
+    _tte_cursor.x += len * 8;
+    return len;
+}
+
+int tte_printf(const char* format, ...)
+{
+    char buffer[256];
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    return tte_write(buffer);
+}
+
+void tte_erase_rect(int left, int top, int right, int bottom)
+{
+    (void)left;
+    (void)top;
+    (void)right;
+    (void)bottom;
+}
+
+void tte_erase_screen(void)
+{
+}
@@ -28,6 +28,23 @@
  */
 #define AFFINE_BG_PB (PAL_ROW_LEN * 10)
 
+/**
+ * @def AFFINE_BG_HBLANK_DMA
+ * @brief Stream the per-scanline matrices of the main menu background with an HBLANK DMA
+ *
+ * The DMA copies the matrix of the next scanline during each HBLANK without the CPU. Build with
+ * `-DAFFINE_BG_HBLANK_DMA=0` to use the HBLANK interrupt @ref affine_background_hblank() instead.
+ */
+#ifndef AFFINE_BG_HBLANK_DMA
+#define AFFINE_BG_HBLANK_DMA 1
+#endif
+
+/**
+ * @def AFFINE_BG_DMA_CHANNEL
+ * @brief The DMA channel of @ref AFFINE_BG_HBLANK_DMA, channel 0 has the highest priority
+ */
+#define AFFINE_BG_DMA_CHANNEL 0
+
 /**
  * @brief An ID to specify background rendering types.
  */
@@ -56,11 +73,31 @@ void affine_background_init();
 
 /**
  * @brief Interrupt routine to update display on HBLANK
+ *
+ * Only used when @ref AFFINE_BG_HBLANK_DMA is 0.
  */
 IWRAM_CODE void affine_background_hblank();
 
+/**
+ * @brief Restart the displayed matrices from the first scanline, to be called from the VBLANK
+ * interrupt
+ *
+ * Sets the matrix of the first scanline and restarts the HBLANK DMA or interrupt for the others,
+ * so a frame that misses @ref affine_background_commit() shows the last committed matrices again.
+ */
+IWRAM_CODE void affine_background_vblank();
+
+/**
+ * @brief Display the matrices computed by the last @ref affine_background_update(), in VBLANK
+ *
+ * Swaps them in and restarts them like @ref affine_background_vblank().
+ */
+IWRAM_CODE void affine_background_commit();
+
 /**
  * @brief Per-frame update of the affine background
+ *
+ * Computes the matrices of the next frame, they are displayed by @ref affine_background_commit().
  */
 IWRAM_CODE void affine_background_update();
 
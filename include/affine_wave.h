@@ -0,0 +1,74 @@
+/**
+ * @file affine_wave.h
+ *
+ * @brief Per-scanline matrices of the wavy main menu background
+ *
+ * Every scanline of the main menu background is rotated by an angle that follows a sine wave
+ * scrolling down the screen. The matrices are generated straight from tonc's `sin_lut`, the wave of
+ * a scanline being the entry at `(2 * vcount + phase) mod 512` where the phase only changes with
+ * the frame, instead of going through `lu_sin()` and `bg_rotscale_ex()` for every scanline.
+ */
+#ifndef AFFINE_WAVE_H
+#define AFFINE_WAVE_H
+
+#include <tonc.h>
+
+/**
+ * @def AFFINE_WAVE_ARR_LEN
+ * @brief Number of matrices filled by @ref affine_wave_prep_bgaff_arr()
+ *
+ * One per scanline, plus the first one again for the HBLANK after the last scanline.
+ */
+#define AFFINE_WAVE_ARR_LEN (SCREEN_HEIGHT + 1)
+
+/**
+ * @def AFFINE_WAVE_PERIOD
+ * @brief Number of frames after which the wave repeats
+ *
+ * The phase moves by one `sin_lut` entry every 8 frames and the lookup table has 512 entries.
+ */
+#define AFFINE_WAVE_PERIOD (8 * 512)
+
+/**
+ * @def AFFINE_WAVE_SPEED_DIVISOR
+ * @brief Divides the frame count into the .16 angle the wave moves by
+ */
+#define AFFINE_WAVE_SPEED_DIVISOR 16
+
+/**
+ * @def AFFINE_WAVE_TEX_POS
+ * @brief Texture position, in .8 fixed point, around which the scanlines are rotated
+ */
+#define AFFINE_WAVE_TEX_POS (1000 * 1000)
+
+/**
+ * @brief Get the .16 angle the wave has moved by at a frame of the animation
+ *
+ * @param timer the frame of the animation
+ */
+INLINE s32 affine_wave_get_time_angle(uint timer)
+{
+    const s32 timer_s32 = timer << 8;
+    return timer_s32 / AFFINE_WAVE_SPEED_DIVISOR;
+}
+
+/**
+ * @brief Get the wave of a scanline, the horizontal texture offset in .8 fixed point
+ *
+ * @param timer the frame of the animation
+ * @param vcount the scanline
+ */
+INLINE s32 affine_wave_get_offset(uint timer, int vcount)
+{
+    return sin_lut[(2 * vcount + (affine_wave_get_time_angle(timer) >> 7)) & 0x1FF];
+}
+
+/**
+ * @brief Compute the matrix of every scanline for a frame of the animation
+ *
+ * @param bgaff_arr output, array of @ref AFFINE_WAVE_ARR_LEN matrices
+ * @param timer the frame of the animation
+ */
+IWRAM_CODE void affine_wave_prep_bgaff_arr(BG_AFFINE* bgaff_arr, uint timer);
+
+#endif // AFFINE_WAVE_H
@@ -19,11 +19,10 @@
 
 /**
  * @def BITSET_ARRAY_SIZE
- * @brief Number of words in a bitset
+ * @brief Maximum number of words in a bitset
  *
- * Number of words in every bitset. This represents the maximum number and each
- * bitset will always use this number of words, though it's capacity can be any length
- * from `1` to `BITSET_BITS_PER_WORD * BITSET_ARRAY_SIZE`
+ * Bitsets only use the words their capacity needs, see @ref BITSET_WORDS_FOR_CAPACITY, so their
+ * capacity can be any length from `1` to `BITSET_BITS_PER_WORD * BITSET_ARRAY_SIZE`
  */
 #define BITSET_ARRAY_SIZE 8
 
@@ -33,6 +32,13 @@
  */
 #define BITSET_MAX_BITS (BITSET_BITS_PER_WORD * BITSET_ARRAY_SIZE)
 
+/**
+ * @def BITSET_WORDS_FOR_CAPACITY
+ * @brief Number of words needed to hold `capacity` flags
+ */
+#define BITSET_WORDS_FOR_CAPACITY(capacity) \
+    (((capacity) + BITSET_BITS_PER_WORD - 1) / BITSET_BITS_PER_WORD)
+
 /**
  * @brief A bitset spread across multiple `uint32_t` words
  */
@@ -62,12 +68,11 @@ typedef struct Bitset
 /**
  * @brief An iterator into a @ref Bitset
  *
- * This iterator will parse and find the next index to a '1' bit as efficiently as possible.
+ * This iterator finds the next index to a '1' bit (or a '0' bit, see
+ * @ref bitset_itr_create_unset()) a word at a time: words without any bit left are skipped and
+ * the next bit in a word is found with `__builtin_ctz` (`__builtin_clz` in reverse).
  *
- * There is no implementation of the following (yet):
- *  - Reverse iteration
- *  - Bit-by-bit iteration
- *  - Iterating on offsets to '0' bits
+ * The bitset must not be modified while iterating.
  */
 typedef struct
 {
@@ -82,14 +87,19 @@ typedef struct
     int word;
 
     /**
-     * @brief Current bit the iterator is on
+     * @brief Bits of the current word that have not been returned yet
      */
-    int bit;
+    uint32_t bits;
 
     /**
-     * @brief Number of bits that have been iterated through in total
+     * @brief XOR-ed with each word, `0` to iterate on '1' bits, `~0` to iterate on '0' bits
      */
-    int itr;
+    uint32_t invert;
+
+    /**
+     * @brief Iterate from the last index to the first
+     */
+    bool reverse;
 } BitsetItr;
 
 /**
@@ -148,17 +158,48 @@ int bitset_num_set_bits(Bitset* bitset);
 /**
  * @brief Find the index of the nth set bit
  *
- * Find the index of the nth flag set to `1`. This function is useful to get one value quickly,
- * but does not operate iteratively well. Use a @BitsetItr for iterative access to a bitset.
+ * Find the index of the nth flag set to `1`. The word holding it is found with a running
+ * popcount of the words, only that word is then searched for the bit.
+ * This function is useful to get one value quickly, but does not operate iteratively well.
+ * Use a @ref BitsetItr for iterative access to a bitset.
  *
  * @param bitset A @ref Bitset to operate on
+ * @param n which set flag to find, `0` is the first one
  *
- * @return The index of the nth flag set to `1` in the bitset
+ * @return The index of the nth flag set to `1` in the bitset, UNDEFINED if there are not that many
  */
 int bitset_find_idx_of_nth_set(const Bitset* bitset, int n);
 
 /**
- * @brief Declare a @ref BitsetItr
+ * @brief Set every flag of `dst` that is set in `src` (`dst |= src`)
+ *
+ * Both bitsets should have the same capacity, only the words they have in common are operated on.
+ *
+ * @param dst A @ref Bitset to operate on
+ * @param src the flags to set
+ */
+void bitset_or(Bitset* dst, const Bitset* src);
+
+/**
+ * @brief Clear every flag of `dst` that is not set in `src` (`dst &= src`)
+ *
+ * Words of `dst` past the end of `src` are cleared.
+ *
+ * @param dst A @ref Bitset to operate on
+ * @param src the flags to keep
+ */
+void bitset_and(Bitset* dst, const Bitset* src);
+
+/**
+ * @brief Clear every flag of `dst` that is set in `src` (`dst &= ~src`)
+ *
+ * @param dst A @ref Bitset to operate on
+ * @param src the flags to clear
+ */
+void bitset_andnot(Bitset* dst, const Bitset* src);
+
+/**
+ * @brief Declare a @ref BitsetItr over the set bits, from the first index to the last
  *
  * @param bitset A @ref Bitset to operate on
  *
@@ -167,11 +208,30 @@ int bitset_find_idx_of_nth_set(const Bitset* bitset, int n);
 BitsetItr bitset_itr_create(const Bitset* bitset);
 
 /**
- * @brief Get the index of the next set bit in the bitset from a @ref BitsetItr
+ * @brief Declare a @ref BitsetItr over the set bits, from the last index to the first
+ *
+ * @param bitset A @ref Bitset to operate on
+ *
+ * @return A newly constructed BitsetItr
+ */
+BitsetItr bitset_itr_create_reverse(const Bitset* bitset);
+
+/**
+ * @brief Declare a @ref BitsetItr over the unset bits below the capacity, from the first index to
+ * the last
+ *
+ * @param bitset A @ref Bitset to operate on
+ *
+ * @return A newly constructed BitsetItr
+ */
+BitsetItr bitset_itr_create_unset(const Bitset* bitset);
+
+/**
+ * @brief Get the index of the next bit in the bitset from a @ref BitsetItr
  *
  * @param itr A @ref BitsetItr to operate on
  *
- * @return a positive number if successful, UNDEFINED otherwise (out-of-bounds)
+ * @return a positive number if successful, UNDEFINED once every bit has been iterated through
  */
 int bitset_itr_next(BitsetItr* itr);
 
@@ -179,7 +239,7 @@ int bitset_itr_next(BitsetItr* itr);
  * @def BITSET_DEFINE
  * @brief Make a standard bitset
  *
- * Make a bitset with a valid static array to store it's array of words.
+ * Make a bitset with a valid static array to store it's array of words, sized for its capacity.
  *
  * Use this to define bitsets in the code, specifically as a `static` scoped
  * variable. The passed `name` will be the same name as the bitset.
@@ -195,13 +255,13 @@ int bitset_itr_next(BitsetItr* itr);
  * @param name the name of the bitset
  * @param capacity the capacity of the bitset
  */
-#define BITSET_DEFINE(name, capacity)                  \
-    static uint32_t name##_w[BITSET_ARRAY_SIZE] = {0}; \
-    static Bitset name = {                             \
-        .w = name##_w,                                 \
-        .nbits = BITSET_BITS_PER_WORD,                 \
-        .nwords = BITSET_ARRAY_SIZE,                   \
-        .cap = capacity,                               \
+#define BITSET_DEFINE(name, capacity)                                    \
+    static uint32_t name##_w[BITSET_WORDS_FOR_CAPACITY(capacity)] = {0}; \
+    static Bitset name = {                                               \
+        .w = name##_w,                                                   \
+        .nbits = BITSET_BITS_PER_WORD,                                   \
+        .nwords = BITSET_WORDS_FOR_CAPACITY(capacity),                   \
+        .cap = capacity,                                                 \
     };
 
 #endif // BITSET_H
@@ -2,6 +2,7 @@
 #define CARD_H
 
 #include "sprite.h"
+#include "tile_cache.h"
 
 #include <maxmod.h>
 #include <tonc.h>
@@ -67,10 +68,14 @@ CardObject* card_object_new(Card* card);
 void card_object_destroy(CardObject** card_object);
 void card_object_update(CardObject* card_object); // Update the card object position and scale
 void card_object_set_sprite(CardObject* card_object, int layer);
+void card_object_destroy_sprite(CardObject* card_object);
 void card_object_shake(CardObject* card_object, mm_word sound_id);
 
 void card_object_set_selected(CardObject* card_object, bool selected);
 bool card_object_is_selected(CardObject* card_object);
 Sprite* card_object_get_sprite(CardObject* card_object);
 
+// The VRAM slots of the card tiles, for their stats
+const TileCache* card_get_tile_cache(void);
+
 #endif // CARD_H
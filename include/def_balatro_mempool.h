@@ -1,12 +1,11 @@
 #include "card.h"
 #include "joker.h"
-#include "list.h"
 #include "sprite.h"
 
-POOL_ENTRY(Sprite, MAX_SPRITES);
-POOL_ENTRY(SpriteObject, MAX_SPRITE_OBJECTS);
-POOL_ENTRY(Joker, MAX_ACTIVE_JOKERS);
-POOL_ENTRY(JokerObject, MAX_ACTIVE_JOKERS);
-POOL_ENTRY(Card, MAX_CARDS);
-POOL_ENTRY(CardObject, MAX_CARDS_ON_SCREEN);
-POOL_ENTRY(ListNode, MAX_LIST_NODES);
+// The Joker pools fit in one bitset word so the bitset backend is as fast as the free list there
+POOL_ENTRY(Sprite, MAX_SPRITES, POOL_FREE_LIST);
+POOL_ENTRY(SpriteObject, MAX_SPRITE_OBJECTS, POOL_FREE_LIST);
+POOL_ENTRY(Joker, MAX_ACTIVE_JOKERS, POOL_BITSET | POOL_HANDLES);
+POOL_ENTRY(JokerObject, MAX_ACTIVE_JOKERS, POOL_BITSET | POOL_HANDLES);
+POOL_ENTRY(Card, MAX_CARDS, POOL_FREE_LIST | POOL_HANDLES);
+POOL_ENTRY(CardObject, MAX_CARDS_ON_SCREEN, POOL_FREE_LIST | POOL_HANDLES);
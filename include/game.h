@@ -14,6 +14,13 @@
 #define MAX_INTEREST   5
 #define INTEREST_PER_5 1
 
+// Red deck defaults, a run starts with these
+#define STARTING_ANTE        1
+#define STARTING_MONEY       4
+#define DEFAULT_HAND_SIZE    8
+#define DEFAULT_MAX_HANDS    4
+#define DEFAULT_MAX_DISCARDS 4
+
 // Input bindings
 #define SELECT_CARD    KEY_A
 #define DESELECT_CARDS KEY_B
@@ -21,14 +28,16 @@
 #define SORT_HAND      KEY_R
 #define PAUSE_GAME     KEY_START // Not implemented
 #define SELL_KEY       KEY_L
+#define SKIP_SCORING   KEY_B // Skip the scoring animation of the played hand
 
-struct List;
-typedef struct List List;
+struct Vector;
+typedef struct Vector Vector;
 
 // Utility functions for other files
 typedef struct CardObject CardObject;
 typedef struct Card Card;
 typedef struct JokerObject JokerObject;
+typedef struct JokerEventIndex JokerEventIndex;
 
 enum BackgroundId
 {
@@ -113,11 +122,14 @@ int get_hand_top(void);
 int hand_get_size(void);
 CardObject** get_played_array(void);
 int get_played_top(void);
-int get_scored_card_index(void);
 bool is_joker_owned(int joker_id);
 bool card_is_face(Card* card);
-List* get_jokers_list(void);
-List* get_expired_jokers_list(void);
+Vector* get_jokers_list(void);
+const JokerEventIndex* get_jokers_event_index(void);
+Vector* get_expired_jokers_list(void);
+// Add/remove a Joker from the owned Jokers, keeping the Joker modifiers (Four Fingers...) in sync
+void add_joker(JokerObject* joker_object);
+void remove_owned_joker(int owned_joker_idx);
 
 int get_deck_top(void);
 int get_num_discards_remaining(void);
@@ -132,12 +144,19 @@ void display_mult();
 int get_money(void);
 void set_money(int new_money);
 void display_money();
-void set_retrigger(bool new_retrigger);
+// Interest paid at the end of a round for holding this much money
+int calculate_interest_reward(int money);
 
 int get_game_speed(void);
 void set_game_speed(int new_game_speed);
+// When set, played hands show their final score right away instead of animating every effect
+bool get_skip_scoring_animation(void);
+void set_skip_scoring_animation(bool skip);
 
 // joker specific functions
+#define STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS 4
+#define STRAIGHT_AND_FLUSH_SIZE_DEFAULT      5
+
 bool is_shortcut_joker_active(void);
 int get_straight_and_flush_size(void);
 
@@ -344,6 +344,28 @@ void memcpy16_tile8_with_palette_offset(u16* dst, const u16* src, uint hwcount,
  */
 void memcpy32_tile8_with_palette_offset(u32* dst, const u32* src, uint wcount, u8 palette_offset);
 
+/**
+ * @brief Copies 32 bit data from src to dst, replacing the color index of every pixel.
+ *
+ * This is intended solely for use with tile4/4bpp data for dst and src.
+ * It allows tiles exported with their own palette to be displayed with another palette holding
+ * the same or similar colors.
+ *
+ * @param dst destination charblock
+ *
+ * @param src source tiles
+ *
+ * @param wcount Number of words to copy
+ *
+ * @param palette_remap the color index in the destination palette of each color index of src
+ */
+void memcpy32_tile4_with_palette_remap(
+    u32* dst,
+    const u32* src,
+    uint wcount,
+    const u8 palette_remap[PAL_ROW_LEN]
+);
+
 /**
  * @brief Toggles the visibility of the window layers.
  *
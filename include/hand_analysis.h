@@ -2,18 +2,63 @@
 #define HAND_ANALYSIS_H
 
 #include "card.h"
+#include "game.h"
 
 #include <tonc.h>
 
-void get_hand_distribution(u8* ranks_out, u8* suits_out);
-void get_played_distribution(u8* ranks_out, u8* suits_out);
+// Bitmask representation of a set of cards, bit n of every mask stands for rank n.
+// Identical cards (same rank and suit) only count once in the suit masks.
+typedef struct
+{
+    u16 ranks; // Ranks with at least one card
+    u16 pairs; // Ranks with at least two cards
+    u16 trips; // Ranks with at least three cards
+    u16 quads; // Ranks with at least four cards
+    u16 suits[NUM_SUITS];
+} HandMasks;
+
+void hand_masks_add_card(HandMasks* masks, const Card* card);
+void hand_masks_from_cards(HandMasks* masks, CardObject** cards, int top);
+
+static inline u8 hand_masks_n_of_a_kind(const HandMasks* masks)
+{
+    return masks->quads ? 4 : masks->trips ? 3 : masks->pairs ? 2 : masks->ranks ? 1 : 0;
+}
+
+static inline bool hand_masks_contains_two_pair(const HandMasks* masks)
+{
+    return __builtin_popcount(masks->pairs) >= 2;
+}
+
+static inline bool hand_masks_contains_full_house(const HandMasks* masks)
+{
+    // The pairs mask includes the three of a kind
+    return masks->trips && __builtin_popcount(masks->pairs) >= 2;
+}
 
 u8 hand_contains_n_of_a_kind(u8* ranks);
 bool hand_contains_two_pair(u8* ranks);
 bool hand_contains_full_house(u8* ranks);
-bool hand_contains_straight(u8* ranks);
+// Takes the ranks mask of a HandMasks, looked up in hand_straight_lut with the active Jokers
+bool hand_contains_straight(u16 rank_mask);
 bool hand_contains_flush(u8* suits);
 
+#define HAND_STRAIGHT_LUT_SIZE (1 << NUM_RANKS)
+
+// Bit of a hand_straight_lut entry that is set when the ranks contain a straight with the given
+// Jokers active. Four Fingers only ever changes the straight size from 5 to 4.
+#define HAND_STRAIGHT_LUT_VARIANT(shortcut, four_fingers) \
+    (1 << (((shortcut) << 1) | (four_fingers)))
+
+// Straight detection indexed by the mask of ranks present (bit n set when ranks[n] > 0),
+// generated by scripts/generate_hand_straight_lut.py, the only place the straight rules live
+extern const u8 hand_straight_lut[HAND_STRAIGHT_LUT_SIZE];
+
+// Classifies a hand from its rank and suit distribution, never returns NONE.
+// Done with lookup tables instead of the hand_contains_*() chain since it runs on every selection
+// change, the result is the same.
+enum HandType hand_get_type_from_distribution(u8* ranks, u8* suits);
+
 int find_flush_in_played_cards(CardObject** played, int top, int min_len, bool* out_selection);
 int find_straight_in_played_cards(
     CardObject** played,
@@ -5,6 +5,8 @@
 #include "game.h"
 #include "graphic_utils.h"
 #include "sprite.h"
+#include "tile_cache.h"
+#include "vector.h"
 
 #include <maxmod.h>
 
@@ -25,6 +27,22 @@
 
 #define JOKER_STARTING_LAYER 27
 
+// Number of Joker spritesheets, one per DEF_JOKER_GFX() of def_joker_gfx_table.h
+// clang-format off
+enum
+{
+    NUM_JOKER_SPRITESHEETS = 0
+#define DEF_JOKER_GFX(idx) + 1
+#include "def_joker_gfx_table.h"
+#undef DEF_JOKER_GFX
+};
+// clang-format on
+
+// Palettes shared by the Joker spritesheets with similar colors, so they share a palette bank.
+// Generated in source/joker_palettes.c by scripts/cluster_joker_palettes.py
+extern const u16 joker_palettes[][PAL_ROW_LEN];
+extern const u8 joker_spritesheet_palettes[]; // The index in joker_palettes of each spritesheet
+
 #define BASE_EDITION     0
 #define FOIL_EDITION     1
 #define HOLO_EDITION     2
@@ -67,8 +85,12 @@ enum JokerEvent
     JOKER_EVENT_ON_ROUND_END,       // Triggers at the end of the round (e.g. Rocket)
     JOKER_EVENT_ON_BLIND_SELECTED,  // Triggers when selecting a blind (e.g. Dagger, Riff Raff,
                                     // Madness..)
+    NUM_JOKER_EVENTS
 };
 
+// Flag of a JokerEvent in JokerInfo.event_flags
+#define JOKER_EVENT_FLAG(joker_event) (1 << (joker_event))
+
 // These are flags that can be combined into a single u32 and returned by
 // JokerEffect functions to indicate which fields of the output JokerEffect are valid
 
@@ -140,12 +162,36 @@ typedef struct
     u8 rarity;
     u8 base_value;
     JokerEffectFunc joker_effect_func;
+    // JOKER_EVENT_FLAG()s of the events the effect function does anything for, the Joker is only
+    // scored for these events
+    u16 event_flags;
 } JokerInfo;
+
+typedef struct
+{
+    JokerObject* joker_object;
+    // The effect function to call, for copying Jokers (Blueprint, Brainstorm) the effect function
+    // of copied_joker
+    JokerEffectFunc effect_func;
+    Joker* copied_joker; // The Joker copied by a copying Joker, NULL otherwise
+} JokerSubscriber;
+
+// The owned Jokers that react to each JokerEvent, in owned list order, so scoring only calls the
+// effect functions that can do something. Rebuilt whenever the owned Jokers change, which is also
+// when the Joker copied by each Blueprint and Brainstorm is resolved.
+typedef struct JokerEventIndex
+{
+    JokerSubscriber subscribers[NUM_JOKER_EVENTS][MAX_JOKERS_HELD_SIZE];
+    u8 num_subscribers[NUM_JOKER_EVENTS];
+} JokerEventIndex;
 const JokerInfo* get_joker_registry_entry(int joker_id);
 size_t get_joker_registry_size(void);
 
 void joker_init();
 
+void joker_event_index_build(JokerEventIndex* index, Vector* jokers);
+
+// NULL if the ID isn't registered or the Joker pool is full
 Joker* joker_new(u8 id);
 void joker_destroy(Joker** joker);
 
@@ -159,24 +205,41 @@ u32 joker_get_score_effect(
     enum JokerEvent joker_event,
     JokerEffect** joker_effect
 );
+// Same as joker_get_score_effect() for a Joker of a JokerEventIndex, applying the copied effect for
+// copying Jokers
+u32 joker_subscriber_get_score_effect(
+    const JokerSubscriber* subscriber,
+    Card* scored_card,
+    enum JokerEvent joker_event,
+    JokerEffect** joker_effect
+);
 int joker_get_sell_value(const Joker* joker);
 
+// NULL if joker is NULL or the JokerObject pool is full
 JokerObject* joker_object_new(Joker* joker);
 void joker_object_destroy(JokerObject** joker_object);
 void joker_object_update(JokerObject* joker_object);
 // This doesn't actually score anything, it just performs an animation and plays a sound effect
 void joker_object_shake(JokerObject* joker_object, mm_word sound_id);
-// This scores the joker and returns true if it was scored successfully
+// This doesn't actually score anything either, the effect has already been applied by the scoring
+// engine (see scoring.h). It displays the effect text, plays its sound and starts the expire
+// animation if needed.
 // card_object = NULL means the joker_event does not concern a particular Card, i.e. Independend or
 // On_Blind_Selected as opposed to events that concern a particular card, i.e. On_Card_Scored or
 // On_Card_Held
-bool joker_object_score(
+void joker_object_display_effect(
     JokerObject* joker_object,
     CardObject* card_object,
-    enum JokerEvent joker_event
+    enum JokerEvent joker_event,
+    u32 effect_flags,
+    const JokerEffect* joker_effect
 );
 
 Sprite* joker_object_get_sprite(JokerObject* joker_object);
+// The VRAM slots of the Joker tiles, for their stats
+const TileCache* joker_get_tile_cache(void);
+// The palette banks of the Jokers, for their stats
+const TileCache* joker_get_pb_cache(void);
 int joker_get_random_rarity();
 
 #endif // JOKER_H
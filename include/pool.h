@@ -5,6 +5,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #ifdef POOLS_TEST_ENV
 #define POOLS_DEF_FILE "def_test_mempool.h"
@@ -12,55 +13,253 @@
 #define POOLS_DEF_FILE "def_balatro_mempool.h"
 #endif
 
-#define POOL_DECLARE_TYPE(type)       \
-    typedef struct                    \
-    {                                 \
-        Bitset* bitset;               \
-        type* objects;                \
-    } type##Pool;                     \
-    type* pool_get_##type();          \
-    void pool_free_##type(type* obj); \
-    int pool_idx_##type(type* obj);   \
-    type* pool_at_##type(int idx);
-
-#define POOL_DEFINE_TYPE(type, capacity)                                \
-    BITSET_DEFINE(type##_bitset, capacity)                              \
-    static type type##_storage[capacity];                               \
-    static type##Pool type##_pool = {                                   \
-        .bitset = &type##_bitset,                                       \
-        .objects = type##_storage,                                      \
-    };                                                                  \
-    type* pool_get_##type()                                             \
-    {                                                                   \
-        int free_offset = bitset_set_next_free_idx(type##_pool.bitset); \
-        if (free_offset == -1)                                          \
-            return NULL;                                                \
-        return &type##_pool.objects[free_offset];                       \
-    }                                                                   \
-    void pool_free_##type(type* entry)                                  \
-    {                                                                   \
-        if (entry == NULL)                                              \
-            return;                                                     \
-        int offset = entry - &type##_pool.objects[0];                   \
-        bitset_set_idx(type##_pool.bitset, offset, false);              \
-    }                                                                   \
-    int pool_idx_##type(type* entry)                                    \
-    {                                                                   \
-        return entry - &type##_pool.objects[0];                         \
-    }                                                                   \
-    type* pool_at_##type(int idx)                                       \
-    {                                                                   \
-        if (idx < 0 || idx >= (type##_pool.bitset)->cap)                \
-            return NULL;                                                \
-        return &type##_pool.objects[idx];                               \
+// Pool flags, the third parameter of a POOL_ENTRY
+// The bitset backend gets the first free index by scanning the pool's bitset
+#define POOL_BITSET 0
+// O(1) get and free from a free list stored in the free objects themselves
+#define POOL_FREE_LIST (1 << 0)
+// Keep a generation per object, incremented when it is freed, so POOL_FROM_HANDLE() can tell a
+// PoolHandle to a freed (and maybe reused) object apart. Only built with POOL_DEBUG, otherwise
+// POOL_FROM_HANDLE() only tells apart the objects that are still free.
+#ifdef POOL_DEBUG
+#define POOL_HANDLES (1 << 1)
+#else
+#define POOL_HANDLES 0
+#endif
+
+#define POOL_FREE_LIST_END UINT16_MAX
+
+// A reference to a pooled object that can be checked for staleness, see POOL_FROM_HANDLE()
+typedef struct
+{
+    uint16_t idx;
+    uint16_t generation;
+} PoolHandle;
+
+// Usage of a pool since it was defined or since the last pool_reset_stats()
+typedef struct
+{
+    const char* name; // The pooled type
+    uint16_t capacity;
+    uint16_t num_in_use;
+    uint16_t high_water_mark; // Highest num_in_use
+    uint16_t failed_gets;     // Gets that returned NULL because the pool was full
+} PoolStats;
+
+typedef struct
+{
+    uint16_t head;     // Index of the most recently freed object, POOL_FREE_LIST_END if none
+    uint16_t num_used; // The objects from this index on have never been handed out
+} PoolFreeList;
+
+// The free list is intrusive, each free object holds the index of the next one in its first bytes
+static inline int pool_free_list_pop(
+    PoolFreeList* free_list,
+    void* objects,
+    size_t object_size,
+    int capacity
+)
+{
+    if (free_list->head != POOL_FREE_LIST_END)
+    {
+        int idx = free_list->head;
+        memcpy(&free_list->head, (uint8_t*)objects + idx * object_size, sizeof(free_list->head));
+        return idx;
+    }
+
+    if (free_list->num_used < capacity)
+    {
+        return free_list->num_used++;
+    }
+
+    return -1;
+}
+
+static inline void pool_free_list_push(
+    PoolFreeList* free_list,
+    void* objects,
+    size_t object_size,
+    int idx
+)
+{
+    memcpy((uint8_t*)objects + idx * object_size, &free_list->head, sizeof(free_list->head));
+    free_list->head = idx;
+}
+
+// Inlined versions of bitset_get_idx() and bitset_set_idx() for the free list backend, so that
+// get and free don't go through function calls for the flag of a single object
+static inline bool pool_is_in_use(const Bitset* bitset, int idx)
+{
+    return bitset->w[idx / BITSET_BITS_PER_WORD] & ((uint32_t)1 << (idx % BITSET_BITS_PER_WORD));
+}
+
+static inline void pool_set_in_use(Bitset* bitset, int idx, bool in_use)
+{
+    uint32_t flag = (uint32_t)1 << (idx % BITSET_BITS_PER_WORD);
+
+    if (in_use)
+    {
+        bitset->w[idx / BITSET_BITS_PER_WORD] |= flag;
+    }
+    else
+    {
+        bitset->w[idx / BITSET_BITS_PER_WORD] &= ~flag;
+    }
+}
+
+static inline void pool_stats_count_get(PoolStats* stats, bool success)
+{
+    if (!success)
+    {
+        stats->failed_gets++;
+        return;
+    }
+
+    stats->num_in_use++;
+    if (stats->num_in_use > stats->high_water_mark)
+    {
+        stats->high_water_mark = stats->num_in_use;
+    }
+}
+
+/**
+ * @brief Get the usage of every pool in POOLS_DEF_FILE
+ *
+ * @param stats output, the PoolStats of each pool in POOLS_DEF_FILE order
+ * @param max_stats size of stats
+ *
+ * @return the number of pools written to stats
+ */
+int pool_get_stats(const PoolStats** stats, int max_stats);
+
+/**
+ * @brief Restart the high water marks from the current usage and the failed gets from 0
+ */
+void pool_reset_stats(void);
+
+/**
+ * @brief Format a PoolStats into one line of text, e.g. "Sprite 12/128 max 40 failed 0"
+ *
+ * @param stats the pool usage to format
+ * @param buffer output
+ * @param size size of buffer
+ *
+ * @return the snprintf() return value
+ */
+int pool_stats_to_str(const PoolStats* stats, char* buffer, size_t size);
+
+#define POOL_DECLARE_TYPE(type)                  \
+    typedef struct                               \
+    {                                            \
+        Bitset* bitset; /* The objects in use */ \
+        type* objects;                           \
+        PoolFreeList free_list;                  \
+    } type##Pool;                                \
+    type* pool_get_##type();                     \
+    void pool_free_##type(type* obj);            \
+    int pool_idx_##type(type* obj);              \
+    type* pool_at_##type(int idx);               \
+    PoolHandle pool_handle_##type(type* obj);    \
+    type* pool_from_handle_##type(PoolHandle handle);
+
+// The flags are constant so the compiler drops the code of the backends that aren't used
+#define POOL_DEFINE_TYPE(type, capacity, flags)                                                \
+    _Static_assert(                                                                            \
+        !((flags) & POOL_FREE_LIST) || sizeof(type) >= sizeof(uint16_t),                       \
+        #type " is too small to hold a free list index"                                        \
+    );                                                                                         \
+    _Static_assert((capacity) < POOL_FREE_LIST_END, #type " pool capacity is too large");      \
+    BITSET_DEFINE(type##_bitset, capacity)                                                     \
+    static type type##_storage[capacity];                                                      \
+    static uint16_t type##_generations[((flags) & POOL_HANDLES) ? (capacity) : 1];             \
+    static PoolStats type##_stats = {#type, capacity};                                         \
+    static type##Pool type##_pool = {                                                          \
+        .bitset = &type##_bitset,                                                              \
+        .objects = type##_storage,                                                             \
+        .free_list = {.head = POOL_FREE_LIST_END, .num_used = 0},                              \
+    };                                                                                         \
+    type* pool_get_##type()                                                                    \
+    {                                                                                          \
+        int free_offset;                                                                       \
+        if ((flags) & POOL_FREE_LIST)                                                          \
+        {                                                                                      \
+            free_offset = pool_free_list_pop(                                                  \
+                &type##_pool.free_list,                                                        \
+                type##_pool.objects,                                                           \
+                sizeof(type),                                                                  \
+                capacity                                                                       \
+            );                                                                                 \
+            if (free_offset != -1)                                                             \
+                pool_set_in_use(type##_pool.bitset, free_offset, true);                        \
+        }                                                                                      \
+        else                                                                                   \
+        {                                                                                      \
+            free_offset = bitset_set_next_free_idx(type##_pool.bitset);                        \
+        }                                                                                      \
+        pool_stats_count_get(&type##_stats, free_offset != -1);                                \
+        if (free_offset == -1)                                                                 \
+            return NULL;                                                                       \
+        return &type##_pool.objects[free_offset];                                              \
+    }                                                                                          \
+    void pool_free_##type(type* entry)                                                         \
+    {                                                                                          \
+        if (entry == NULL)                                                                     \
+            return;                                                                            \
+        int offset = entry - &type##_pool.objects[0];                                          \
+        /* Not from this pool or already free, freeing it again would corrupt the free list */ \
+        if (offset < 0 || offset >= (capacity) || !pool_is_in_use(type##_pool.bitset, offset)) \
+            return;                                                                            \
+        pool_set_in_use(type##_pool.bitset, offset, false);                                    \
+        type##_stats.num_in_use--;                                                             \
+        if ((flags) & POOL_HANDLES)                                                            \
+            type##_generations[offset]++;                                                      \
+        if ((flags) & POOL_FREE_LIST)                                                          \
+        {                                                                                      \
+            pool_free_list_push(                                                               \
+                &type##_pool.free_list,                                                        \
+                type##_pool.objects,                                                           \
+                sizeof(type),                                                                  \
+                offset                                                                         \
+            );                                                                                 \
+        }                                                                                      \
+    }                                                                                          \
+    int pool_idx_##type(type* entry)                                                           \
+    {                                                                                          \
+        return entry - &type##_pool.objects[0];                                                \
+    }                                                                                          \
+    type* pool_at_##type(int idx)                                                              \
+    {                                                                                          \
+        if (idx < 0 || idx >= (type##_pool.bitset)->cap)                                       \
+            return NULL;                                                                       \
+        return &type##_pool.objects[idx];                                                      \
+    }                                                                                          \
+    PoolHandle pool_handle_##type(type* entry)                                                 \
+    {                                                                                          \
+        int offset = entry - &type##_pool.objects[0];                                          \
+        return (PoolHandle){                                                                   \
+            .idx = offset,                                                                     \
+            .generation = ((flags) & POOL_HANDLES) ? type##_generations[offset] : 0,           \
+        };                                                                                     \
+    }                                                                                          \
+    type* pool_from_handle_##type(PoolHandle handle)                                           \
+    {                                                                                          \
+        if (handle.idx >= (capacity) || !pool_is_in_use(type##_pool.bitset, handle.idx))       \
+            return NULL;                                                                       \
+        if (((flags) & POOL_HANDLES) && type##_generations[handle.idx] != handle.generation)   \
+            return NULL;                                                                       \
+        return &type##_pool.objects[handle.idx];                                               \
     }
 
 #define POOL_GET(type)       pool_get_##type()
 #define POOL_FREE(type, obj) pool_free_##type(obj)
 #define POOL_IDX(type, obj)  pool_idx_##type(obj) // the index of the object
 #define POOL_AT(type, idx)   pool_at_##type(idx)  // the object at
+// A handle to a live object of the pool
+#define POOL_HANDLE(type, obj) pool_handle_##type(obj)
+// The object of a handle, NULL if it was freed since the handle was made
+#define POOL_FROM_HANDLE(type, handle) pool_from_handle_##type(handle)
 
-#define POOL_ENTRY(name, capacity) POOL_DECLARE_TYPE(name);
+#define POOL_ENTRY(name, capacity, flags) POOL_DECLARE_TYPE(name);
 #include POOLS_DEF_FILE
 #undef POOL_ENTRY
 
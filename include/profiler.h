@@ -0,0 +1,172 @@
+/**
+ * @file profiler.h
+ *
+ * @brief Per-frame CPU profiler built on the cascaded hardware timers
+ *
+ * Profiler Implementation
+ * =======================
+ *
+ *  - Timers 2 and 3 are cascaded into a free running 32 bit counter of CPU cycles (timer 0 is used
+ * by maxmod). A zone adds the cycles between @ref PROFILER_ZONE_BEGIN() and
+ * @ref PROFILER_ZONE_END() to its count for the frame, it can be entered several times a frame.
+ *
+ *  - The VBLANK interrupt counts the VBLANKs, so @ref PROFILER_FRAME_BEGIN() knows when the last
+ * frame took more than one and which zone took the most cycles in it.
+ *
+ *  - @ref PROFILER_WAIT_VBLANK() spins instead of halting until the next VBLANK, the spins times
+ * the cycles per spin measured in profiler_init() are the cycles the frame left free. Interrupts
+ * that run during the wait, like the HBLANK interrupt of the affine background, aren't counted.
+ *
+ *  - @ref PROFILER_CHECK_COMMIT_DEADLINE() counts the frames in which the video state wasn't done
+ * being copied before the end of VBLANK, see main().
+ *
+ *  - The min/avg/max cycles of each zone are published every @ref PROFILER_WINDOW frames and, when
+ * built with `PROFILER_OVERLAY`, printed on the top line of the text layer. The second line shows
+ * the usage of one memory pool per window, see pool_get_stats().
+ *
+ *  - When built with `PROFILER_LOG`, the average cycles of each window are also written to mGBA's
+ * debug log, so runs can be compared without reading the screen.
+ *
+ *  - Everything compiles to nothing unless `PROFILER` is defined, `make PROFILER=1`,
+ * `make PROFILER=overlay` for the overlay too or `make PROFILER=log` for the log.
+ */
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <tonc.h>
+
+/**
+ * @def PROFILER_WINDOW
+ * @brief Number of frames the published stats are computed over
+ */
+#define PROFILER_WINDOW 60
+
+/**
+ * @def PROFILER_FRAME_CYCLES
+ * @brief CPU cycles between two VBLANKs, 228 scanlines of 1232 cycles
+ */
+#define PROFILER_FRAME_CYCLES 280896
+
+/**
+ * @def PROFILER_CALIBRATION_SPINS
+ * @brief Spins timed by profiler_init() to get the cycles per spin of @ref PROFILER_WAIT_VBLANK()
+ */
+#define PROFILER_CALIBRATION_SPINS 4096
+
+/**
+ * @brief The profiled parts of the main loop
+ */
+enum ProfilerZone
+{
+    PROFILER_ZONE_MM_FRAME,
+    PROFILER_ZONE_AFFINE_BACKGROUND,
+    PROFILER_ZONE_GAME_UPDATE,
+    PROFILER_ZONE_DRAW,
+    PROFILER_NUM_ZONES,
+    PROFILER_ZONE_NONE = PROFILER_NUM_ZONES,
+};
+
+/**
+ * @brief Cycles per frame of a zone over the last window, see @ref PROFILER_WINDOW
+ */
+typedef struct
+{
+    u32 min;
+    u32 avg;
+    u32 max;
+    u32 drops; // Missed frames in which this zone took the most cycles, since the start
+} ProfilerZoneStats;
+
+/**
+ * @brief Everything the profiler publishes
+ */
+typedef struct
+{
+    ProfilerZoneStats zones[PROFILER_NUM_ZONES];
+    u32 frames;                       // Frames profiled
+    u32 missed_vblanks;               // VBLANKs in which no new frame started
+    u32 missed_commit_deadlines;      // Frames whose video state was still copied after VBLANK
+    u32 free_cycles;                  // Average cycles per frame spent waiting for VBLANK
+    enum ProfilerZone last_drop_zone; // Zone that took the most cycles in the last missed frame
+} ProfilerStats;
+
+#ifdef PROFILER
+
+/**
+ * @brief Start the timers and reset the stats
+ */
+void profiler_init(void);
+
+/**
+ * @brief Count a VBLANK, to be called from the VBLANK interrupt
+ */
+IWRAM_CODE void profiler_vblank(void);
+
+/**
+ * @brief End the previous frame and start a new one, to be called right after
+ * @ref PROFILER_WAIT_VBLANK()
+ */
+void profiler_frame_begin(void);
+
+/**
+ * @brief Wait for the next VBLANK like VBlankIntrWait() and count the free cycles of the frame
+ */
+void profiler_wait_vblank(void);
+
+/**
+ * @brief Start timing a zone
+ *
+ * @param zone the @ref ProfilerZone
+ */
+void profiler_zone_begin(enum ProfilerZone zone);
+
+/**
+ * @brief Stop timing a zone and add the cycles to its count for the frame
+ *
+ * @param zone the @ref ProfilerZone
+ */
+void profiler_zone_end(enum ProfilerZone zone);
+
+/**
+ * @brief Count a missed deadline if VBLANK is over, to be called once the video state is copied
+ */
+void profiler_check_commit_deadline(void);
+
+/**
+ * @brief Get the published stats
+ *
+ * @return pointer to the @ref ProfilerStats, updated every @ref PROFILER_WINDOW frames
+ */
+const ProfilerStats* profiler_get_stats(void);
+
+/**
+ * @brief Print the stats on the top line of the text layer when they were just published, and the
+ * stats of the next memory pool on the second line
+ *
+ * Does nothing unless built with `PROFILER_OVERLAY`.
+ */
+void profiler_draw_overlay(void);
+
+#define PROFILER_INIT()                  profiler_init()
+#define PROFILER_VBLANK()                profiler_vblank()
+#define PROFILER_FRAME_BEGIN()           profiler_frame_begin()
+#define PROFILER_WAIT_VBLANK()           profiler_wait_vblank()
+#define PROFILER_ZONE_BEGIN(zone)        profiler_zone_begin(zone)
+#define PROFILER_ZONE_END(zone)          profiler_zone_end(zone)
+#define PROFILER_CHECK_COMMIT_DEADLINE() profiler_check_commit_deadline()
+#define PROFILER_DRAW_OVERLAY()          profiler_draw_overlay()
+
+#else
+
+#define PROFILER_INIT()                  ((void)0)
+#define PROFILER_VBLANK()                ((void)0)
+#define PROFILER_FRAME_BEGIN()           ((void)0)
+#define PROFILER_WAIT_VBLANK()           VBlankIntrWait()
+#define PROFILER_ZONE_BEGIN(zone)        ((void)0)
+#define PROFILER_ZONE_END(zone)          ((void)0)
+#define PROFILER_CHECK_COMMIT_DEADLINE() ((void)0)
+#define PROFILER_DRAW_OVERLAY()          ((void)0)
+
+#endif // PROFILER
+
+#endif // PROFILER_H
@@ -0,0 +1,280 @@
+/**
+ * @file scoring.h
+ *
+ * @brief Headless hand scoring engine
+ *
+ * Scoring Engine
+ * ==============
+ *
+ *  - @ref score_hand() evaluates a played hand in a single call: the hand type, the cards that
+ *    score, and every card and Joker effect in the order the game presents them. It does not touch
+ *    TTE, OAM or maxmod so it can run on a host build or ahead of the scoring animation.
+ *
+ *  - Each effect is recorded as a @ref ScoreStep together with the running chips, mult and money
+ *    after it was applied, the game then plays back the steps to animate the hand.
+ *
+ *  - Joker effect functions read the state of the hand being scored through the `score_get_*`
+ *    accessors below. They are only valid while @ref score_hand() is running.
+ */
+#ifndef SCORING_H
+#define SCORING_H
+
+#include "card.h"
+#include "game.h"
+#include "hand_analysis.h"
+#include "joker.h"
+#include "pool.h"
+
+#include <tonc.h>
+
+/**
+ * @def MAX_SCORE_STEPS
+ * @brief Maximum number of steps recorded in a @ref ScoreResult.
+ *
+ * This leaves room for every scoring card being retriggered by every held Joker plus all the
+ * held card effects. Steps past this are still applied to the final totals of the
+ * @ref ScoreResult and their expired Jokers still recorded, but the steps themselves are not.
+ */
+#define MAX_SCORE_STEPS 512
+
+/**
+ * @brief The base chips and mult for a hand type, along with its display name
+ */
+typedef struct
+{
+    u32 chips;
+    u32 mult;
+    char* display_name;
+} HandValues;
+
+/**
+ * @brief What a @ref ScoreStep records
+ */
+enum ScoreStepType
+{
+    /**
+     * @brief A played card scoring its own chip value
+     */
+    SCORE_STEP_CARD,
+
+    /**
+     * @brief A Joker returning an effect for a @ref JokerEvent
+     */
+    SCORE_STEP_JOKER,
+};
+
+/**
+ * @brief A single scoring effect and the running totals after it was applied
+ */
+typedef struct ScoreStep
+{
+    /**
+     * @brief The @ref ScoreStepType of this step
+     */
+    u8 type;
+
+    /**
+     * @brief The @ref JokerEvent the Joker was scored for, only valid for @ref SCORE_STEP_JOKER
+     */
+    u8 joker_event;
+
+    /**
+     * @brief Index of the card concerned by this step.
+     *
+     * Indexes the played cards for @ref SCORE_STEP_CARD and card scored events, the held cards for
+     * @ref JOKER_EVENT_ON_CARD_HELD, and is @ref UNDEFINED otherwise.
+     */
+    s8 card_idx;
+
+    /**
+     * @brief The Joker that returned the effect, NULL for @ref SCORE_STEP_CARD.
+     *
+     * Kept as the object rather than its index in the jokers list since expired Jokers leave the
+     * list while the steps are still being played back.
+     */
+    JokerObject* joker_object;
+
+    /**
+     * @brief The JOKER_EFFECT_FLAG_* returned by the Joker, @ref JOKER_EFFECT_FLAG_CHIPS for
+     * @ref SCORE_STEP_CARD
+     */
+    u32 effect_flags;
+
+    /**
+     * @brief Copy of the effect returned by the Joker. For @ref SCORE_STEP_CARD only
+     * `effect.chips` is set to the card's value.
+     */
+    JokerEffect effect;
+
+    u32 chips;
+    u32 mult;
+    int money;
+} ScoreStep;
+
+/**
+ * @brief The full result of scoring a hand
+ */
+typedef struct
+{
+    enum HandType hand_type;
+
+    /**
+     * @brief Which of the played cards score for the hand type, indexed like the played cards
+     */
+    bool scoring_cards[MAX_SELECTION_SIZE];
+
+    /**
+     * @brief Final chips and mult after all effects
+     */
+    u32 chips;
+    u32 mult;
+
+    /**
+     * @brief chips * mult, saturated like the in-game score
+     */
+    u32 score;
+
+    /**
+     * @brief Money gained or lost while scoring
+     */
+    int money_delta;
+
+    /**
+     * @brief Handles to the Jokers that expired while scoring, once each, including those of the
+     * steps past @ref MAX_SCORE_STEPS. They outlive the Jokers, which are destroyed as their
+     * expire animation ends.
+     */
+    PoolHandle expired_jokers[MAX_JOKERS_HELD_SIZE];
+    int num_expired_jokers;
+
+    int num_steps;
+    ScoreStep steps[MAX_SCORE_STEPS];
+} ScoreResult;
+
+/**
+ * @brief Game state the scored hand depends on that is not part of the cards or Jokers
+ */
+typedef struct
+{
+    /**
+     * @brief Hands remaining after the scored hand, 0 when scoring the last hand
+     */
+    int hands_remaining;
+    int discards_remaining;
+
+    /**
+     * @brief Number of cards left in the deck
+     */
+    int deck_size;
+
+    /**
+     * @brief Money before the hand is scored
+     */
+    int money;
+} ScoreContext;
+
+/**
+ * @brief Score a played hand
+ *
+ * Effects are applied in the order the game animates them: @ref JOKER_EVENT_ON_HAND_PLAYED, then
+ * each scoring card followed by its @ref JOKER_EVENT_ON_CARD_SCORED and
+ * @ref JOKER_EVENT_ON_CARD_SCORED_END effects (retriggers score the card again), then
+ * @ref JOKER_EVENT_ON_CARD_HELD from the last held card to the first,
+ * @ref JOKER_EVENT_INDEPENDENT and finally @ref JOKER_EVENT_ON_HAND_SCORED_END.
+ *
+ * Joker scoring and persistent state is updated exactly like it would be in-game, so a hand
+ * must only be scored once.
+ *
+ * @param played the played cards, in play order
+ * @param num_played number of played cards, at most @ref MAX_SELECTION_SIZE
+ * @param held the cards remaining in hand
+ * @param num_held number of held cards
+ * @param jokers @ref Vector of owned `JokerObject*` in scoring order
+ * @param joker_index the Jokers scored for each event, built from jokers with
+ * @ref joker_event_index_build()
+ * @param ctx game state the hand is scored against
+ * @param result output, must not be NULL
+ */
+void score_hand(
+    CardObject** played,
+    int num_played,
+    CardObject** held,
+    int num_held,
+    Vector* jokers,
+    const JokerEventIndex* joker_index,
+    const ScoreContext* ctx,
+    ScoreResult* result
+);
+
+/**
+ * @brief Get the base chips and mult of a hand type
+ *
+ * @param hand_type the hand type
+ *
+ * @return the @ref HandValues for the hand type
+ */
+const HandValues* score_get_hand_base_values(enum HandType hand_type);
+
+/**
+ * @brief Apply the effect returned by a Joker to running chips, mult and money
+ *
+ * @param effect_flags the JOKER_EFFECT_FLAG_* returned by the Joker
+ * @param joker_effect the effect returned by the Joker
+ * @param chips in/out running chips
+ * @param mult in/out running mult
+ * @param money in/out running money
+ */
+void score_apply_joker_effect(
+    u32 effect_flags,
+    const JokerEffect* joker_effect,
+    u32* chips,
+    u32* mult,
+    int* money
+);
+
+/**
+ * @name Scored hand accessors
+ * @brief Accessors for Joker effects while a hand is being scored
+ *
+ * @{
+ */
+
+/**
+ * @brief Get the rank and suit distribution of all the played cards
+ *
+ * @param ranks_out array of @ref NUM_RANKS counts
+ * @param suits_out array of @ref NUM_SUITS counts
+ */
+void score_get_played_distribution(u8* ranks_out, u8* suits_out);
+
+/**
+ * @brief Get the rank and suit masks of all the played cards, built once per scored hand
+ *
+ * @return pointer to the @ref HandMasks of the played cards
+ */
+const HandMasks* score_get_played_masks(void);
+
+/** @brief Number of played cards, scoring or not */
+int score_get_played_size(void);
+
+/**
+ * @brief Index of the card currently being scored.
+ *
+ * Indexes the played cards while scoring cards and the held cards for held card effects.
+ */
+int score_get_scored_card_index(void);
+
+CardObject** score_get_held_cards(void);
+int score_get_held_size(void);
+
+/** @brief The money including what was gained so far while scoring the hand */
+int score_get_money(void);
+
+int score_get_num_hands_remaining(void);
+int score_get_num_discards_remaining(void);
+int score_get_deck_size(void);
+Vector* score_get_jokers_list(void);
+
+/** @} */
+
+#endif // SCORING_H
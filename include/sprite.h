@@ -34,6 +34,12 @@ typedef struct
     FIXED vrotation;
     bool focused;
 
+    // Set when an update leaves the SpriteObject at rest, with its sprite showing the settled_*
+    // transform. Updates do nothing until the transform or its targets are changed.
+    bool settled;
+    FIXED settled_x, settled_y;
+    FIXED settled_scale;
+    FIXED settled_rotation;
 } SpriteObject;
 
 // Sprite methods
@@ -41,21 +47,37 @@ Sprite* sprite_new(u16 a0, u16 a1, u32 tid, u32 pb, int sprite_index);
 Sprite* affine_sprite_new(u16 a0, u16 a1, u32 tid, u32 pb);
 void sprite_destroy(Sprite** sprite);
 int sprite_get_layer(Sprite* sprite);
+// Move sprites[i] to the OAM entry first_index + i, keeping its tiles and affine matrix. NULL
+// sprites leave their entry free. Fails without changing anything if one of the entries is used
+// by a sprite that isn't in sprites.
+bool sprite_reorder(Sprite** sprites, int count, int first_index);
 bool sprite_get_dimensions(Sprite* sprite, int* width, int* height);
 bool sprite_get_height(Sprite* sprite, int* height);
 bool sprite_get_width(Sprite* sprite, int* width);
 
 // Sprite functions
 void sprite_init();
+// Copies the OAM entries changed since the last call, must be called during VBlank
 void sprite_draw();
 int sprite_get_pb(const Sprite* sprite);
+int sprite_get_tid(const Sprite* sprite);
+// Copy a 16 color palette to OBJ palette bank pb in the next sprite_draw(), so the colors change
+// during VBlank along with the sprites using them
+void sprite_queue_palette(int pb, const u16* palette);
+
+// Only the OAM entries marked dirty are copied by sprite_draw(), changes to a sprite's OBJ_ATTR
+// or OBJ_AFFINE must go through these functions or be followed by sprite_mark_dirty()
+void sprite_mark_dirty(const Sprite* sprite);
+void sprite_hide(Sprite* sprite);
+void sprite_unhide(Sprite* sprite, u16 mode);
+void sprite_rotscale(Sprite* sprite, FIXED sx, FIXED sy, u16 alpha);
 
 // SpriteObject methods
 SpriteObject* sprite_object_new();
 void sprite_object_destroy(SpriteObject** sprite_object);
 void sprite_object_set_sprite(SpriteObject* sprite_object, Sprite* sprite);
 void sprite_object_reset_transform(SpriteObject* sprite_object);
-void sprite_object_update(SpriteObject* sprite_object);
+IWRAM_CODE void sprite_object_update(SpriteObject* sprite_object);
 void sprite_object_shake(SpriteObject* sprite_object, mm_word sound_id);
 
 Sprite* sprite_object_get_sprite(SpriteObject* sprite_object);
@@ -71,6 +93,7 @@ INLINE void sprite_position(Sprite* sprite, int x, int y)
     sprite->pos.y = y;
 
     obj_set_pos(sprite->obj, x, y);
+    sprite_mark_dirty(sprite);
 }
 
 #endif // SPRITE_H
@@ -0,0 +1,124 @@
+/**
+ * @file tile_cache.h
+ *
+ * @brief Reference counted slots of sprite tiles kept in VRAM
+ *
+ * Tile Cache Implementation
+ * =========================
+ *
+ *  - A @ref TileCache hands out the fixed size VRAM slots of a kind of sprite (e.g. the 16 tiles of
+ * a card) by key, the key being whatever identifies the graphics (e.g. the suit and rank of the
+ * card). Every sprite using a slot holds a reference to it, so sprites with the same graphics share
+ * one copy of their tiles.
+ *
+ *  - The tiles stay in their slot after the last reference is released. The slot is only reused,
+ * least recently used first, when a key that isn't cached needs one, so graphics that come back are
+ * still in VRAM.
+ *
+ *  - The cache doesn't touch VRAM itself, @ref tile_cache_acquire() tells the caller when the tiles
+ * have to be copied to the slot. This way it also works for other reference counted slots, e.g. the
+ * OBJ palette banks of the Jokers.
+ */
+#ifndef TILE_CACHE_H
+#define TILE_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Usage of a @ref TileCache since it was defined or since the last @ref tile_cache_clear()
+ */
+typedef struct
+{
+    uint32_t hits;      // Acquires of a key whose tiles were already in their slot
+    uint32_t misses;    // Acquires that need the tiles to be copied, the uploads to VRAM
+    uint32_t evictions; // Misses that replaced the tiles of another key
+    uint32_t failures;  // Acquires that failed because every slot was referenced
+} TileCacheStats;
+
+/**
+ * @brief A VRAM slot of a @ref TileCache
+ */
+typedef struct
+{
+    bool loaded; // The slot holds the tiles of key
+    int key;
+    uint16_t ref_count;
+    uint32_t last_used;
+} TileCacheSlot;
+
+/**
+ * @brief Reference counted VRAM slots, see @ref TILE_CACHE_DEFINE
+ */
+typedef struct
+{
+    TileCacheSlot* slots;
+    int num_slots;
+    uint32_t clock; // Incremented on every acquire, for the last_used of the slots
+    TileCacheStats stats;
+} TileCache;
+
+/**
+ * Forget the tiles of every slot and reset the stats
+ *
+ * @param cache pointer to a @ref TileCache
+ */
+void tile_cache_clear(TileCache* cache);
+
+/**
+ * Get a reference to the slot holding the tiles of a key
+ *
+ * @param cache pointer to a @ref TileCache
+ * @param key identifies the graphics
+ * @param upload output, `true` if the caller has to copy the tiles to the returned slot
+ *
+ * @return the slot index, or -1 if every slot is referenced
+ */
+int tile_cache_acquire(TileCache* cache, int key, bool* upload);
+
+/**
+ * Release a reference from @ref tile_cache_acquire()
+ *
+ * @param cache pointer to a @ref TileCache
+ * @param slot the slot index, out of range or unreferenced slots are ignored
+ */
+void tile_cache_release(TileCache* cache, int slot);
+
+/**
+ * Get the number of slots no sprite references
+ *
+ * @param cache pointer to a @ref TileCache
+ *
+ * @return the number of slots that can be acquired by a key that isn't cached
+ */
+int tile_cache_get_num_free(const TileCache* cache);
+
+/**
+ * Get the longest run of consecutive unreferenced slots
+ *
+ * Compared with @ref tile_cache_get_num_free() it shows how fragmented the referenced slots are.
+ *
+ * @param cache pointer to a @ref TileCache
+ *
+ * @return the number of slots in the run
+ */
+int tile_cache_get_largest_free_run(const TileCache* cache);
+
+/**
+ * @def TILE_CACHE_DEFINE
+ * @brief Make a tile cache
+ *
+ * Make an empty tile cache with a static array of `size` slots, to be used as a `static` scoped
+ * variable named `name`.
+ *
+ * @param name the name of the cache
+ * @param size the number of VRAM slots
+ */
+#define TILE_CACHE_DEFINE(name, size)                \
+    static TileCacheSlot name##_slots[size] = {{0}}; \
+    static TileCache name = {                        \
+        .slots = name##_slots,                       \
+        .num_slots = size,                           \
+    };
+
+#endif // TILE_CACHE_H
@@ -0,0 +1,151 @@
+/**
+ * @file timeline.h
+ *
+ * @brief Frame scheduler for the animated sequences of the game states
+ *
+ * Timeline Implementation
+ * =======================
+ *
+ *  - A sequence is declared as an array of @ref TimelineStep. A step waits a number of frames, then
+ * runs its action once or repeatedly at an interval, and the next step waits from the last run.
+ *
+ *  - A @ref Timeline plays up to @ref TIMELINE_MAX_TRACKS sequences side by side, one per track.
+ * An action can start another sequence, on any track including its own, to branch or chain them.
+ *
+ *  - @ref timeline_update() is called once a frame. The timeline keeps the frame at which the next
+ * step is due, so frames in which nothing is due cost a single comparison.
+ *
+ *  - The frame counts of the steps are at normal game speed. They are divided by the speed of the
+ * timeline, rounded up, as they are scheduled, and @ref timeline_set_speed() rescales the waits
+ * already scheduled, so the whole timeline keeps its proportions when the game speed changes.
+ */
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @def TIMELINE_MAX_TRACKS
+ * @brief Number of sequences a @ref Timeline can play at the same time
+ */
+#define TIMELINE_MAX_TRACKS 4
+
+/**
+ * @def TIMELINE_UNTIL_DONE
+ * @brief @ref TimelineStep runs value to repeat the action until it returns true
+ */
+#define TIMELINE_UNTIL_DONE UINT16_MAX
+
+/**
+ * @def TIMELINE_NEVER
+ * @brief Due frame of a @ref Timeline with nothing left to run
+ */
+#define TIMELINE_NEVER UINT32_MAX
+
+/**
+ * @brief Action of a @ref TimelineStep
+ *
+ * @param run the number of times the action already ran in this step, 0 on the first run
+ *
+ * @return true to end the step early, before its last run
+ */
+typedef bool (*TimelineActionFn)(int run);
+
+/**
+ * @brief A step of a sequence, see @ref timeline_start_track()
+ *
+ * The frame counts are at normal game speed. Fields left out of an initializer make a step that
+ * runs its action once, on the frame the previous step ended.
+ */
+typedef struct
+{
+    TimelineActionFn action; // NULL for a step that only waits
+    uint16_t delay;          // Frames from the end of the previous step to the first run
+    uint16_t interval;       // Frames between two runs
+    uint16_t runs;           // Number of runs, 0 counts as 1, or TIMELINE_UNTIL_DONE
+} TimelineStep;
+
+/**
+ * @brief The sequence played on a track of a @ref Timeline
+ */
+typedef struct
+{
+    const TimelineStep* steps; // NULL when the track is done
+    int num_steps;
+    int step;        // The current step
+    int runs;        // Runs of the current step so far
+    uint32_t due;    // Frame of the next run
+    uint32_t starts; // Sequences started on this track, to tell when an action replaced its own
+} TimelineTrack;
+
+/**
+ * @brief Sequences played side by side, see @ref timeline_update()
+ */
+typedef struct
+{
+    TimelineTrack tracks[TIMELINE_MAX_TRACKS];
+    uint32_t frame;    // Frames since timeline_init()
+    uint32_t next_due; // Earliest due frame of the tracks, TIMELINE_NEVER when they are all done
+    int speed;
+} Timeline;
+
+/**
+ * @brief Stop every track and start counting frames from 0
+ *
+ * @param timeline the @ref Timeline
+ * @param speed the game speed, 1 for normal speed
+ */
+void timeline_init(Timeline* timeline, int speed);
+
+/**
+ * @brief Change the speed, rescaling the waits that are already scheduled
+ *
+ * @param timeline the @ref Timeline
+ * @param speed the game speed, 1 for normal speed
+ */
+void timeline_set_speed(Timeline* timeline, int speed);
+
+/**
+ * @brief Play a sequence on a track, replacing the one it was playing
+ *
+ * The delay of the first step counts from the current frame. Called from an action, the track
+ * goes on from the frame of the action.
+ *
+ * @param timeline the @ref Timeline
+ * @param track index of the track, less than @ref TIMELINE_MAX_TRACKS
+ * @param steps the sequence, must outlive its playback
+ * @param num_steps number of steps in the sequence
+ */
+void timeline_start_track(Timeline* timeline, int track, const TimelineStep* steps, int num_steps);
+
+/**
+ * @brief Check if every track is done playing its sequence
+ *
+ * @param timeline the @ref Timeline
+ *
+ * @return true if nothing is left to run
+ */
+bool timeline_is_done(const Timeline* timeline);
+
+/**
+ * @brief Run the steps due on the current frame, see @ref timeline_update()
+ *
+ * @param timeline the @ref Timeline
+ */
+void timeline_run_due(Timeline* timeline);
+
+/**
+ * @brief Move on to the next frame and run the steps due on it, to be called once a frame
+ *
+ * @param timeline the @ref Timeline
+ */
+static inline void timeline_update(Timeline* timeline)
+{
+    if (++timeline->frame >= timeline->next_due)
+    {
+        timeline_run_due(timeline);
+    }
+}
+
+#endif // TIMELINE_H
@@ -0,0 +1,256 @@
+/**
+ * @file vector.h
+ *
+ * @brief A fixed capacity array of pointers
+ *
+ * Vector Implementation
+ * =====================
+ *
+ *  - A @ref Vector keeps its entries contiguous and in order in an array sized when it is defined
+ * with @ref VECTOR_DEFINE, so indexing is O(1) and iterating doesn't follow any node pointers.
+ * Inserting and removing shift the entries after the index, which is cheap for the small
+ * collections it is meant for. It mirrors the @ref List API, with a @ref VectorItr in place of the
+ * @ref ListItr.
+ */
+#ifndef VECTOR_H
+#define VECTOR_H
+
+#include <stdbool.h>
+
+/**
+ * @brief A fixed capacity array of pointers
+ */
+typedef struct Vector
+{
+    /**
+     * @brief Storage for `cap` entries, the first `len` are in use
+     */
+    void** data;
+
+    /**
+     * @brief Number of entries in the vector
+     */
+    int len;
+
+    /**
+     * @brief Maximum number of entries
+     */
+    int cap;
+} Vector;
+
+/**
+ * @brief @ref VectorItr direction
+ */
+enum VectorItrDirection
+{
+    VECTOR_ITR_FORWARD,
+    VECTOR_ITR_REVERSE,
+};
+
+/**
+ * @brief An iterator into a vector
+ */
+typedef struct
+{
+    /**
+     * @brief A pointer to the @ref Vector this is iterating through
+     */
+    Vector* vector;
+
+    /**
+     * @brief Index of the next entry
+     */
+    int next_idx;
+
+    /**
+     * @brief Index of the most recently returned entry from @ref vector_itr_next(), -1 if none
+     */
+    int current_idx;
+
+    /**
+     * @brief The direction of the iterator
+     */
+    enum VectorItrDirection direction;
+} VectorItr;
+
+/**
+ * Clear a vector.
+ *
+ * Note, it doesn't "free" the entries.
+ *
+ * @param vector pointer to a @ref Vector to clear
+ */
+void vector_clear(Vector* vector);
+
+/**
+ * Check if a vector is empty
+ *
+ * @param vector pointer to a @ref Vector
+ *
+ * @return `true` if the `vector` is empty, `false` otherwise.
+ */
+bool vector_is_empty(const Vector* vector);
+
+/**
+ * Check if a vector is at its capacity
+ *
+ * @param vector pointer to a @ref Vector
+ *
+ * @return `true` if no more entries can be added to the `vector`, `false` otherwise.
+ */
+bool vector_is_full(const Vector* vector);
+
+/**
+ * Prepend an entry to a @ref Vector
+ *
+ * @param vector pointer to a @ref Vector
+ * @param data pointer to data to put into the @ref Vector
+ *
+ * @return `true` if added, `false` if the vector is full
+ */
+bool vector_push_front(Vector* vector, void* data);
+
+/**
+ * Append an entry to a @ref Vector
+ *
+ * @param vector pointer to a @ref Vector
+ * @param data pointer to data to put into the @ref Vector
+ *
+ * @return `true` if added, `false` if the vector is full
+ */
+bool vector_push_back(Vector* vector, void* data);
+
+/**
+ * Insert data into a @ref Vector at a specific index
+ *
+ * The entries from idx on are moved up by one. If the index specified is larger than the length of
+ * the vector it will @ref vector_push_back() the data instead.
+ *
+ * @param vector pointer to a @ref Vector
+ * @param data pointer to data to put into the @ref Vector
+ * @param idx desired index to insert
+ *
+ * @return `true` if added, `false` if the vector is full
+ */
+bool vector_insert(Vector* vector, void* data, unsigned int idx);
+
+/**
+ * Swap the entries at the specified indices of a @ref Vector
+ *
+ * If either indices are larger than the length of the vector, return false.
+ *
+ * @param vector pointer to a @ref Vector
+ * @param idx_a desired index to swap with idx_b
+ * @param idx_b desired index to swap with idx_a
+ *
+ * @return true if successful, false otherwise
+ */
+bool vector_swap(Vector* vector, unsigned int idx_a, unsigned int idx_b);
+
+/**
+ * Get a Vector's entry at the specified index
+ *
+ * @param vector pointer to a @ref Vector
+ * @param idx index of the desired entry
+ *
+ * @return the data at the index of the vector, or NULL if out-of-bounds
+ */
+void* vector_get_at_idx(const Vector* vector, unsigned int idx);
+
+/**
+ * Remove a Vector's entry at the specified index
+ *
+ * The entries after idx are moved down by one, keeping their order.
+ *
+ * @param vector pointer to a @ref Vector
+ * @param idx index of the desired entry
+ *
+ * @return `true` if successfully removed, `false` if out-of-bounds
+ */
+bool vector_remove_at_idx(Vector* vector, unsigned int idx);
+
+/**
+ * Get the index of an entry in a @ref Vector
+ *
+ * @param vector pointer to a @ref Vector
+ * @param data the entry to look for
+ *
+ * @return the index of the first entry equal to data, -1 if there is none
+ */
+int vector_find(const Vector* vector, const void* data);
+
+/**
+ * Get the number of entries in a @ref Vector
+ *
+ * @param vector pointer to a @ref Vector
+ *
+ * @return The number of entries in the vector
+ */
+int vector_get_len(const Vector* vector);
+
+/**
+ * Declare a @ref VectorItr
+ *
+ * @param vector pointer to a @ref Vector
+ *
+ * @return A new @ref VectorItr
+ */
+VectorItr vector_itr_create(Vector* vector);
+
+/**
+ * Declare a reverse @ref VectorItr
+ *
+ * @param vector pointer to a @ref Vector
+ *
+ * @return A new reverse @ref VectorItr
+ */
+VectorItr rev_vector_itr_create(Vector* vector);
+
+/**
+ * Get the next entry in a @ref VectorItr
+ *
+ * @param itr pointer to the @ref VectorItr
+ *
+ * @return The next entry if there is one, otherwise return NULL.
+ */
+void* vector_itr_next(VectorItr* itr);
+
+/**
+ * Remove the current entry from the iterator.
+ *
+ * The "current entry" is the most recently returned value from @ref vector_itr_next(). The
+ * iteration continues with the entry that followed it.
+ *
+ * @param itr pointer to the @ref VectorItr
+ */
+void vector_itr_remove_current(VectorItr* itr);
+
+/**
+ * @def VECTOR_DEFINE
+ * @brief Make a vector
+ *
+ * Make an empty vector with a static array to store up to `capacity` entries.
+ *
+ * Use this to define vectors in the code, specifically as a `static` scoped
+ * variable. The passed `name` will be the same name as the vector.
+ *
+ * Usage example:
+ *
+ * ```c
+ * VECTOR_DEFINE(_my_vector, 8);
+ * // normal operation...
+ * vector_clear(&_my_vector);
+ * ```
+ *
+ * @param name the name of the vector
+ * @param capacity the maximum number of entries
+ */
+#define VECTOR_DEFINE(name, capacity)            \
+    static void* name##_data[capacity] = {NULL}; \
+    static Vector name = {                       \
+        .data = name##_data,                     \
+        .len = 0,                                \
+        .cap = capacity,                         \
+    };
+
+#endif // VECTOR_H
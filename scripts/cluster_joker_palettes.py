@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+# Generates source/joker_palettes.c, the palettes shared by the Joker spritesheets
+# (graphics/joker_gfx*.png) so that spritesheets with similar colors use one OBJ palette bank.
+#
+# Usage: cluster_joker_palettes.py [--max-error N] [--dry-run] [out.c]
+#
+# Spritesheets are merged most similar first, as long as the colors of a merged cluster can be
+# reduced to 15 (+ transparent) colors with no color moving further than --max-error, in GBA
+# 5 bit color units. The spritesheets themselves aren't changed, joker.c maps the colors of their
+# grit palette to the closest colors of the shared palette when it uploads their tiles.
+#
+# Run it again after adding or changing a Joker spritesheet.
+
+from PIL import Image
+import argparse
+import itertools
+import math
+import os
+import re
+
+GRAPHICS_DIR = "graphics"
+DEFAULT_OUT_PATH = os.path.join("source", "joker_palettes.c")
+SPRITESHEET_RE = re.compile(r"joker_gfx(\d+)\.png$")
+
+# Index 0 is transparent on the GBA, so a palette has 15 colors for the sprite itself
+MAX_COLORS = 15
+# JOKER_LAST_PB - JOKER_BASE_PB + 1 in include/joker.h, every palette has its own bank
+NUM_JOKER_PBS = 12
+COLORS_PER_LINE = 8
+
+parser = argparse.ArgumentParser()
+parser.add_argument(
+    "--max-error",
+    type=float,
+    default=4.0,
+    help="furthest a color may move when merging palettes, in GBA 5 bit color units",
+)
+parser.add_argument(
+    "--dry-run", action="store_true", help="only print the clusters, don't write anything"
+)
+parser.add_argument("out", nargs="?", default=DEFAULT_OUT_PATH)
+
+
+def to_gba(rgb):
+    return tuple(channel >> 3 for channel in rgb)
+
+
+def rgb15(color):
+    r, g, b = color
+    return r | (g << 5) | (b << 10)
+
+
+def distance(a, b):
+    return math.dist(a, b)
+
+
+def load_spritesheets():
+    spritesheets = []
+    for name in os.listdir(GRAPHICS_DIR):
+        match = SPRITESHEET_RE.match(name)
+        if match:
+            spritesheets.append((int(match.group(1)), os.path.join(GRAPHICS_DIR, name)))
+    spritesheets.sort()
+
+    # The spritesheet index is the position in the list, like DEF_JOKER_GFX() in joker.c
+    assert [idx for idx, _ in spritesheets] == list(range(len(spritesheets)))
+    return [Image.open(path).convert("RGBA") for _, path in spritesheets]
+
+
+def pixels(image):
+    data = image.tobytes()
+    return [tuple(data[i : i + 4]) for i in range(0, len(data), 4)]
+
+
+def color_histogram(image):
+    histogram = {}
+    for r, g, b, a in pixels(image):
+        if a == 0:
+            continue
+        color = to_gba((r, g, b))
+        histogram[color] = histogram.get(color, 0) + 1
+    return histogram
+
+
+def reduce_colors(histogram, max_error):
+    """Merge the closest colors, weighted by pixel count, until there are MAX_COLORS left.
+
+    Returns (palette, color -> palette index), or None if a color would move further than
+    max_error."""
+    groups = [[color] for color in histogram]
+    centers = list(histogram)
+
+    while len(groups) > MAX_COLORS:
+        _, i, j = min(
+            (distance(centers[i], centers[j]), i, j)
+            for i, j in itertools.combinations(range(len(groups)), 2)
+        )
+        groups[i] += groups.pop(j)
+        centers.pop(j)
+
+        weight = sum(histogram[color] for color in groups[i])
+        centers[i] = tuple(
+            round(sum(color[channel] * histogram[color] for color in groups[i]) / weight)
+            for channel in range(3)
+        )
+
+        if any(distance(color, centers[i]) > max_error for color in groups[i]):
+            return None
+
+    # Most used colors first so the output doesn't depend on the merge order
+    order = sorted(
+        range(len(groups)), key=lambda g: (-sum(histogram[c] for c in groups[g]), centers[g])
+    )
+    palette = [centers[g] for g in order]
+    mapping = {color: index for index, g in enumerate(order) for color in groups[g]}
+    return palette, mapping
+
+
+def merged(a, b):
+    histogram = dict(a)
+    for color, count in b.items():
+        histogram[color] = histogram.get(color, 0) + count
+    return histogram
+
+
+def cluster(histograms, max_error):
+    clusters = [[idx] for idx in range(len(histograms))]
+    cluster_histograms = list(histograms)
+
+    while True:
+        best = None
+        for i, j in itertools.combinations(range(len(clusters)), 2):
+            histogram = merged(cluster_histograms[i], cluster_histograms[j])
+            reduced = reduce_colors(histogram, max_error)
+            if reduced is None:
+                continue
+
+            palette, mapping = reduced
+            error = max(distance(color, palette[mapping[color]]) for color in histogram)
+            # Least error first, then the clusters sharing the most colors
+            key = (error, len(histogram))
+            if best is None or key < best[0]:
+                best = (key, i, j, histogram)
+
+        if best is None:
+            break
+
+        _, i, j, histogram = best
+        clusters[i] += clusters.pop(j)
+        cluster_histograms[i] = histogram
+        cluster_histograms.pop(j)
+
+    return [(sorted(c), h) for c, h in sorted(zip(clusters, cluster_histograms))]
+
+
+def write_palettes(out_path, palettes, spritesheet_palettes):
+    with open(out_path, "w") as out:
+        out.write("// Generated by scripts/cluster_joker_palettes.py, do not edit\n")
+        out.write('#include "joker.h"\n')
+        out.write('#include "util.h"\n\n')
+        out.write("// clang-format off\n")
+
+        out.write("const u16 joker_palettes[][PAL_ROW_LEN] = {\n")
+        for palette in palettes:
+            # Index 0 is transparent
+            colors = [0] + [rgb15(color) for color in palette]
+            colors += [0] * (MAX_COLORS + 1 - len(colors))
+            out.write("    {\n")
+            for i in range(0, len(colors), COLORS_PER_LINE):
+                line = ", ".join(f"0x{color:04x}" for color in colors[i : i + COLORS_PER_LINE])
+                out.write(f"        {line},\n")
+            out.write("    },\n")
+        out.write("};\n\n")
+
+        out.write("const u8 joker_spritesheet_palettes[] = {\n")
+        line = ", ".join(str(palette_idx) for palette_idx in spritesheet_palettes)
+        out.write(f"    {line},\n")
+        out.write("};\n")
+        out.write("// clang-format on\n\n")
+
+        # A spritesheet added or removed without running this again would index past the end
+        out.write("_Static_assert(\n")
+        out.write("    NUM_ELEM_IN_ARR(joker_spritesheet_palettes) == NUM_JOKER_SPRITESHEETS,\n")
+        out.write('    "Run scripts/cluster_joker_palettes.py after changing the Joker spritesheets"\n')
+        out.write(");\n")
+        out.write("_Static_assert(\n")
+        out.write("    NUM_ELEM_IN_ARR(joker_palettes) <= JOKER_LAST_PB - JOKER_BASE_PB + 1,\n")
+        out.write('    "Every Joker palette needs its own palette bank"\n')
+        out.write(");\n")
+
+
+def main():
+    args = parser.parse_args()
+
+    images = load_spritesheets()
+    histograms = [color_histogram(image) for image in images]
+    clusters = cluster(histograms, args.max_error)
+
+    palettes = []
+    spritesheet_palettes = [0] * len(images)
+    for palette_idx, (spritesheets, histogram) in enumerate(clusters):
+        palette, mapping = reduce_colors(histogram, args.max_error)
+        error = max(distance(color, palette[mapping[color]]) for color in histogram)
+        print(
+            f"palette {palette_idx}: spritesheets {spritesheets}, "
+            f"{len(palette)} colors, max error {error:.2f}"
+        )
+
+        palettes.append(palette)
+        for spritesheet_idx in spritesheets:
+            spritesheet_palettes[spritesheet_idx] = palette_idx
+
+    print(f"{len(images)} spritesheets in {len(clusters)} palettes")
+
+    if len(clusters) > NUM_JOKER_PBS:
+        raise SystemExit(
+            f"error: {len(clusters)} palettes for {NUM_JOKER_PBS} Joker palette banks, "
+            "raise --max-error or free palette banks"
+        )
+
+    if not args.dry_run:
+        write_palettes(args.out, palettes, spritesheet_palettes)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+# Generates source/hand_straight_lut.c, the straight lookup table used by
+# hand_contains_straight() and hand_get_type_from_distribution() in source/hand_analysis.c
+#
+# Usage: generate_hand_straight_lut.py <out.c>
+#
+# The table is indexed by a 13-bit mask of the ranks present in a hand (bit 0 is TWO, bit 12 is
+# ACE). Each entry has one bit per straight variant, see HAND_STRAIGHT_LUT_VARIANT() in
+# include/hand_analysis.h. hand_contains_straight() looks its answer up here, so these are the
+# game's straight rules.
+
+import sys
+
+NUM_RANKS = 13
+TWO = 0
+THREE = 1
+FIVE = 3
+QUEEN = 10
+KING = 11
+ACE = 12
+
+ENTRIES_PER_LINE = 12
+
+
+def contains_straight(mask, straight_size):
+    run = 0
+    for rank in range(NUM_RANKS):
+        if mask & (1 << rank):
+            run += 1
+            if run >= straight_size:
+                return True
+        else:
+            run = 0
+
+    # Ace low straight
+    if mask & (1 << ACE):
+        last_needed = TWO + (straight_size - 2)
+        if last_needed <= FIVE:
+            return all(mask & (1 << rank) for rank in range(TWO, last_needed + 1))
+
+    return False
+
+
+def contains_shortcut_straight(mask, straight_size):
+    longest_at = [0] * NUM_RANKS
+    ace_low_len = 1 if mask & (1 << ACE) else 0
+
+    for rank in range(NUM_RANKS):
+        if not mask & (1 << rank):
+            continue
+
+        if rank == TWO:
+            prev = ace_low_len
+        elif rank == THREE:
+            prev = max(longest_at[TWO], ace_low_len)
+        elif rank == ACE:
+            prev = max(longest_at[KING], longest_at[QUEEN])
+        else:
+            prev = max(longest_at[rank - 1], longest_at[rank - 2])
+
+        longest_at[rank] = 1 + prev
+        if longest_at[rank] >= straight_size:
+            return True
+
+    return False
+
+
+def lut_entry(mask):
+    # Variant bit layout: (shortcut << 1) | four_fingers
+    entry = 0
+    for shortcut in (0, 1):
+        for four_fingers in (0, 1):
+            straight_size = 4 if four_fingers else 5
+            if shortcut:
+                found = contains_shortcut_straight(mask, straight_size)
+            else:
+                found = contains_straight(mask, straight_size)
+            if found:
+                entry |= 1 << ((shortcut << 1) | four_fingers)
+    return entry
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(f"usage: {sys.argv[0]} <out.c>", file=sys.stderr)
+        sys.exit(1)
+
+    entries = [lut_entry(mask) for mask in range(1 << NUM_RANKS)]
+
+    with open(sys.argv[1], "w") as out:
+        out.write("// Generated by scripts/generate_hand_straight_lut.py, do not edit\n")
+        out.write('#include "hand_analysis.h"\n\n')
+        out.write("// clang-format off\n")
+        out.write("const u8 hand_straight_lut[HAND_STRAIGHT_LUT_SIZE] = {\n")
+        for i in range(0, len(entries), ENTRIES_PER_LINE):
+            line = ", ".join(f"0x{entry:x}" for entry in entries[i:i + ENTRIES_PER_LINE])
+            out.write(f"    {line},\n")
+        out.write("};\n")
+        out.write("// clang-format on\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -2,19 +2,25 @@
 
 #include "affine_background_gfx.h"
 #include "affine_main_menu_background_gfx.h"
+#include "affine_wave.h"
 #include "graphic_utils.h"
 
-#define ANIMATION_SPEED_DIVISOR 16
+/* Pre-computed affine matrices for each scanline, see affine_wave_prep_bgaff_arr(). The front
+ * buffer is being displayed while affine_background_update() fills the back buffer for the next
+ * frame, affine_background_commit() swaps them in VBLANK. Only the front buffer is ever displayed.
+ */
+static BG_AFFINE _bgaff_buffers[2][AFFINE_WAVE_ARR_LEN];
+static BG_AFFINE* _bgaff_front = _bgaff_buffers[0];
+static BG_AFFINE* _bgaff_back = _bgaff_buffers[1];
+// Whether the buffer has the matrix of every scanline, otherwise only the first one
+static bool _front_per_scanline = false;
+static bool _back_per_scanline = false;
 
-// Prepare screen during VBLANK
-// Pre-computes the affine matrices values for each scanline and stores in bgaff_arr. This is to be
-// done in VBLANK so the HBLANK code can just fetch the values quickly.
-static IWRAM_CODE void s_affine_background_prep_bgaff_arr();
-
-static BG_AFFINE _bgaff_arr[SCREEN_HEIGHT + 1];
 static AFF_SRC_EX _asx = {0};
 static enum AffineBackgroundID _background = AFFINE_BG_MAIN_MENU;
 static uint _timer = 0;
+// Per-scanline matrices of the main menu, see affine_background_change_background()
+static bool _high_quality = true;
 
 void affine_background_init()
 {
@@ -32,17 +38,79 @@ IWRAM_CODE void affine_background_hblank()
         return;
     }
 
-    // See comment in affine_background_prep_bgaff_arr()
-    REG_BG_AFFINE[AFFINE_BG_IDX] = _bgaff_arr[vcount + 1];
+    // See comment in affine_wave_prep_bgaff_arr()
+    REG_BG_AFFINE[AFFINE_BG_IDX] = _bgaff_front[vcount + 1];
+}
+
+/* Shows the front buffer from the first scanline on. Called from the VBLANK interrupt as well as
+ * from affine_background_commit(), so a frame whose logic runs late shows the last committed
+ * matrices again instead of the HBLANK DMA running on past the end of the front buffer.
+ */
+IWRAM_CODE static void s_affine_background_restart(void)
+{
+    REG_BG_AFFINE[AFFINE_BG_IDX] = _bgaff_front[0];
+
+#if AFFINE_BG_HBLANK_DMA
+    if (_front_per_scanline)
+    {
+        /* The DMA runs in the HBLANK after each visible scanline, so the first transfer is the
+         * matrix of the second scanline. It doesn't run in VBLANK, and only reloads its
+         * destination on repeat, so the source has to be set again every frame.
+         */
+        DMA_TRANSFER(
+            &REG_BG_AFFINE[AFFINE_BG_IDX],
+            &_bgaff_front[1],
+            sizeof(BG_AFFINE) / sizeof(u32),
+            AFFINE_BG_DMA_CHANNEL,
+            DMA_HDMA | DMA_32
+        );
+    }
+    else
+    {
+        REG_DMA[AFFINE_BG_DMA_CHANNEL].cnt = 0;
+    }
+#else
+    if (_front_per_scanline)
+    {
+        REG_IE |= IRQ_HBLANK; // Enable HBLANK
+    }
+    else
+    {
+        REG_IE &= ~IRQ_HBLANK; // Disable HBLANK
+    }
+#endif
+}
+
+IWRAM_CODE void affine_background_vblank()
+{
+    s_affine_background_restart();
+}
+
+IWRAM_CODE void affine_background_commit()
+{
+    BG_AFFINE* displayed = _bgaff_front;
+    _bgaff_front = _bgaff_back;
+    _bgaff_back = displayed;
+    _front_per_scanline = _back_per_scanline;
+
+    // The VBLANK interrupt restarted the old front buffer, this frame shows the new one
+    s_affine_background_restart();
 }
 
 void affine_background_update()
 {
-    if (REG_IE & IRQ_HBLANK) // High quality mode with HBLANK interrupt
+    // The mode can change before the commit, the buffer keeps the one it was filled in
+    _back_per_scanline = _high_quality;
+
+    if (_high_quality) // High quality mode with per-scanline matrices
     {
-        s_affine_background_prep_bgaff_arr();
+        affine_wave_prep_bgaff_arr(_bgaff_back, _timer);
+
+        // The low quality mode scrolls on from where the last scanline left the texture
+        _asx.tex_x = AFFINE_WAVE_TEX_POS + affine_wave_get_offset(_timer, SCREEN_HEIGHT - 1);
+        _asx.tex_y = AFFINE_WAVE_TEX_POS;
     }
-    else // Low quality mode without HBLANK interrupt
+    else // Low quality mode with one matrix for the whole screen
     {
         _asx.scr_x = 0;
         _asx.scr_y = 0;
@@ -54,8 +122,7 @@ void affine_background_update()
         _asx.sy = ((lu_sin(_timer * 100 + 0x4000)) >> 8) + 256;
         _asx.alpha = 0;
 
-        bg_rotscale_ex(&_bgaff_arr[0], &_asx);
-        REG_BG_AFFINE[AFFINE_BG_IDX] = _bgaff_arr[0];
+        bg_rotscale_ex(&_bgaff_back[0], &_asx);
     }
 
     _timer++;
@@ -85,7 +152,7 @@ void affine_background_change_background(enum AffineBackgroundID new_bg)
         case AFFINE_BG_MAIN_MENU:
             REG_BG2CNT &= ~BG_AFF_32x32;
             REG_BG2CNT |= BG_AFF_16x16;
-            REG_IE |= IRQ_HBLANK; // Enable HBLANK
+            _high_quality = true;
 
             memcpy32_tile8_with_palette_offset(
                 (u32*)&tile8_mem[AFFINE_BG_CBB],
@@ -99,7 +166,7 @@ void affine_background_change_background(enum AffineBackgroundID new_bg)
         case AFFINE_BG_GAME:
             REG_BG2CNT &= ~BG_AFF_16x16;
             REG_BG2CNT |= BG_AFF_32x32;
-            REG_IE &= ~IRQ_HBLANK; // Disable HBLANK
+            _high_quality = false;
 
             memcpy32_tile8_with_palette_offset(
                 (u32*)&tile8_mem[AFFINE_BG_CBB],
@@ -112,31 +179,3 @@ void affine_background_change_background(enum AffineBackgroundID new_bg)
             break;
     }
 }
-
-static IWRAM_CODE void s_affine_background_prep_bgaff_arr()
-{
-    for (u16 vcount = 0; vcount < SCREEN_HEIGHT; vcount++)
-    {
-        const s32 timer_s32 = _timer << 8;
-        const s32 vcount_s32 = vcount << 8;
-        const s16 vcount_s16 = vcount;
-        const s32 vcount_sine = lu_sin(vcount_s32 + timer_s32 / ANIMATION_SPEED_DIVISOR);
-
-        _asx.scr_x = (SCREEN_WIDTH / 2);
-        // scr_y must equal vcount otherwise the background will have no vertical difference
-        _asx.scr_y = vcount_s16 - (SCREEN_HEIGHT / 2);
-        _asx.tex_x = (1000 * 1000) + (vcount_sine);
-        _asx.tex_y = (1000 * 1000);
-        _asx.sx = 128;
-        _asx.sy = 128;
-        _asx.alpha = vcount_sine + (timer_s32 / ANIMATION_SPEED_DIVISOR);
-
-        bg_rotscale_ex(&_bgaff_arr[vcount], &_asx);
-    }
-
-    /* HBLANK occurs after the scanline so REG_VCOUNT represents the
-     * the scanline that just passed, so when it's SCREEN_HEIGHT we will
-     * actually be updating the first line
-     */
-    _bgaff_arr[SCREEN_HEIGHT] = _bgaff_arr[0];
-}
@@ -0,0 +1,54 @@
+#include "affine_wave.h"
+
+// Index of a .16 angle in sin_lut
+#define SIN_LUT_IDX(angle) (((angle) >> 7) & 0x1FF)
+// sin_lut index of the cosine of the same angle
+#define COS_LUT_IDX(idx)   (((idx) + 128) & 0x1FF)
+
+#define SCALE 128
+
+IWRAM_CODE void affine_wave_prep_bgaff_arr(BG_AFFINE* bgaff_arr, uint timer)
+{
+    /* This used to be, for every scanline:
+     *     vcount_sine = lu_sin((vcount << 8) + timer_s32 / AFFINE_WAVE_SPEED_DIVISOR);
+     *     bg_rotscale_ex() of alpha = vcount_sine + timer_s32 / AFFINE_WAVE_SPEED_DIVISOR
+     * As vcount << 8 is a multiple of 128 it only adds 2 * vcount to the sin_lut index, so the
+     * wave is the sin_lut entry of (2 * vcount + phase) mod 512, see affine_wave_get_offset().
+     * The results are bit-identical, including the truncation of alpha to a u16 which
+     * SIN_LUT_IDX() does too.
+     */
+    const s32 time_angle = affine_wave_get_time_angle(timer);
+    const int phase = time_angle >> 7;
+
+    for (int vcount = 0; vcount < SCREEN_HEIGHT; vcount++)
+    {
+        const s32 vcount_sine = sin_lut[(2 * vcount + phase) & 0x1FF];
+        const int alpha_idx = SIN_LUT_IDX(vcount_sine + time_angle);
+        const s32 sina = sin_lut[alpha_idx];
+        const s32 cosa = sin_lut[COS_LUT_IDX(alpha_idx)];
+
+        // scr_y must equal vcount otherwise the background will have no vertical difference
+        const s32 scr_x = SCREEN_WIDTH / 2;
+        const s32 scr_y = vcount - (SCREEN_HEIGHT / 2);
+
+        // Same fixed point steps as bg_rotscale_ex()
+        const s32 pa = SCALE * cosa >> 12;
+        const s32 pb = -SCALE * sina >> 12;
+        const s32 pc = SCALE * sina >> 12;
+        const s32 pd = SCALE * cosa >> 12;
+
+        BG_AFFINE* bgaff = &bgaff_arr[vcount];
+        bgaff->pa = pa;
+        bgaff->pb = pb;
+        bgaff->pc = pc;
+        bgaff->pd = pd;
+        bgaff->dx = AFFINE_WAVE_TEX_POS + vcount_sine - (pa * scr_x + pb * scr_y);
+        bgaff->dy = AFFINE_WAVE_TEX_POS - (pc * scr_x + pd * scr_y);
+    }
+
+    /* HBLANK occurs after the scanline so REG_VCOUNT represents the
+     * the scanline that just passed, so when it's SCREEN_HEIGHT we will
+     * actually be updating the first line
+     */
+    bgaff_arr[SCREEN_HEIGHT] = bgaff_arr[0];
+}
@@ -42,9 +42,16 @@ int bitset_set_next_free_idx(Bitset* bitset)
         if (inv)
         {
             int bit = __builtin_ctz(inv);
-            bitset->w[i] |= ((uint32_t)1 << bit);
             int idx = i * BITSET_BITS_PER_WORD + bit;
-            return (idx < bitset->cap) ? idx : UNDEFINED;
+
+            // the last word can have free bits past the capacity, don't mark those as used
+            if (idx >= bitset->cap)
+            {
+                return UNDEFINED;
+            }
+
+            bitset->w[i] |= ((uint32_t)1 << bit);
+            return idx;
         }
     }
 
@@ -89,83 +96,146 @@ int bitset_num_set_bits(Bitset* bitset)
     return sum;
 }
 
+// Index of the nth set bit of a word that has more than n bits set
+static inline int s_word_find_idx_of_nth_set(uint32_t word, int n)
+{
+    // clear the n lowest set bits, the nth one is then the lowest
+    for (; n > 0; n--)
+    {
+        word &= word - 1;
+    }
+
+    return __builtin_ctz(word);
+}
+
 int bitset_find_idx_of_nth_set(const Bitset* bitset, int n)
 {
-    int tracker = 0;
-    int prev_tracker = 0;
+    if (n < 0)
+    {
+        return UNDEFINED;
+    }
+
+    // running popcount of the previous words
+    int prefix = 0;
 
     for (int i = 0; i < bitset->nwords; i++)
     {
-        tracker += __builtin_popcount(bitset->w[i]);
+        int word_set_bits = __builtin_popcount(bitset->w[i]);
 
-        if (tracker > n)
+        if (prefix + word_set_bits > n)
         {
-            // The index is here somewhere
-            // this one is to count the 1's not the offset, underflow to -1 is good for finding the
-            // 0 index
-            int base = prev_tracker - 1;
-            // this one is for the actual offset we want to map the id to
-            int offset = bitset->nbits * i;
-            for (int j = 0; j < bitset->nbits; j++)
-            {
-                if (base == n)
-                {
-                    return offset - 1;
-                }
-                base += (bitset->w[i] >> j) & 0x01;
-                offset++;
-            }
-
-            break;
+            return i * BITSET_BITS_PER_WORD + s_word_find_idx_of_nth_set(bitset->w[i], n - prefix);
         }
 
-        prev_tracker = tracker;
+        prefix += word_set_bits;
     }
 
     return UNDEFINED;
 }
 
-BitsetItr bitset_itr_create(const Bitset* bitset)
+static inline uint32_t s_common_nwords(const Bitset* a, const Bitset* b)
+{
+    return (a->nwords < b->nwords) ? a->nwords : b->nwords;
+}
+
+void bitset_or(Bitset* dst, const Bitset* src)
+{
+    uint32_t nwords = s_common_nwords(dst, src);
+
+    for (int i = 0; i < nwords; i++)
+    {
+        dst->w[i] |= src->w[i];
+    }
+}
+
+void bitset_and(Bitset* dst, const Bitset* src)
+{
+    uint32_t nwords = s_common_nwords(dst, src);
+
+    for (int i = 0; i < nwords; i++)
+    {
+        dst->w[i] &= src->w[i];
+    }
+
+    for (int i = nwords; i < dst->nwords; i++)
+    {
+        dst->w[i] = 0;
+    }
+}
+
+void bitset_andnot(Bitset* dst, const Bitset* src)
+{
+    uint32_t nwords = s_common_nwords(dst, src);
+
+    for (int i = 0; i < nwords; i++)
+    {
+        dst->w[i] &= ~src->w[i];
+    }
+}
+
+static BitsetItr s_itr_create(const Bitset* bitset, bool reverse, uint32_t invert)
 {
     BitsetItr itr = {
         .bitset = bitset,
-        .word = 0,
-        .bit = 0,
-        .itr = 0,
+        // one word out of range, bitset_itr_next() starts by loading the first word
+        .word = reverse ? bitset->nwords : -1,
+        .bits = 0,
+        .invert = invert,
+        .reverse = reverse,
     };
 
     return itr;
 }
 
+BitsetItr bitset_itr_create(const Bitset* bitset)
+{
+    return s_itr_create(bitset, false, 0);
+}
+
+BitsetItr bitset_itr_create_reverse(const Bitset* bitset)
+{
+    return s_itr_create(bitset, true, 0);
+}
+
+BitsetItr bitset_itr_create_unset(const Bitset* bitset)
+{
+    return s_itr_create(bitset, false, ~(uint32_t)0);
+}
+
+// Bits of a word to iterate on, without the ones past the capacity in the last word
+static uint32_t s_itr_word_bits(const BitsetItr* itr)
+{
+    const Bitset* bitset = itr->bitset;
+    uint32_t bits = bitset->w[itr->word] ^ itr->invert;
+
+    int word_cap = bitset->cap - itr->word * BITSET_BITS_PER_WORD;
+    if (word_cap < BITSET_BITS_PER_WORD)
+    {
+        bits &= ((uint32_t)1 << word_cap) - 1;
+    }
+
+    return bits;
+}
+
 int bitset_itr_next(BitsetItr* itr)
 {
-    // So, worst case scenario for this is one bit at the end of the last
-    // word in the bitset. You would look (32 * 7) + 31 times!
-    // This can be sped up with by checking if the word is empty first.
-    // Then the worst enemy of this method would be something like a set bit at the end
-    // of every word. In that case you would need to loop 31 times maximum.
-    // So one last thing you could do is something like `bitset_allocate_idx` does with the
-    // __builtin_ctz function as well.
-    //
-    // The point being, this can be very slow, but it's simple and can be much faster.
-    for (; itr->word < itr->bitset->nwords; itr->word++)
+    // skip the words without any bits left, they are a single test each
+    while (itr->bits == 0)
     {
-        for (; itr->bit < itr->bitset->nbits; itr->bit++)
+        int next_word = itr->reverse ? itr->word - 1 : itr->word + 1;
+        if (next_word < 0 || next_word >= itr->bitset->nwords)
         {
-            itr->itr++;
-            if (itr->bitset->w[itr->word] & (1 << itr->bit))
-            {
-                // if itr->bit == nbits on the next run, the for loop will handle it
-                itr->bit++;
-                // above we always make it one more than it is
-                // it's so we can return without mutating the actual iterator
-                // once it gets here. Just subtract one
-                return itr->itr - 1;
-            }
+            return UNDEFINED;
         }
-        itr->bit = 0;
+
+        itr->word = next_word;
+        itr->bits = s_itr_word_bits(itr);
     }
-    itr->word = 0;
 
-    return UNDEFINED;
+    // guarded by the loop above, __builtin_ctz(0) and __builtin_clz(0) are undefined
+    int bit = itr->reverse ? (BITSET_BITS_PER_WORD - 1) - __builtin_clz(itr->bits)
+                           : __builtin_ctz(itr->bits);
+    itr->bits &= ~((uint32_t)1 << bit);
+
+    return itr->word * BITSET_BITS_PER_WORD + bit;
 }
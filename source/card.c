@@ -1,7 +1,10 @@
 #include "card.h"
 
 #include "deck_gfx.h"
+#include "game.h"
 #include "graphic_utils.h"
+#include "tile_cache.h"
+#include "util.h"
 
 #include <maxmod.h>
 #include <stdlib.h>
@@ -19,9 +22,50 @@ const static u16 _card_sprite_lut[NUM_SUITS][NUM_RANKS] = {
     {624, 640, 656, 672, 688, 704, 720, 736, 752, 768, 784, 800, 816}
 };
 
+// The OBJ VRAM before JOKER_TID holds the tiles of this many cards
+#define CARD_TILE_SLOTS (MAX_HAND_SIZE + MAX_SELECTION_SIZE)
+
+// Keyed by s_card_tile_key(), the tiles of a card stay in VRAM after its sprites are destroyed so
+// the next sprite of the same suit and rank reuses them
+TILE_CACHE_DEFINE(_card_tile_cache, CARD_TILE_SLOTS)
+
+static int s_card_tile_key(const Card* card)
+{
+    return card->suit * NUM_RANKS + card->rank;
+}
+
+// Returns the tile index of the card's tiles in VRAM, copying them there if needed, or UNDEFINED
+// if every slot is in use
+static int s_card_tiles_acquire(const Card* card)
+{
+    bool upload;
+    int slot = tile_cache_acquire(&_card_tile_cache, s_card_tile_key(card), &upload);
+    if (slot == UNDEFINED)
+        return UNDEFINED;
+
+    int tile_index = CARD_TID + slot * CARD_SPRITE_OFFSET;
+    if (upload)
+    {
+        memcpy32(
+            &tile_mem[TILE_MEM_OBJ_CHARBLOCK0_IDX][tile_index],
+            &deck_gfxTiles[_card_sprite_lut[card->suit][card->rank] * TILE_SIZE],
+            TILE_SIZE * CARD_SPRITE_OFFSET
+        );
+    }
+
+    return tile_index;
+}
+
+static void s_card_tiles_release(int tile_index)
+{
+    tile_cache_release(&_card_tile_cache, (tile_index - CARD_TID) / CARD_SPRITE_OFFSET);
+}
+
 void card_init()
 {
     GRIT_CPY(&pal_obj_mem[CARD_PB], deck_gfxPal);
+
+    tile_cache_clear(&_card_tile_cache);
 }
 
 // Card methods
@@ -75,6 +119,7 @@ void card_object_destroy(CardObject** card_object)
 {
     if (*card_object == NULL)
         return;
+    card_object_destroy_sprite(*card_object);
     sprite_object_destroy(&((*card_object)->sprite_object));
     POOL_FREE(CardObject, *card_object);
     *card_object = NULL;
@@ -89,13 +134,12 @@ void card_object_update(CardObject* card_object)
 
 void card_object_set_sprite(CardObject* card_object, int layer)
 {
-    int tile_index = CARD_TID + (layer * CARD_SPRITE_OFFSET);
-    memcpy32(
-        &tile_mem[TILE_MEM_OBJ_CHARBLOCK0_IDX][tile_index],
-        &deck_gfxTiles
-            [_card_sprite_lut[card_object->card->suit][card_object->card->rank] * TILE_SIZE],
-        TILE_SIZE * CARD_SPRITE_OFFSET
-    );
+    card_object_destroy_sprite(card_object);
+
+    int tile_index = s_card_tiles_acquire(card_object->card);
+    if (tile_index == UNDEFINED)
+        return;
+
     Sprite* sprite = sprite_new(
         ATTR0_SQUARE | ATTR0_4BPP | ATTR0_AFF,
         ATTR1_SIZE_32,
@@ -103,9 +147,23 @@ void card_object_set_sprite(CardObject* card_object, int layer)
         0,
         layer + CARD_STARTING_LAYER
     );
+    if (sprite == NULL)
+    {
+        s_card_tiles_release(tile_index);
+    }
     sprite_object_set_sprite(card_object->sprite_object, sprite);
 }
 
+void card_object_destroy_sprite(CardObject* card_object)
+{
+    Sprite* sprite = card_object_get_sprite(card_object);
+    if (sprite == NULL)
+        return;
+
+    s_card_tiles_release(sprite_get_tid(sprite));
+    sprite_object_set_sprite(card_object->sprite_object, NULL);
+}
+
 void card_object_shake(CardObject* card_object, mm_word sound_id)
 {
     sprite_object_shake(card_object->sprite_object, sound_id);
@@ -131,3 +189,8 @@ Sprite* card_object_get_sprite(CardObject* card_object)
         return NULL;
     return sprite_object_get_sprite(card_object->sprite_object);
 }
+
+const TileCache* card_get_tile_cache(void)
+{
+    return &_card_tile_cache;
+}
@@ -13,20 +13,21 @@
 #include "graphic_utils.h"
 #include "hand_analysis.h"
 #include "joker.h"
-#include "list.h"
+#include "pool.h"
+#include "scoring.h"
 #include "selection_grid.h"
 #include "soundbank.h"
 #include "splash_screen.h"
 #include "sprite.h"
+#include "timeline.h"
 #include "tonc_memdef.h"
 #include "util.h"
+#include "vector.h"
 
 #include <maxmod.h>
 #include <stdint.h>
 #include <stdlib.h>
-
-#define STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS 4
-#define STRAIGHT_AND_FLUSH_SIZE_DEFAULT      5
+#include <string.h>
 
 // Pixel sizes
 #define ITEM_SHOP_Y               71
@@ -58,8 +59,6 @@
 #define BUTTON_SFX_VOLUME 154 // 60% of MM_FULL_VOLUME
 
 #define STARTING_ROUND 0
-#define STARTING_ANTE  1
-#define STARTING_MONEY 4
 #define STARTING_SCORE 0
 
 #define CARD_FOCUSED_UNSEL_Y 10
@@ -67,27 +66,27 @@
 #define CARD_FOCUSED_SEL_Y   20
 
 // Timer defs
-#define TM_ZERO                         0
-#define TM_RESET_STATIC_VARS            30
-#define TM_END_POP_MENU_ANIM            13
-#define TM_START_ROUND_END_REWARDS_ANIM 1
-#define TM_END_DISPLAY_FIN_BLIND        30
-#define TM_END_DISPLAY_SCORE_MIN        4
-#define TM_REWARDS_ELLIPSIS_PRINT_START 2
-#define TM_REWARDS_ELLIPSIS_PRINT_END   16
-#define TM_REWARD_DISPLAY_INTERVAL      15
-#define TM_DISPLAY_REWARDS_CONT_WAIT    (TM_REWARDS_ELLIPSIS_PRINT_END + TM_REWARD_DISPLAY_INTERVAL)
-#define TM_HAND_REWARD_INCR_WAIT        (TM_DISPLAY_REWARDS_CONT_WAIT + TM_REWARD_DISPLAY_INTERVAL)
-#define TM_REWARD_INCREMENT_INTERVAL    20
-#define TM_DISMISS_ROUND_END_TM         20
-#define TM_CREATE_SHOP_ITEMS_WAIT       1
-#define TM_SHIFT_SHOP_ICON_WAIT         7
-#define TM_END_GAME_SHOP_INTRO          12
-#define TM_SHOP_PRC_INPUT_START         1
-#define TM_DISP_BLIND_PANEL_FINISH      7
-#define TM_DISP_BLIND_PANEL_START       1
-#define TM_BLIND_SELECT_START           1
-#define TM_END_ANIM_SEQ                 12
+#define TM_ZERO 0
+
+// Frame counts of the animated sequences at normal game speed, see the TimelineStep tables
+#define TM_ROUND_END_START_WAIT      30
+#define TM_ROUND_END_POP_MENU_ANIM   13
+#define TM_DISPLAY_FIN_BLIND         30
+#define TM_DISPLAY_SCORE_MIN         4
+#define TM_TOP_LEFT_PANEL_ANIM       7
+#define TM_REWARDS_PANEL_WAIT        14
+#define TM_REWARDS_ELLIPSIS_LEN      14
+#define TM_REWARD_DISPLAY_INTERVAL   15
+#define TM_REWARD_INCREMENT_WAIT     25
+#define TM_REWARD_INCREMENT_INTERVAL 20
+#define TM_CASHOUT_BTN_WAIT          41
+#define TM_DISMISS_ROUND_END_PANEL   20
+#define TM_POP_MENU_ANIM             12
+#define TM_SHIFT_SHOP_ICON_WAIT      6
+#define TM_SHIFT_SHOP_ICON_ANIM      6
+#define TM_SHOP_LIGHTS_INTERVAL      20
+#define TM_BLIND_SELECTED_ANIM       14
+#define TM_BLIND_PANEL_ANIM          6
 
 // Palette IDs
 #define BOSS_BLIND_PRIMARY_PID               1
@@ -149,20 +148,6 @@ enum GameShopStates
     GAME_SHOP_MAX
 };
 
-enum GameRoundEndStates
-{
-    ROUND_END_START,
-    START_EXPAND_POPUP,
-    DISPLAY_FINISHED_BLIND,
-    DISPLAY_SCORE_MIN,
-    UPDATE_BLIND_REWARD,
-    BLIND_PANEL_EXIT,
-    DISPLAY_REWARDS,
-    DISPLAY_CASHOUT,
-    DISMISS_ROUND_END_PANEL,
-    ROUND_END_EXIT
-};
-
 enum BlindSelectStates
 {
     START_ANIM_SEQ,
@@ -172,12 +157,16 @@ enum BlindSelectStates
     BLIND_SELECT_MAX
 };
 
-typedef struct
+// Tracks of the timeline, the sequences of a state that play side by side
+enum GameTimelineTracks
 {
-    u32 chips;
-    u32 mult;
-    char* display_name;
-} HandValues;
+    TRACK_MAIN,
+    TRACK_SHOP_ICON,
+    TRACK_SHOP_LIGHTS
+};
+
+#define START_SEQUENCE(track, steps) \
+    timeline_start_track(&_timeline, track, steps, NUM_ELEM_IN_ARR(steps))
 
 // Used as a No Operation for game states that have no init and/or exit function.
 // ricfehr3 did the work of determining whether a noop or a NULL check was more
@@ -198,8 +187,10 @@ static void game_main_menu_on_init(void);
 static void game_main_menu_on_update(void);
 static void game_round_on_init(void);
 static void game_playing_on_update(void);
+static void game_round_end_on_init(void);
 static void game_round_end_on_update(void);
 static void game_round_end_on_exit(void);
+static void game_shop_on_init(void);
 static void game_shop_on_update(void);
 static void game_shop_on_exit(void);
 static void game_blind_select_on_init(void);
@@ -210,22 +201,6 @@ static void game_lose_on_update(void);
 static void game_over_on_exit(void);
 static void game_win_on_init(void);
 static void game_win_on_update(void);
-static void game_shop_intro(void);
-static void game_shop_process_user_input(void);
-static void game_shop_outro(void);
-static void game_blind_select_start_anim_seq(void);
-static void game_blind_select_handle_input(void);
-static void game_blind_select_selected_anim_seq(void);
-static void game_blind_select_display_blind_panel(void);
-static void game_round_end_start(void);
-static void game_round_end_start_expand_popup(void);
-static void game_round_end_display_finished_blind(void);
-static void game_round_end_display_score_min(void);
-static void game_round_end_update_blind_reward(void);
-static void game_round_end_panel_exit(void);
-static void game_round_end_display_rewards(void);
-static void game_round_end_display_cashout(void);
-static void game_round_end_dismiss_round_end_panel(void);
 
 static void sort_cards(void);
 static void change_background(enum BackgroundId id);
@@ -242,12 +217,7 @@ static int deck_get_size(void);
 static int deck_get_max_size(void);
 static void increment_blind(enum BlindState increment_reason);
 static void game_over_init(void);
-static bool check_and_score_joker_for_event(
-    ListItr* starting_joker_itr,
-    CardObject* card_object,
-    enum JokerEvent joker_event
-);
-static int calculate_interest_reward(void);
+static void owned_jokers_on_change(void);
 static void game_over_anim_frame(void);
 static void shop_reroll_row_on_key_transit(SelectionGrid* selection_grid, Selection* selection);
 static void shop_reroll_row_on_selection_changed(
@@ -274,11 +244,11 @@ static void jokers_sel_row_on_selection_changed(
 );
 static int jokers_sel_row_get_size(void);
 static void game_shop_create_items(void);
+static void game_shop_start_outro(void);
 static void erase_price_under_sprite_object(SpriteObject* sprite_object);
 static void print_price_under_sprite_object(SpriteObject* sprite_object, int price);
 static void game_round_end_extend_black_panel_down(int black_panel_bottom);
 
-static void remove_owned_joker(int owned_joker_idx);
 // Consts
 
 // clang-format off
@@ -381,12 +351,13 @@ static const BG_POINT MAIN_MENU_ACE_T       = {88,      26};
 
 static uint rng_seed = 0;
 
-typedef void (*SubStateActionFn)(void);
-
 static uint timer = 0; // This might already exist in libtonc but idk so i'm just making my own
 // BY DEFAULT IS SET TO 1, but if changed to 2 or more, should speed up all (or most) of the game
 // aspects that should be sped up by speed, as in the original game.
 static int game_speed = 1;
+// Plays the animated sequences of the current state, restarted on every state change
+static Timeline _timeline;
+static bool skip_scoring_animation = false;
 static enum BackgroundId background = BG_NONE;
 
 static StateInfo state_info[] = {
@@ -414,48 +385,6 @@ SelectionGrid shop_selection_grid = {
 static const int HAND_SPACING_LUT[MAX_HAND_SIZE] =
     {28, 28, 28, 28, 27, 21, 18, 15, 13, 12, 10, 9, 9, 8, 8, 7};
 
-static const HandValues hand_base_values[] = {
-    {.chips = 0,   .mult = 0,  .display_name = NULL     }, // NONE
-    {.chips = 5,   .mult = 1,  .display_name = "HIGH C" }, // HIGH_CARD
-    {.chips = 10,  .mult = 2,  .display_name = "PAIR"   }, // PAIR
-    {.chips = 20,  .mult = 2,  .display_name = "2 PAIR" }, // TWO_PAIR
-    {.chips = 30,  .mult = 3,  .display_name = "3 OAK"  }, // THREE_OF_A_KIND
-    {.chips = 60,  .mult = 7,  .display_name = "4 OAK"  }, // FOUR_OF_A_KIND
-    {.chips = 30,  .mult = 4,  .display_name = "STRT"   }, // STRAIGHT
-    {.chips = 35,  .mult = 4,  .display_name = "FLUSH"  }, // FLUSH
-    {.chips = 40,  .mult = 4,  .display_name = "FULL H" }, // FULL_HOUSE
-    {.chips = 100, .mult = 8,  .display_name = "STRT F" }, // STRAIGHT_FLUSH
-    {.chips = 100, .mult = 8,  .display_name = "ROYAL F"}, // ROYAL_FLUSH
-    {.chips = 120, .mult = 12, .display_name = "5 OAK"  }, // FIVE_OF_A_KIND
-    {.chips = 140, .mult = 14, .display_name = "FLUSH H"}, // FLUSH_HOUSE
-    {.chips = 160, .mult = 16, .display_name = "FLUSH 5"}  // FLUSH_FIVE
-};
-
-static const SubStateActionFn shop_state_actions[] = {
-    game_shop_intro,
-    game_shop_process_user_input,
-    game_shop_outro
-};
-
-static const SubStateActionFn blind_select_state_actions[] = {
-    game_blind_select_start_anim_seq,
-    game_blind_select_handle_input,
-    game_blind_select_selected_anim_seq,
-    game_blind_select_display_blind_panel
-};
-
-static const SubStateActionFn round_end_state_actions[] = {
-    game_round_end_start,
-    game_round_end_start_expand_popup,
-    game_round_end_display_finished_blind,
-    game_round_end_display_score_min,
-    game_round_end_update_blind_reward,
-    game_round_end_panel_exit,
-    game_round_end_display_rewards,
-    game_round_end_display_cashout,
-    game_round_end_dismiss_round_end_panel
-};
-
 static int reroll_cost = REROLL_BASE_COST;
 
 // The current game state, this is used to determine what the game is doing at any given time
@@ -490,11 +419,10 @@ static int blind_reward = 0;
 static int hand_reward = 0;
 static int interest_reward = 0;
 static int interest_to_count = 0;
-static int interest_start_time = UNDEFINED;
 
 // Red deck default (can later be moved to a deck.h file or something)
-static int max_hands = 4;
-static int max_discards = 4;
+static int max_hands = DEFAULT_MAX_HANDS;
+static int max_discards = DEFAULT_MAX_DISCARDS;
 // Set in game_init and game_round_init
 static int hands = 0;
 static int discards = 0;
@@ -510,12 +438,16 @@ static FIXED lerped_temp_score = 0;
 
 static u32 chips = 0;
 static u32 mult = 0;
-static bool retrigger = false;
 
-static int hand_size = 8; // Default hand size is 8
+static int hand_size = DEFAULT_HAND_SIZE;
 static int cards_drawn = 0;
 static int hand_selections = 0;
 
+// Rank and suit counts of the selected cards in hand, kept up to date along with hand_selections
+// so classifying the selection does not rescan the hand
+static u8 _selected_ranks[NUM_RANKS] = {0};
+static u8 _selected_suits[NUM_SUITS] = {0};
+
 // Keeping track of cards scored
 static int scored_card_index = 0;
 
@@ -523,22 +455,30 @@ static int scored_card_index = 0;
 static bool sound_played = false;
 static bool discarded_card = false;
 
-// Keeping track of what Jokers are scored at each step
-static ListItr _joker_scored_itr;
-static ListItr _joker_card_scored_end_itr;
-static ListItr _joker_round_end_itr;
+// The result of the hand being played, computed when the hand is played
+// and then played back step by step by the PLAY_* states
+EWRAM_BSS static ScoreResult _score_result;
+static int _score_step_idx = 0;
+static int _money_before_scoring = 0;
+// Whether the played hand beats the blind or was the last hand, known as soon as it is scored
+static bool _hand_ends_round = false;
+// Set when the scoring animation of the played hand is skipped
+static bool _skip_hand_scoring = false;
 
 static int selection_x = 0;
 static int selection_y = 0;
 
 static bool sort_by_suit = false;
 
-static List _owned_jokers_list;
-static List _discarded_jokers_list;
-static List _expired_jokers_list;
+VECTOR_DEFINE(_owned_jokers_list, MAX_JOKERS_HELD_SIZE)
+// Kept in sync with _owned_jokers_list by owned_jokers_on_change()
+static JokerEventIndex _owned_jokers_event_index;
+// Every JokerObject can be discarded at once, the owned ones and the shop's
+VECTOR_DEFINE(_discarded_jokers_list, MAX_ACTIVE_JOKERS)
+VECTOR_DEFINE(_expired_jokers_list, MAX_JOKERS_HELD_SIZE)
 
 BITSET_DEFINE(_avail_jokers_bitset, MAX_DEFINABLE_JOKERS)
-static List _shop_jokers_list;
+VECTOR_DEFINE(_shop_jokers_list, MAX_SHOP_JOKERS)
 
 // Stacks
 static CardObject* played[MAX_SELECTION_SIZE] = {NULL};
@@ -553,11 +493,8 @@ static int deck_top = -1;
 static Card* discard_pile[MAX_DECK_SIZE] = {NULL};
 static int discard_top = -1;
 
-// Joker Special Variables
-static int shortcut_joker_count = 0;
-
-static int four_fingers_joker_count = 0;
-static int straight_and_flush_size = STRAIGHT_AND_FLUSH_SIZE_DEFAULT;
+// Number of owned copies of each Joker ID, so checking for a Joker does not walk the owned list
+static u8 _owned_joker_counts[MAX_DEFINABLE_JOKERS] = {0};
 
 GBAL_UNUSED
 static inline bool is_shop_joker_avail(int joker_id)
@@ -640,12 +577,12 @@ static inline void jokers_available_to_shop_init(void)
 void game_init()
 {
     // Initialize all jokers list once
-    _owned_jokers_list = list_create();
-    _discarded_jokers_list = list_create();
-    _expired_jokers_list = list_create();
-    _shop_jokers_list = list_create();
-    // TODO: Move this to an initialization of the play scoring states
-    _joker_scored_itr = list_itr_create(&_owned_jokers_list);
+    vector_clear(&_owned_jokers_list);
+    memset(_owned_joker_counts, 0, sizeof(_owned_joker_counts));
+    owned_jokers_on_change();
+    vector_clear(&_discarded_jokers_list);
+    vector_clear(&_expired_jokers_list);
+    vector_clear(&_shop_jokers_list);
 
     jokers_available_to_shop_init();
 
@@ -679,28 +616,28 @@ void game_init()
         MAX_SELECTION_SIZE + MAX_HAND_SIZE + 5
     );
 
-    obj_hide(blind_select_tokens[BLIND_TYPE_SMALL]->obj);
-    obj_hide(blind_select_tokens[BLIND_TYPE_BIG]->obj);
-    obj_hide(blind_select_tokens[BLIND_TYPE_BOSS]->obj);
+    sprite_hide(blind_select_tokens[BLIND_TYPE_SMALL]);
+    sprite_hide(blind_select_tokens[BLIND_TYPE_BIG]);
+    sprite_hide(blind_select_tokens[BLIND_TYPE_BOSS]);
 }
 
 static inline void discarded_jokers_update_loop(void)
 {
-    if (list_is_empty(&_discarded_jokers_list))
+    if (vector_is_empty(&_discarded_jokers_list))
     {
         return;
     }
 
-    ListItr itr = list_itr_create(&_discarded_jokers_list);
+    VectorItr itr = vector_itr_create(&_discarded_jokers_list);
     JokerObject* joker_object;
 
-    while ((joker_object = list_itr_next(&itr)))
+    while ((joker_object = vector_itr_next(&itr)))
     {
         joker_object_update(joker_object);
         if (joker_object->sprite_object->x == joker_object->sprite_object->tx &&
             joker_object->sprite_object->y == joker_object->sprite_object->ty)
         {
-            list_itr_remove_current_node(&itr);
+            vector_itr_remove_current(&itr);
             joker_object_destroy(&joker_object);
         }
     }
@@ -718,11 +655,11 @@ static inline void held_jokers_update_loop(void)
 
     FIXED hand_x = int2fx(HELD_JOKERS_POS.x);
 
-    ListItr itr = list_itr_create(&_owned_jokers_list);
+    VectorItr itr = vector_itr_create(&_owned_jokers_list);
     JokerObject* joker;
-    int jokers_top = list_get_len(&_owned_jokers_list) - 1;
+    int jokers_top = vector_get_len(&_owned_jokers_list) - 1;
     int i = 0;
-    while ((joker = list_itr_next(&itr)))
+    while ((joker = vector_itr_next(&itr)))
     {
         joker->sprite_object->tx = hand_x - int2fx(spacing_lut[jokers_top][i++]);
 
@@ -732,36 +669,29 @@ static inline void held_jokers_update_loop(void)
 
 static inline void expired_jokers_update_loop(void)
 {
-    if (list_is_empty(&_expired_jokers_list))
+    if (vector_is_empty(&_expired_jokers_list))
     {
         return;
     }
 
-    ListItr itr = list_itr_create(&_expired_jokers_list);
+    VectorItr itr = vector_itr_create(&_expired_jokers_list);
     JokerObject* joker_object;
 
-    while ((joker_object = list_itr_next(&itr)))
+    while ((joker_object = vector_itr_next(&itr)))
     {
         joker_object_update(joker_object);
 
         // let just enough frames pass that we see it rotating and shrinking
         if (timer % FRAMES(EXPIRE_ANIMATION_FRAME_COUNT) == 0)
         {
-            // get joker idx
-            int expired_joker_idx = 0;
-            ListItr joker_itr = list_itr_create(&_owned_jokers_list);
-            JokerObject* expired_joker;
-            while ((expired_joker = list_itr_next(&joker_itr)) && expired_joker != joker_object)
-            {
-                expired_joker_idx++;
-            }
+            int expired_joker_idx = vector_find(&_owned_jokers_list, joker_object);
 
             // Removing expired Jokers here, instead of immediately like ones we
             // sell or discard allow us to have a small shrink animation without
             // the other owned Jokers rearranging themselves to fill the newly
             // freed space, therefore obscuring the animation
             remove_owned_joker(expired_joker_idx);
-            list_itr_remove_current_node(&itr);
+            vector_itr_remove_current(&itr);
             joker_object_destroy(&joker_object);
         }
     }
@@ -786,6 +716,7 @@ void game_update()
 void game_change_state(enum GameState new_game_state)
 {
     timer = TM_ZERO; // Reset the timer
+    timeline_init(&_timeline, game_speed);
 
     if (game_state >= 0 && game_state < GAME_STATE_MAX)
     {
@@ -826,24 +757,9 @@ int get_played_top(void)
     return played_top;
 }
 
-int get_scored_card_index(void)
-{
-    return scored_card_index;
-}
-
 bool is_joker_owned(int joker_id)
 {
-    ListItr itr = list_itr_create(&_owned_jokers_list);
-    JokerObject* joker;
-
-    while ((joker = list_itr_next(&itr)))
-    {
-        if (joker->joker->id == joker_id)
-        {
-            return true;
-        }
-    }
-    return false;
+    return _owned_joker_counts[joker_id] > 0;
 }
 
 bool card_is_face(Card* card)
@@ -855,70 +771,53 @@ bool card_is_face(Card* card)
     );
 }
 
-List* get_jokers_list(void)
+Vector* get_jokers_list(void)
 {
     return &_owned_jokers_list;
 }
 
-List* get_expired_jokers_list(void)
+const JokerEventIndex* get_jokers_event_index(void)
+{
+    return &_owned_jokers_event_index;
+}
+
+Vector* get_expired_jokers_list(void)
 {
     return &_expired_jokers_list;
 }
 
 bool is_shortcut_joker_active(void)
 {
-    return shortcut_joker_count > 0;
+    return is_joker_owned(SHORTCUT_JOKER_ID);
 }
 
 int get_straight_and_flush_size(void)
 {
-    return straight_and_flush_size;
+    return is_joker_owned(FOUR_FINGERS_JOKER_ID) ? STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS
+                                                 : STRAIGHT_AND_FLUSH_SIZE_DEFAULT;
 }
 
-static void add_joker(JokerObject* joker_object)
+// Must be called after every change to the owned Jokers or their order
+static void owned_jokers_on_change(void)
 {
-    list_push_back(&_owned_jokers_list, joker_object);
-
-    // TODO: Extract to on_joker_added() callback
-    // In case the player gets multiple Four Fingers Jokers,
-    // only change size when the first one is added
-    if (joker_object->joker->id == FOUR_FINGERS_JOKER_ID)
-    {
-        if (four_fingers_joker_count == 0)
-        {
-            straight_and_flush_size = STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS;
-        }
-        four_fingers_joker_count++;
-    }
-
-    if (joker_object->joker->id == SHORTCUT_JOKER_ID)
-    {
-        shortcut_joker_count++;
-    }
+    joker_event_index_build(&_owned_jokers_event_index, &_owned_jokers_list);
 }
 
-static void remove_owned_joker(int owned_joker_idx)
+void add_joker(JokerObject* joker_object)
 {
-    // TODO: Extract to on_joker_removed() callback
-    JokerObject* joker_object = list_get_at_idx(&_owned_jokers_list, owned_joker_idx);
-    // In case the player gets multiple Four Fingers Jokers,
-    // and only reset the size when all of them have been removed
-    if (joker_object->joker->id == FOUR_FINGERS_JOKER_ID)
-    {
-        four_fingers_joker_count--;
-        if (four_fingers_joker_count == 0)
-        {
-            straight_and_flush_size = STRAIGHT_AND_FLUSH_SIZE_DEFAULT;
-        }
-    }
+    vector_push_back(&_owned_jokers_list, joker_object);
+    _owned_joker_counts[joker_object->joker->id]++;
+    owned_jokers_on_change();
+}
 
-    if (joker_object->joker->id == SHORTCUT_JOKER_ID)
-    {
-        shortcut_joker_count--;
-    }
+void remove_owned_joker(int owned_joker_idx)
+{
+    JokerObject* joker_object = vector_get_at_idx(&_owned_jokers_list, owned_joker_idx);
+    _owned_joker_counts[joker_object->joker->id]--;
 
     set_shop_joker_avail(joker_object->joker->id, true);
-    list_remove_at_idx(&_owned_jokers_list, owned_joker_idx);
+    vector_remove_at_idx(&_owned_jokers_list, owned_joker_idx);
+    owned_jokers_on_change();
 }
 
 int get_deck_top(void)
@@ -945,6 +844,17 @@ int get_game_speed(void)
 void set_game_speed(int new_game_speed)
 {
     game_speed = new_game_speed;
+    timeline_set_speed(&_timeline, new_game_speed);
+}
+
+bool get_skip_scoring_animation(void)
+{
+    return skip_scoring_animation;
+}
+
+void set_skip_scoring_animation(bool skip)
+{
+    skip_scoring_animation = skip;
 }
 
 u32 get_chips(void)
@@ -977,11 +887,6 @@ void set_money(int new_money)
     money = new_money;
 }
 
-void set_retrigger(bool new_retrigger)
-{
-    retrigger = new_retrigger;
-}
-
 void display_money()
 {
     Rect money_text_rect = MONEY_TEXT_RECT;
@@ -1127,8 +1032,9 @@ static inline bool shift_null_card_to_end(int null_card_idx)
 
 static void reorder_card_sprites_layers(void)
 {
-    // Update the sprites in the hand by destroying them and creating new ones in the correct order
-    // (This feels like a diabolical solution but like literally how else would you do this)
+    Sprite* sprites[MAX_HAND_SIZE] = {NULL};
+    int num_cards = 0;
+
     for (int i = 0; i <= hand_top; i++)
     {
         // a NULL card will only happen if we rearrange the sprites without having sorted them
@@ -1141,24 +1047,36 @@ static void reorder_card_sprites_layers(void)
             }
         }
 
-        // card_object_get_sprite() will not work here since we need the address
-        sprite_destroy(&(hand[i]->sprite_object->sprite));
+        sprites[i] = card_object_get_sprite(hand[i]);
+        num_cards = i + 1;
     }
 
-    // Recreate the sprites for the remaining non NULL cards, in order
-    for (int i = 0; i <= hand_top; i++)
+    // Sprites are drawn in OAM order, so the cards only have to move to the OAM entries of their
+    // new positions in the hand. Their tiles and affine matrices stay where they are.
+    if (!sprite_reorder(sprites, num_cards, CARD_STARTING_LAYER))
     {
-        if (hand[i] != NULL)
+        // Another sprite is in the way, fall back to giving every card a new sprite
+        for (int i = 0; i < num_cards; i++)
         {
-            // Set the sprite for the card object
-            card_object_set_sprite(hand[i], i);
-            sprite_position(
-                card_object_get_sprite(hand[i]),
-                fx2int(hand[i]->sprite_object->x),
-                fx2int(hand[i]->sprite_object->y)
-            );
+            if (hand[i] != NULL)
+                card_object_destroy_sprite(hand[i]);
+            sprites[i] = NULL;
         }
     }
+
+    // Cards that were just drawn get a sprite
+    for (int i = 0; i < num_cards; i++)
+    {
+        if (sprites[i] != NULL || hand[i] == NULL)
+            continue;
+
+        card_object_set_sprite(hand[i], i);
+        sprite_position(
+            card_object_get_sprite(hand[i]),
+            fx2int(hand[i]->sprite_object->x),
+            fx2int(hand[i]->sprite_object->y)
+        );
+    }
 }
 
 static void sort_cards(void)
@@ -1324,7 +1242,7 @@ static void change_background(enum BackgroundId id)
     {
         for (int i = 0; i < BLIND_TYPE_MAX; i++)
         {
-            obj_unhide(blind_select_tokens[i]->obj, 0);
+            sprite_unhide(blind_select_tokens[i], 0);
         }
 
         // Default y position for the blind select tokens. 12 is the amount of tiles the background
@@ -1606,95 +1524,33 @@ static void display_discards(int value)
     );
 }
 
-static inline enum HandType hand_get_type(void)
+static void hand_set_card_selected(CardObject* card_object, bool selected)
 {
-    enum HandType res_hand_type = NONE;
-
-    // Idk if this is how Balatro does it but this is how I'm doing it
-    if (hand_selections == 0 || hand_state == HAND_DISCARD)
-    {
-        res_hand_type = NONE;
-        return res_hand_type;
-    }
-
-    res_hand_type = HIGH_CARD;
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_hand_distribution(ranks, suits);
-
-    // Check for flush
-    if (hand_contains_flush(suits))
-        res_hand_type = FLUSH;
-
-    // Check for straight
-    if (hand_contains_straight(ranks))
-    {
-        if (res_hand_type == FLUSH)
-            res_hand_type = STRAIGHT_FLUSH;
-        else
-            res_hand_type = STRAIGHT;
-    }
-
-    // The following can be optimized better but not sure how much it matters
-    u8 n_of_a_kind = hand_contains_n_of_a_kind(ranks);
-
-    if (n_of_a_kind >= 5)
-    {
-        if (res_hand_type == FLUSH)
-        {
-            return FLUSH_FIVE;
-        }
-        return FIVE_OF_A_KIND;
-    }
-
-    // Check for royal flush vs regular straight flush
-    if (res_hand_type == STRAIGHT_FLUSH)
-    {
-        if (ranks[TEN] && ranks[JACK] && ranks[QUEEN] && ranks[KING] && ranks[ACE])
-            return ROYAL_FLUSH;
-        return STRAIGHT_FLUSH;
-    }
-
-    if (n_of_a_kind == 4)
-    {
-        return FOUR_OF_A_KIND;
-    }
-
-    if (n_of_a_kind == 3 && hand_contains_full_house(ranks))
-    {
-        return FULL_HOUSE;
-    }
+    card_object_set_selected(card_object, selected);
 
-    // Flush and Straight are more valuable than the remaining hand types, so return them now
-    if (res_hand_type == FLUSH)
-    {
-        if (n_of_a_kind >= 5)
-        {
-            return FLUSH_HOUSE;
-        }
-        return FLUSH;
-    }
-    if (res_hand_type == STRAIGHT)
-    {
-        return STRAIGHT;
-    }
+    int delta = selected ? 1 : -1;
+    hand_selections += delta;
+    _selected_ranks[card_object->card->rank] += delta;
+    _selected_suits[card_object->card->suit] += delta;
+}
 
-    if (n_of_a_kind == 3)
-    {
-        return THREE_OF_A_KIND;
-    }
+// For when the selected cards have left the hand
+static void hand_clear_selections(void)
+{
+    hand_selections = 0;
+    memset(_selected_ranks, 0, sizeof(_selected_ranks));
+    memset(_selected_suits, 0, sizeof(_selected_suits));
+}
 
-    if (n_of_a_kind == 2)
+static inline enum HandType hand_get_type(void)
+{
+    // Idk if this is how Balatro does it but this is how I'm doing it
+    if (hand_selections == 0 || hand_state == HAND_DISCARD)
     {
-        if (hand_contains_two_pair(ranks))
-        {
-            return TWO_PAIR;
-        }
-        return PAIR;
+        return NONE;
     }
 
-    return res_hand_type; // should be HIGH_CARD
+    return hand_get_type_from_distribution(_selected_ranks, _selected_suits);
 }
 
 static void print_hand_type(const char* hand_type_str)
@@ -1715,12 +1571,12 @@ static void set_hand(void)
     tte_erase_rect_wrapper(HAND_TYPE_RECT);
     hand_type = hand_get_type();
 
-    HandValues hand = hand_base_values[hand_type];
+    const HandValues* hand = score_get_hand_base_values(hand_type);
 
-    chips = hand.chips;
-    mult = hand.mult;
+    chips = hand->chips;
+    mult = hand->mult;
 
-    print_hand_type(hand.display_name);
+    print_hand_type(hand->display_name);
     display_chips();
     display_mult();
 }
@@ -1801,7 +1657,7 @@ static void game_round_on_init()
 {
     hand_state = HAND_DRAW;
     cards_drawn = 0;
-    hand_selections = 0;
+    hand_clear_selections();
 
     playing_blind_token = blind_token_new(
         current_blind,
@@ -1823,7 +1679,7 @@ static void game_round_on_init()
 
     if (round_end_blind_token != NULL)
     {
-        obj_hide(round_end_blind_token->obj); // Hide the blind token sprite for now
+        sprite_hide(round_end_blind_token); // Hide the blind token sprite for now
     }
 
     Rect blind_req_text_rect = BLIND_REQ_TEXT_RECT;
@@ -1866,6 +1722,7 @@ static void game_main_menu_on_init()
     card_object_set_sprite(main_menu_ace, 0); // Set the sprite for the ace of spades
     main_menu_ace->sprite_object->sprite->obj->attr0 |=
         ATTR0_AFF_DBL; // Make the sprite double sized
+    sprite_mark_dirty(main_menu_ace->sprite_object->sprite);
     main_menu_ace->sprite_object->tx = int2fx(MAIN_MENU_ACE_T.x);
     main_menu_ace->sprite_object->x = main_menu_ace->sprite_object->tx;
     main_menu_ace->sprite_object->ty = int2fx(MAIN_MENU_ACE_T.y);
@@ -1909,14 +1766,12 @@ static inline void hand_toggle_card_selection(void)
 
     if (card_object_is_selected(hand[selection_x]))
     {
-        card_object_set_selected(hand[selection_x], false);
-        hand_selections--;
+        hand_set_card_selected(hand[selection_x], false);
         play_sfx(SFX_CARD_DESELECT, MM_BASE_PITCH_RATE, SFX_DEFAULT_VOLUME);
     }
     else if (hand_selections < MAX_SELECTION_SIZE)
     {
-        card_object_set_selected(hand[selection_x], true);
-        hand_selections++;
+        hand_set_card_selected(hand[selection_x], true);
         play_sfx(SFX_CARD_SELECT, MM_BASE_PITCH_RATE, SFX_DEFAULT_VOLUME);
     }
 }
@@ -1928,8 +1783,7 @@ static void hand_deselect_all_cards(void)
     {
         if (card_object_is_selected(hand[i]))
         {
-            card_object_set_selected(hand[i], false);
-            hand_selections--;
+            hand_set_card_selected(hand[i], false);
             any_cards_deselected = true;
         }
     }
@@ -2260,9 +2114,6 @@ static inline void card_in_hand_loop_handle_discard_and_shuffling(
                 cards_drawn++;
                 sound_played = false;
                 timer = TM_ZERO;
-
-                *hand_y = hand[card_idx]->sprite_object->y;
-                *hand_x = hand[card_idx]->sprite_object->x;
             }
 
             discarded_card = true;
@@ -2294,234 +2145,125 @@ static inline void card_in_hand_loop_handle_discard_and_shuffling(
         hand_state = HAND_DRAW;
         sound_played = false;
         cards_drawn = 0;
-        hand_selections = 0;
+        hand_clear_selections();
         timer = TM_ZERO;
         *break_loop = true;
         return;
     };
 }
 
-static inline void select_flush_and_straight_cards_in_played_hand(void)
+static inline void game_playing_score_played_hand(void)
 {
-    // Special handling because Four Fingers might be active
-    bool final_selection[MAX_SELECTION_SIZE] = {false};
-
-    // Will be 4 if Four Fingers is in effect, otherwise 5
-    int min_len = get_straight_and_flush_size();
+    ScoreContext score_ctx = {
+        .hands_remaining = hands,
+        .discards_remaining = discards,
+        .deck_size = deck_top + 1,
+        .money = money,
+    };
 
-    // if we have a flush in our hand
-    if (hand_type == FLUSH || hand_type == STRAIGHT_FLUSH || hand_type == ROYAL_FLUSH)
-    {
-        bool flush_selection[MAX_HAND_SIZE] = {false};
-        find_flush_in_played_cards(played, played_top, min_len, flush_selection);
-        // Add the results into the final selection
-        for (int i = 0; i <= played_top; i++)
-        {
-            final_selection[i] = flush_selection[i];
-        }
-    }
+    score_hand(
+        played,
+        played_top + 1,
+        hand,
+        hand_top + 1,
+        &_owned_jokers_list,
+        &_owned_jokers_event_index,
+        &score_ctx,
+        &_score_result
+    );
+    _score_step_idx = 0;
+    _money_before_scoring = money;
+    _skip_hand_scoring = skip_scoring_animation;
 
-    // If we have a straight in our hand
-    if (hand_type == STRAIGHT || hand_type == STRAIGHT_FLUSH || hand_type == ROYAL_FLUSH)
-    {
-        bool straight_selection[MAX_HAND_SIZE] = {false};
-        find_straight_in_played_cards(
-            played,
-            played_top,
-            is_shortcut_joker_active(),
-            min_len,
-            straight_selection
-        );
-        // Add the results into the final selection
-        for (int i = 0; i <= played_top; i++)
-        {
-            final_selection[i] = final_selection[i] || straight_selection[i];
-        }
-        // If Four Fingers is active, pairs can happen in a valid straight
-        // If Four Fingers is not active, pairs are impossible so this will not affect things
-        select_paired_cards_in_hand(played, played_top, final_selection);
-    }
+    // The score is only added once the animation is done, but the outcome is already known
+    u32 requirement = blind_get_requirement(current_blind, ante);
+    _hand_ends_round = hands == 0 || u32_protected_add(score, _score_result.score) >= requirement;
 
-    // Finally, set mark the cards as selected based final_selection
+    // select the cards that apply to the hand type
     for (int i = 0; i <= played_top; i++)
     {
-        if (final_selection[i])
-        {
-            card_object_set_selected(played[i], true);
-        }
+        card_object_set_selected(played[i], _score_result.scoring_cards[i]);
     }
 }
 
-static inline void select_all_five_cards_in_played_hand(void)
+// Returns the next recorded step if it is a Joker step for one of the given events, NULL otherwise
+static inline const ScoreStep* score_step_peek_joker_event(
+    enum JokerEvent joker_event,
+    enum JokerEvent alt_joker_event
+)
 {
-    for (int i = 0; i <= played_top; i++)
+    if (_score_step_idx >= _score_result.num_steps)
     {
-        card_object_set_selected(played[i], true);
+        return NULL;
     }
-}
-
-static inline void select_four_of_a_kind_cards_in_played_hand(void)
-{
-    // find four cards with the same rank
-    // If there are 5 cards selected we just need to find the one card that doesn't match, and
-    // select the others
-    if (played_top >= 3)
-    {
-        int unmatched_index = -1;
-
-        for (int i = 0; i <= played_top; i++)
-        {
-            if (played[i]->card->rank != played[(i + 1) % played_top]->card->rank &&
-                played[i]->card->rank != played[(i + 2) % played_top]->card->rank)
-            {
-                unmatched_index = i;
-                break;
-            }
-        }
 
-        for (int i = 0; i <= played_top; i++)
-        {
-            if (i != unmatched_index)
-            {
-                card_object_set_selected(played[i], true);
-            }
-        }
-    }
-    else // If there are only 4 cards selected we know they match
+    const ScoreStep* step = &_score_result.steps[_score_step_idx];
+    if (step->type != SCORE_STEP_JOKER ||
+        (step->joker_event != joker_event && step->joker_event != alt_joker_event))
     {
-        for (int i = 0; i <= played_top; i++)
-        {
-            card_object_set_selected(played[i], true);
-        }
+        return NULL;
     }
-}
-
-static inline void select_three_of_a_kind_cards_in_played_hand(void)
-{
-    // find three cards with the same rank
-    for (int i = 0; i <= played_top - 1; i++)
-    {
-        for (int j = i + 1; j <= played_top; j++)
-        {
-            if (played[i]->card->rank == played[j]->card->rank)
-            {
-                card_object_set_selected(played[i], true);
-                card_object_set_selected(played[j], true);
-
-                for (int k = j + 1; k <= played_top; k++)
-                {
-                    if (played[i]->card->rank == played[k]->card->rank &&
-                        !card_object_is_selected(played[k]))
-                    {
-                        card_object_set_selected(played[k], true);
-                        break;
-                    }
-                }
-
-                break;
-            }
-        }
 
-        if (card_object_is_selected(played[i]))
-            break;
-    }
+    return step;
 }
 
-static inline void select_two_pair_cards_in_played_hand(void)
+static inline void score_step_apply_totals(const ScoreStep* step)
 {
-    // find two pairs of cards with the same rank
-    int i;
-
-    for (i = 0; i <= played_top - 1; i++)
-    {
-        for (int j = i + 1; j <= played_top; j++)
-        {
-            if (played[i]->card->rank == played[j]->card->rank)
-            {
-                card_object_set_selected(played[i], true);
-                card_object_set_selected(played[j], true);
-
-                break;
-            }
-        }
-
-        if (card_object_is_selected(played[i]))
-            break;
-    }
+    chips = step->chips;
+    mult = step->mult;
+    money = step->money;
 
-    for (; i <= played_top - 1; i++) // Find second pair
-    {
-        for (int j = i + 1; j <= played_top; j++)
-        {
-            if (played[i]->card->rank == played[j]->card->rank &&
-                !card_object_is_selected(played[i]) && !card_object_is_selected(played[j]))
-            {
-                card_object_set_selected(played[i], true);
-                card_object_set_selected(played[j], true);
-                break;
-            }
-        }
-    }
+    display_chips();
+    display_mult();
+    display_money();
 }
 
-static inline void select_pair_cards_in_played_hand(void)
+// Shows the final totals of the hand and starts the expire animation of the Jokers that haven't
+// started it yet, the recorded steps stop at MAX_SCORE_STEPS but the result covers every step
+static void score_result_apply(void)
 {
-    // find two cards with the same rank
-    for (int i = 0; i <= played_top - 1; i++)
-    {
-        for (int j = i + 1; j <= played_top; j++)
-        {
-            if (played[i]->card->rank == played[j]->card->rank)
-            {
-                card_object_set_selected(played[i], true);
-                card_object_set_selected(played[j], true);
-                break;
-            }
-        }
-
-        if (card_object_is_selected(played[i]))
-            break;
-    }
-}
+    chips = _score_result.chips;
+    mult = _score_result.mult;
+    money = _money_before_scoring + _score_result.money_delta;
 
-static inline void select_highcard_cards_in_played_hand(void)
-{
-    // find the card with the highest rank in the hand
-    int highest_rank_index = 0;
+    display_chips();
+    display_mult();
+    display_money();
 
-    for (int i = 0; i <= played_top; i++)
+    for (int i = 0; i < _score_result.num_expired_jokers; i++)
     {
-        if (played[i]->card->rank > played[highest_rank_index]->card->rank)
+        // Jokers whose expire animation already ended are destroyed, and without POOL_DEBUG the
+        // handle of a reused object still resolves, only a Joker that is still owned counts
+        JokerObject* joker_object = POOL_FROM_HANDLE(JokerObject, _score_result.expired_jokers[i]);
+        if (joker_object != NULL && vector_find(&_owned_jokers_list, joker_object) != -1 &&
+            vector_find(&_expired_jokers_list, joker_object) == -1)
         {
-            highest_rank_index = i;
+            joker_object_shake(joker_object, UNDEFINED);
+            vector_push_back(&_expired_jokers_list, joker_object);
         }
     }
-
-    card_object_set_selected(played[highest_rank_index], true);
 }
 
-// returns true if a joker was scored, false otherwise
-static bool check_and_score_joker_for_event(
-    ListItr* starting_joker_itr,
-    CardObject* card_object,
-    enum JokerEvent joker_event
-)
+// Plays back a recorded Joker step, the card object is NULL when the event doesn't concern a card
+static void score_step_play_joker(const ScoreStep* step, CardObject* card_object)
 {
-    JokerObject* joker;
-
-    while ((joker = list_itr_next(starting_joker_itr)))
+    // A Joker that expired earlier in the hand may already be gone, with only its totals left
+    JokerObject* joker_object = step->joker_object;
+    if (vector_find(&_owned_jokers_list, joker_object) == -1)
     {
-        if (joker_object_score(joker, card_object, joker_event))
-        {
-            return true;
-        }
+        joker_object = NULL;
     }
-    return false;
-}
 
-static inline bool game_round_is_over(void)
-{
-    return hands == 0 || score >= blind_get_requirement(current_blind, ante);
+    score_step_apply_totals(step);
+    joker_object_display_effect(
+        joker_object,
+        card_object,
+        step->joker_event,
+        step->effect_flags,
+        &step->effect
+    );
+
+    _score_step_idx++;
 }
 
 // Basically a copy of HAND_DISCARD
@@ -2554,7 +2296,7 @@ static bool play_ended_played_cards_update(int played_idx)
             // we reached hand_top, all cards have been discarded
             if (played_idx == played_top)
             {
-                if (game_round_is_over())
+                if (_hand_ends_round)
                 {
                     hand_state = HAND_SHUFFLING;
                 }
@@ -2565,10 +2307,9 @@ static bool play_ended_played_cards_update(int played_idx)
 
                 play_state = PLAY_STARTING;
                 cards_drawn = 0;
-                hand_selections = 0;
+                hand_clear_selections();
                 played_top = -1; // Reset the played stack
                 scored_card_index = 0;
-                _joker_scored_itr = list_itr_create(&_owned_jokers_list);
                 timer = TM_ZERO;
             }
 
@@ -2585,7 +2326,10 @@ static bool play_ended_played_cards_update(int played_idx)
 
 static inline void play_starting_played_cards_update(int played_idx)
 {
-    bool card_selected = card_object_is_selected(played[played_top - scored_card_index]);
+    // scored_card_index counts down from played_top + 1 so the first frames are out of range
+    int card_idx = played_top - scored_card_index;
+    bool card_selected =
+        card_idx >= 0 && card_idx <= played_top && card_object_is_selected(played[card_idx]);
     if (played_idx == played_top && (timer % FRAMES(10) == 0 || !card_selected) &&
         timer > FRAMES(40))
     {
@@ -2593,7 +2337,6 @@ static inline void play_starting_played_cards_update(int played_idx)
 
         if (scored_card_index == 0)
         {
-            _joker_scored_itr = list_itr_create(&_owned_jokers_list);
             timer = TM_ZERO;
             play_state = PLAY_BEFORE_SCORING;
         }
@@ -2614,8 +2357,11 @@ static inline void play_starting_played_cards_update(int played_idx)
 static inline bool play_before_scoring_cards_update(void)
 {
     // Activate Jokers with an effect just before the hand is scored
-    if (check_and_score_joker_for_event(&_joker_scored_itr, NULL, JOKER_EVENT_ON_HAND_PLAYED))
+    const ScoreStep* step =
+        score_step_peek_joker_event(JOKER_EVENT_ON_HAND_PLAYED, JOKER_EVENT_ON_HAND_PLAYED);
+    if (step != NULL)
     {
+        score_step_play_joker(step, NULL);
         return true;
     }
 
@@ -2628,20 +2374,11 @@ static inline bool play_scoring_cards_update(void)
 {
     if (timer % FRAMES(30) == 0 && timer > FRAMES(40))
     {
-        // We are about to score played Cards.
-        // Start from the current card index
-        // and seek the next scoring card
-        while (scored_card_index <= played_top &&
-               !card_object_is_selected(played[scored_card_index]))
-        {
-            scored_card_index++;
-        }
-
         // go to the next state if there are no cards left to score
-        if (scored_card_index > played_top)
+        if (_score_step_idx >= _score_result.num_steps ||
+            _score_result.steps[_score_step_idx].type != SCORE_STEP_CARD)
         {
-            // reuse these variables for held cards
-            _joker_scored_itr = list_itr_create(&_owned_jokers_list);
+            // reuse this variable for held cards
             scored_card_index = hand_top;
 
             play_state = PLAY_SCORING_HELD_CARDS;
@@ -2651,36 +2388,25 @@ static inline bool play_scoring_cards_update(void)
 
         tte_erase_rect_wrapper(PLAYED_CARDS_SCORES_RECT);
 
+        const ScoreStep* step = &_score_result.steps[_score_step_idx++];
+        scored_card_index = step->card_idx;
         CardObject* scored_card_object = played[scored_card_index];
 
-        if (card_object_is_selected(scored_card_object))
-        {
-            // Offset of 1 tile to keep the text on the card
-            tte_set_pos(
-                fx2int(scored_card_object->sprite_object->x) + TILE_SIZE,
-                SCORED_CARD_TEXT_Y
-            );
-
-            // Set text color to blue from background memory
-            tte_set_special(TTE_BLUE_PB * TTE_SPECIAL_PB_MULT_OFFSET);
-
-            u8 card_value = card_get_value(scored_card_object->card);
+        // Offset of 1 tile to keep the text on the card
+        tte_set_pos(fx2int(scored_card_object->sprite_object->x) + TILE_SIZE, SCORED_CARD_TEXT_Y);
 
-            // Write the score to a character buffer variable
-            char score_buffer[INT_MAX_DIGITS + 2]; // for '+' and null terminator
-            snprintf(score_buffer, sizeof(score_buffer), "+%hhu", card_value);
-            tte_write(score_buffer);
+        // Set text color to blue from background memory
+        tte_set_special(TTE_BLUE_PB * TTE_SPECIAL_PB_MULT_OFFSET);
 
-            card_object_shake(scored_card_object, SFX_CHIPS_CARD);
+        // Write the score to a character buffer variable
+        char score_buffer[INT_MAX_DIGITS + 2]; // for '+' and null terminator
+        snprintf(score_buffer, sizeof(score_buffer), "+%lu", step->effect.chips);
+        tte_write(score_buffer);
 
-            // Relocated card scoring logic here
-            chips = u32_protected_add(chips, card_value);
-            display_chips();
+        card_object_shake(scored_card_object, SFX_CHIPS_CARD);
 
-            // Allow Joker scoring
-            _joker_scored_itr = list_itr_create(&_owned_jokers_list);
-            _joker_card_scored_end_itr = list_itr_create(&_owned_jokers_list);
-        }
+        chips = step->chips;
+        display_chips();
 
         play_state = PLAY_SCORING_CARD_JOKERS;
         return true;
@@ -2697,38 +2423,20 @@ static inline bool play_scoring_card_jokers_update(void)
     {
         tte_erase_rect_wrapper(PLAYED_CARDS_SCORES_RECT);
 
-        // since we sought the next scoring card index in the previous state,
-        // scored_card_index is guaranteed to be a scoring card
-        if (check_and_score_joker_for_event(
-                &_joker_scored_itr,
-                played[scored_card_index],
-                JOKER_EVENT_ON_CARD_SCORED
-            ))
-        {
-            return true;
-        }
-
-        // Trigger all Jokers that have an effect when a card finishes scoring
-        // (e.g. retriggers) after activating all the other scored_card Jokers normally
-        if (check_and_score_joker_for_event(
-                &_joker_card_scored_end_itr,
-                played[scored_card_index],
-                JOKER_EVENT_ON_CARD_SCORED_END
-            ))
+        // Jokers that have an effect when a card finishes scoring (e.g. retriggers)
+        // were recorded after all the other scored_card Jokers.
+        // A retrigger is followed by the same card scoring again in the next state
+        const ScoreStep* step = score_step_peek_joker_event(
+            JOKER_EVENT_ON_CARD_SCORED,
+            JOKER_EVENT_ON_CARD_SCORED_END
+        );
+        if (step != NULL)
         {
-            // If we just scored a retrigger, return early and go back to the
-            // previous state score the same card again without incrementing
-            // scored_card_index to score the current card again
-            if (retrigger)
-            {
-                retrigger = false;
-                play_state = PLAY_SCORING_CARDS;
-            }
+            score_step_play_joker(step, played[step->card_idx]);
             return true;
         }
 
-        // increment index to start seeking the next scoring card from the next card
-        scored_card_index++;
+        // seek the next scoring card, or the next state if there are none left
         play_state = PLAY_SCORING_CARDS;
     }
 
@@ -2736,29 +2444,24 @@ static inline bool play_scoring_card_jokers_update(void)
 }
 
 // returns true if the scoring loop has returned early
-static inline bool play_scoring_held_cards_update(int played_idx)
+static inline bool play_scoring_held_cards_update(void)
 {
-    if (played_idx == 0 && (timer % FRAMES(30) == 0) && timer > FRAMES(40))
+    if (timer % FRAMES(30) == 0 && timer > FRAMES(40))
     {
         tte_erase_rect_wrapper(HELD_CARDS_SCORES_RECT);
 
-        // Go through all held cards and see if they activate Jokers
-        for (; scored_card_index >= 0; scored_card_index--)
+        // Go through all held cards that activated Jokers
+        const ScoreStep* step =
+            score_step_peek_joker_event(JOKER_EVENT_ON_CARD_HELD, JOKER_EVENT_ON_CARD_HELD);
+        if (step != NULL)
         {
-            if (check_and_score_joker_for_event(
-                    &_joker_scored_itr,
-                    hand[scored_card_index],
-                    JOKER_EVENT_ON_CARD_HELD
-                ))
-            {
-                card_object_shake(hand[scored_card_index], SFX_CARD_SELECT);
-                return true;
-            }
-            _joker_scored_itr = list_itr_create(&_owned_jokers_list);
+            scored_card_index = step->card_idx;
+            score_step_play_joker(step, hand[scored_card_index]);
+            card_object_shake(hand[scored_card_index], SFX_CARD_SELECT);
+            return true;
         }
 
         scored_card_index = 0;
-        _joker_round_end_itr = list_itr_create(&_owned_jokers_list);
         play_state = PLAY_SCORING_INDEPENDENT_JOKERS;
     }
 
@@ -2767,15 +2470,18 @@ static inline bool play_scoring_held_cards_update(int played_idx)
 
 // Score Jokers normally (independent)
 // returns true if the scoring loop has returned early
-static inline bool play_scoring_independent_jokers_update(int played_idx)
+static inline bool play_scoring_independent_jokers_update(void)
 {
-    if (played_idx == 0 && (timer % FRAMES(30) == 0) && timer > FRAMES(40))
+    if (timer % FRAMES(30) == 0 && timer > FRAMES(40))
     {
 
         tte_erase_rect_wrapper(PLAYED_CARDS_SCORES_RECT);
 
-        if (check_and_score_joker_for_event(&_joker_scored_itr, NULL, JOKER_EVENT_INDEPENDENT))
+        const ScoreStep* step =
+            score_step_peek_joker_event(JOKER_EVENT_INDEPENDENT, JOKER_EVENT_INDEPENDENT);
+        if (step != NULL)
         {
+            score_step_play_joker(step, NULL);
             return true;
         }
 
@@ -2789,24 +2495,24 @@ static inline bool play_scoring_independent_jokers_update(int played_idx)
 }
 
 // Trigger hand end effect for all jokers once they are done scoring
-static inline bool play_scoring_hand_scored_end_update(int played_idx)
+static inline bool play_scoring_hand_scored_end_update(void)
 {
-    if (played_idx == 0 && (timer % FRAMES(30) == 0) && timer > FRAMES(40))
+    if (timer % FRAMES(30) == 0 && timer > FRAMES(40))
     {
 
         tte_erase_rect_wrapper(PLAYED_CARDS_SCORES_RECT);
 
-        bool scored = check_and_score_joker_for_event(
-            &_joker_round_end_itr,
-            NULL,
+        const ScoreStep* step = score_step_peek_joker_event(
+            JOKER_EVENT_ON_HAND_SCORED_END,
             JOKER_EVENT_ON_HAND_SCORED_END
         );
-
-        if (scored)
+        if (step != NULL)
         {
+            score_step_play_joker(step, NULL);
             return true;
         }
 
+        score_result_apply();
         timer = TM_ZERO;
         play_state = PLAY_ENDING;
     }
@@ -2814,24 +2520,97 @@ static inline bool play_scoring_hand_scored_end_update(int played_idx)
     return false;
 }
 
-// This is the reverse of PLAY_STARTING. The cards get reset back to their neutral position
-// sequentially
-static inline void play_ending_played_cards_update(int played_idx)
+// Jump to the end of the recorded steps, showing the final totals and starting the expire
+// animation of the Jokers that expire in the remaining steps
+static void play_skip_scoring(void)
 {
-    bool card_selected = card_object_is_selected(played[played_top - scored_card_index]);
-    if (played_idx == played_top && (timer % FRAMES(10) == 0 || !card_selected) &&
-        timer > FRAMES(40))
-    {
-        scored_card_index--;
+    tte_erase_rect_wrapper(PLAYED_CARDS_SCORES_RECT);
+    tte_erase_rect_wrapper(HELD_CARDS_SCORES_RECT);
 
-        /* SFX_CHIPS_ACCUM has been pitch shifted to perserve high frequencies in downsampling.
-         * Now it needs to be pitch shifted back to the original frequency.
-         */
-        int static const CHIPS_ACCUM_SFX_PITCH_RATIO = 2;
+    _score_step_idx = _score_result.num_steps;
+    score_result_apply();
 
-        if (scored_card_index == 0)
-        {
-            play_sfx(
+    scored_card_index = played_top + 1;
+    timer = TM_ZERO;
+    play_state = PLAY_ENDING;
+}
+
+// Plays back the recorded steps of the current scoring state. States with nothing left to play go
+// to the next one in the same frame, so only the steps themselves are paced.
+// returns true if a step was played this frame
+static bool play_scoring_update(void)
+{
+    if (play_state < PLAY_BEFORE_SCORING || play_state > PLAY_SCORING_HAND_SCORED_END)
+    {
+        return false;
+    }
+
+    if (_skip_hand_scoring)
+    {
+        play_skip_scoring();
+        return false;
+    }
+
+    enum PlayState prev_play_state;
+    do
+    {
+        prev_play_state = play_state;
+
+        bool step_played = false;
+        switch (play_state)
+        {
+            case PLAY_BEFORE_SCORING:
+                step_played = play_before_scoring_cards_update();
+                break;
+            case PLAY_SCORING_CARDS:
+                step_played = play_scoring_cards_update();
+                break;
+            case PLAY_SCORING_CARD_JOKERS:
+                step_played = play_scoring_card_jokers_update();
+                break;
+            case PLAY_SCORING_HELD_CARDS:
+                step_played = play_scoring_held_cards_update();
+                break;
+            case PLAY_SCORING_INDEPENDENT_JOKERS:
+                step_played = play_scoring_independent_jokers_update();
+                break;
+            case PLAY_SCORING_HAND_SCORED_END:
+                step_played = play_scoring_hand_scored_end_update();
+                break;
+            default:
+                break;
+        }
+
+        if (step_played)
+        {
+            return true;
+        }
+    } while (play_state != prev_play_state);
+
+    return false;
+}
+
+// This is the reverse of PLAY_STARTING. The cards get reset back to their neutral position
+// sequentially
+static inline void play_ending_played_cards_update(int played_idx)
+{
+    // scored_card_index counts down from played_top + 1 so the first frames are out of range
+    int card_idx = played_top - scored_card_index;
+    bool card_selected =
+        card_idx >= 0 && card_idx <= played_top && card_object_is_selected(played[card_idx]);
+    if (played_idx == played_top && (timer % FRAMES(10) == 0 || !card_selected) &&
+        timer > FRAMES(40))
+    {
+        scored_card_index--;
+
+        /* SFX_CHIPS_ACCUM has been pitch shifted to perserve high frequencies in downsampling.
+         * Now it needs to be pitch shifted back to the original frequency.
+         */
+        int static const CHIPS_ACCUM_SFX_PITCH_RATIO = 2;
+
+        if (scored_card_index == 0)
+        {
+            play_sfx(
                 SFX_CHIPS_ACCUM,
                 CHIPS_ACCUM_SFX_PITCH_RATIO * MM_BASE_PITCH_RATE,
                 SFX_DEFAULT_VOLUME
@@ -2849,6 +2628,11 @@ static inline void play_ending_played_cards_update(int played_idx)
 
 static inline void played_cards_update_loop(void)
 {
+    if (play_scoring_update())
+    {
+        return;
+    }
+
     // So this one is a bit fucking weird because I have to work kinda backwards for everything
     // because of the order of the pushed cards from the hand to the play stack (also crazy that the
     // company that published Balatro is called "Playstack" and this is a play stack, but I digress)
@@ -2872,54 +2656,6 @@ static inline void played_cards_update_loop(void)
                 play_starting_played_cards_update(played_idx);
                 break;
 
-            case PLAY_BEFORE_SCORING:
-
-                if (play_before_scoring_cards_update())
-                {
-                    return;
-                }
-                break;
-
-            case PLAY_SCORING_CARDS:
-
-                if (play_scoring_cards_update())
-                {
-                    return;
-                }
-                break;
-
-            case PLAY_SCORING_CARD_JOKERS:
-
-                if (play_scoring_card_jokers_update())
-                {
-                    return;
-                }
-                break;
-
-            case PLAY_SCORING_HELD_CARDS:
-
-                if (play_scoring_held_cards_update(played_idx))
-                {
-                    return;
-                }
-                break;
-
-            case PLAY_SCORING_INDEPENDENT_JOKERS:
-
-                if (play_scoring_independent_jokers_update(played_idx))
-                {
-                    return;
-                }
-                break;
-
-            case PLAY_SCORING_HAND_SCORED_END:
-
-                if (play_scoring_hand_scored_end_update(played_idx))
-                {
-                    return;
-                }
-                break;
-
             case PLAY_ENDING:
 
                 play_ending_played_cards_update(played_idx);
@@ -2936,6 +2672,10 @@ static inline void played_cards_update_loop(void)
                     continue;
                 }
                 break;
+
+            // The scoring states are played back by play_scoring_update()
+            default:
+                break;
         }
 
         played[played_idx]->sprite_object->tscale = FIX_ONE;
@@ -2959,6 +2699,10 @@ static inline void game_playing_process_input_and_state(void)
     {
         game_playing_process_hand_select_input();
     }
+    else if (hand_state == HAND_PLAYING && play_state < PLAY_ENDING && key_hit(SKIP_SCORING))
+    {
+        _skip_hand_scoring = true;
+    }
     else if (play_state == PLAY_ENDING)
     {
         if (mult > 0)
@@ -3157,9 +2901,9 @@ static inline void cards_in_hand_update_loop(void)
                     if (card_object_is_selected(hand[i]) && discarded_card == false &&
                         timer % FRAMES(10) == 0)
                     {
-                        card_object_set_selected(hand[i], false);
+                        hand_set_card_selected(hand[i], false);
                         played_push(hand[i]);
-                        sprite_destroy(&hand[i]->sprite_object->sprite);
+                        card_object_destroy_sprite(hand[i]);
                         hand[i] = NULL;
                         reorder_card_sprites_layers();
 
@@ -3170,7 +2914,6 @@ static inline void cards_in_hand_update_loop(void)
                         );
 
                         hand_top--;
-                        hand_selections--;
                         cards_drawn++;
 
                         discarded_card = true;
@@ -3180,49 +2923,11 @@ static inline void cards_in_hand_update_loop(void)
                     {
                         hand_state = HAND_PLAYING;
                         cards_drawn = 0;
-                        hand_selections = 0;
+                        hand_clear_selections();
                         timer = TM_ZERO;
                         scored_card_index = played_top + 1;
 
-                        switch (hand_type) // select the cards that apply to the hand type
-                        {
-                            case NONE:
-                                break;
-                            case HIGH_CARD:
-                                select_highcard_cards_in_played_hand();
-                                break;
-                            case PAIR:
-                                select_pair_cards_in_played_hand();
-                                break;
-                            case TWO_PAIR:
-                                select_two_pair_cards_in_played_hand();
-                                break;
-                            case THREE_OF_A_KIND:
-                                select_three_of_a_kind_cards_in_played_hand();
-                                break;
-                            case FOUR_OF_A_KIND:
-                                select_four_of_a_kind_cards_in_played_hand();
-                                break;
-                            case STRAIGHT:
-                                /* FALL THROUGH */
-                            case FLUSH:
-                                /* FALL THROUGH */
-                            case STRAIGHT_FLUSH:
-                                /* FALL THROUGH */
-                            case ROYAL_FLUSH:
-                                select_flush_and_straight_cards_in_played_hand();
-                                break;
-                                // ELSE FALL THROUGH
-                            case FULL_HOUSE:
-                                /* FALL THROUGH */
-                            case FIVE_OF_A_KIND:
-                                /* FALL THROUGH */
-                            case FLUSH_HOUSE:
-                                /* FALL THROUGH */
-                            case FLUSH_FIVE: // Select all played cards in the hand
-                                select_all_five_cards_in_played_hand();
-                                break;
-                        }
+                        game_playing_score_played_hand();
                     }
 
                     break;
@@ -3234,6 +2939,12 @@ static inline void cards_in_hand_update_loop(void)
                     break;
             }
 
+            // The card may have just been moved out of the hand
+            if (hand[i] == NULL)
+            {
+                continue;
+            }
+
             hand[i]->sprite_object->tx = hand_x;
             hand[i]->sprite_object->ty = hand_y;
             card_object_update(hand[i]);
@@ -3343,7 +3054,7 @@ static void game_playing_on_update(void)
     game_playing_process_flaming_score();
 }
 
-static int calculate_interest_reward(void)
+int calculate_interest_reward(int money)
 {
     int reward = (money / 5) * INTEREST_PER_5;
     if (reward > MAX_INTEREST)
@@ -3363,43 +3074,21 @@ static void game_round_end_on_exit()
     // TODO: Reuse sprites for blind selection?
 }
 
-static void game_round_end_on_update()
-{
-    if (state_info[game_state].substate == ROUND_END_EXIT)
-    {
-        game_change_state(GAME_STATE_SHOP);
-        return;
-    }
-
-    int substate = state_info[game_state].substate;
-    round_end_state_actions[substate]();
-}
-
-static void game_round_end_start()
+static bool game_round_end_start(int run)
 {
     // Reset static variables to default values upon re-entering the round end state
-    if (timer == TM_RESET_STATIC_VARS)
-    {
-        change_background(BG_ROUND_END); // Change the background to the round end background
-        state_info[game_state].substate = START_EXPAND_POPUP; // Change the state to the next one
-        timer = TM_ZERO;                                      // Reset the timer
-        blind_reward = blind_get_reward(current_blind);
-        hand_reward = hands;
-        interest_reward = calculate_interest_reward();
-        interest_to_count = interest_reward;
-        interest_start_time = UNDEFINED;
-    }
+    change_background(BG_ROUND_END); // Change the background to the round end background
+    blind_reward = blind_get_reward(current_blind);
+    hand_reward = hands;
+    interest_reward = calculate_interest_reward(money);
+    interest_to_count = interest_reward;
+    return false;
 }
 
-static void game_round_end_start_expand_popup()
+static bool game_round_end_expand_popup(int run)
 {
     main_bg_se_copy_rect_1_tile_vert(POP_MENU_ANIM_RECT, SCREEN_UP);
-
-    if (timer == TM_END_POP_MENU_ANIM)
-    {
-        state_info[game_state].substate = DISPLAY_FINISHED_BLIND;
-        timer = TM_ZERO;
-    }
+    return false;
 }
 
 static void game_round_end_extend_black_panel_down(int black_panel_bottom)
@@ -3410,9 +3099,9 @@ static void game_round_end_extend_black_panel_down(int black_panel_bottom)
     main_bg_se_copy_rect_1_tile_vert(single_line_rect, SCREEN_DOWN);
 }
 
-static void game_round_end_display_finished_blind()
+static bool game_round_end_display_finished_blind(int run)
 {
-    obj_unhide(round_end_blind_token->obj, 0);
+    sprite_unhide(round_end_blind_token, 0);
 
     int current_ante = ante;
 
@@ -3440,44 +3129,27 @@ static void game_round_end_display_finished_blind()
         blind_req_str_buff
     );
 
-    if (timer == TM_START_ROUND_END_REWARDS_ANIM)
-    {
-        game_round_end_extend_black_panel_down(ROUND_END_BLACK_PANEL_INIT_BOTTOM_SE);
-    }
-
-    if (timer >= TM_END_DISPLAY_FIN_BLIND)
-    {
-        state_info[game_state].substate = DISPLAY_SCORE_MIN;
-        timer = TM_ZERO;
-    }
+    game_round_end_extend_black_panel_down(ROUND_END_BLACK_PANEL_INIT_BOTTOM_SE);
+    return false;
 }
 
-static void game_round_end_display_score_min()
+static bool game_round_end_display_score_min(int run)
 {
-    const int timer_offset = timer - 1;
     const int x_from = 0;
     const int y_from = 29;
     const int x_to = 13;
     const int y_to = 11;
 
     memcpy16(
-        &se_mem[MAIN_BG_SBB][x_to + timer_offset + 32 * y_to],
-        &se_mem[MAIN_BG_SBB][x_from + timer_offset + 32 * y_from],
+        &se_mem[MAIN_BG_SBB][x_to + run + 32 * y_to],
+        &se_mem[MAIN_BG_SBB][x_from + run + 32 * y_from],
         1
     );
-
-    if (timer >= TM_END_DISPLAY_SCORE_MIN)
-    {
-        state_info[game_state].substate = UPDATE_BLIND_REWARD;
-        timer = TM_ZERO;
-    }
+    return false;
 }
 
-static void game_round_end_update_blind_reward()
+static bool game_round_end_update_blind_reward(int run)
 {
-    if (timer % FRAMES(20) != 0)
-        return;
-
     // TODO: Add sound effect here
 
     if (blind_reward > 0)
@@ -3497,226 +3169,291 @@ static void game_round_end_update_blind_reward()
             TTE_YELLOW_PB,
             blind_get_reward(current_blind) - blind_reward
         );
+        return false;
     }
-    else if (timer > FRAMES(20))
-    {
-        tte_erase_rect_wrapper(BLIND_REWARD_RECT);
-        tte_erase_rect_wrapper(BLIND_REQ_TEXT_RECT);
-        obj_hide(playing_blind_token->obj);
-        affine_background_load_palette(affine_background_gfxPal);
-        state_info[game_state].substate = BLIND_PANEL_EXIT;
-        timer = TM_ZERO;
-    }
+
+    tte_erase_rect_wrapper(BLIND_REWARD_RECT);
+    tte_erase_rect_wrapper(BLIND_REQ_TEXT_RECT);
+    sprite_hide(playing_blind_token);
+    affine_background_load_palette(affine_background_gfxPal);
+    return true;
 }
 
-static void game_round_end_panel_exit()
+static bool game_round_end_panel_exit(int run)
 {
     // TODO: make heads or tails of what's going on here and replace
     // magic numbers.
-    if (timer < 8)
-    {
-        main_bg_se_copy_rect_1_tile_vert(TOP_LEFT_PANEL_ANIM_RECT, SCREEN_UP);
+    main_bg_se_copy_rect_1_tile_vert(TOP_LEFT_PANEL_ANIM_RECT, SCREEN_UP);
 
-        if (timer == 1) // Copied from shop. Feels slightly too niche of a function for me
-                        // personally to make one.
-        {
-            reset_top_left_panel_bottom_row();
-        }
-        else if (timer == 2)
-        {
-            int y = 5;
-            memset16(&se_mem[MAIN_BG_SBB][32 * (y - 1)], 0x0001, 1);
-            memset16(&se_mem[MAIN_BG_SBB][1 + 32 * (y - 1)], 0x0002, 7);
-            memset16(&se_mem[MAIN_BG_SBB][8 + 32 * (y - 1)], 0x0401, 1);
-        }
+    if (run == 0) // Copied from shop. Feels slightly too niche of a function for me
+                  // personally to make one.
+    {
+        reset_top_left_panel_bottom_row();
     }
-    else if (timer > FRAMES(20))
+    else if (run == 1)
     {
-        memset16(&pal_bg_mem[REWARD_PANEL_BORDER_PID], 0x1483, 1);
-        state_info[game_state].substate = DISPLAY_REWARDS;
-        timer = TM_ZERO;
+        int y = 5;
+        memset16(&se_mem[MAIN_BG_SBB][32 * (y - 1)], 0x0001, 1);
+        memset16(&se_mem[MAIN_BG_SBB][1 + 32 * (y - 1)], 0x0002, 7);
+        memset16(&se_mem[MAIN_BG_SBB][8 + 32 * (y - 1)], 0x0401, 1);
     }
+    return false;
 }
 
-static inline void game_round_end_print_separator_ellipsis(void)
+static bool game_round_end_display_rewards(int run)
 {
-    int x =
-        (ROUND_END_REWARDS_ELLIPSIS_POS.x + timer - TM_REWARDS_ELLIPSIS_PRINT_START) * TILE_SIZE;
+    game_round_end_extend_black_panel_down(ROUND_END_REWARDS_ELLIPSIS_POS.y);
+    return false;
+}
+
+static bool game_round_end_print_separator_ellipsis(int run)
+{
+    int x = (ROUND_END_REWARDS_ELLIPSIS_POS.x + run) * TILE_SIZE;
     int y = (ROUND_END_REWARDS_ELLIPSIS_POS.y) * TILE_SIZE;
 
     tte_printf("#{P:%d,%d; cx:0x%X000}.", x, y, TTE_WHITE_PB);
+    return false;
 }
 
-// TODO: Allow for more generic rewards and consolidate with game_round_end_print_interest_reward()
-static inline void game_round_end_print_hand_reward(int hand_y_offset)
+static inline void game_round_end_cashout(void)
 {
-    int hand_y = ROUND_END_REWARDS_ELLIPSIS_POS.y + hand_y_offset;
-    if (timer == TM_DISPLAY_REWARDS_CONT_WAIT)
-    {
-        game_round_end_extend_black_panel_down(hand_y);
+    // Reward the player
+    money += hands + blind_get_reward(current_blind) + calculate_interest_reward(money);
+    display_money();
 
-        tte_printf(
-            "#{P:%d,%d; cx:0x%X000}%d #{cx:0x%X000}Hands",
-            ROUND_END_REWARD_TEXT_X,
-            hand_y * TILE_SIZE,
-            TTE_BLUE_PB,
-            hand_reward,
-            TTE_WHITE_PB
-        );
-    }
-    // Increment the hand reward text until the hand reward variable is depleted
-    else if (timer > TM_HAND_REWARD_INCR_WAIT && timer % FRAMES(TM_REWARD_INCREMENT_INTERVAL) == 0)
-    {
-        hand_reward--;
-        tte_printf(
-            "#{P:%d, %d; cx:0x%X000}$%d",
-            ROUND_END_REWARD_AMOUNT_X,
-            hand_y * TILE_SIZE,
-            TTE_YELLOW_PB,
-            hands - hand_reward
-        );
-        if (hand_reward == 0)
-        {
-            interest_start_time = timer + TM_REWARD_DISPLAY_INTERVAL;
-        }
-    }
+    hands = max_hands;          // Reset the hands to the maximum
+    discards = max_discards;    // Reset the discards to the maximum
+    display_hands(hands);       // Set the hands display
+    display_discards(discards); // Set the discards display
+
+    score = 0;
+    display_score(score); // Set the score display
 }
 
-static inline void game_round_end_print_interest_reward(int interest_y_offset)
+static bool game_round_end_display_cashout(int run)
 {
-    int interest_y = ROUND_END_REWARDS_ELLIPSIS_POS.y + interest_y_offset;
+    // Put the "cash out" button onto the round end panel
+    main_bg_se_copy_expand_3x3_rect(CASHOUT_DEST_RECT, CASHOUT_SRC_3X3_RECT_POS);
 
-    if (timer == interest_start_time)
-    {
-        game_round_end_extend_black_panel_down(interest_y);
+    int cashout_amount = hands + blind_get_reward(current_blind) + calculate_interest_reward(money);
 
-        tte_printf(
-            "#{P:%d,%d; cx:0x%X000}%d #{cx:0x%X000}Interest",
-            ROUND_END_REWARD_TEXT_X,
-            interest_y * TILE_SIZE,
-            TTE_YELLOW_PB,
-            interest_reward,
-            TTE_WHITE_PB
-        );
-    }
-    // Increment the interest reward text until the interest reward variable is depleted
-    else if (timer > interest_start_time + TM_REWARD_DISPLAY_INTERVAL &&
-             timer % FRAMES(TM_REWARD_INCREMENT_INTERVAL) == 0)
-    {
-        interest_to_count--;
-        tte_printf(
-            "#{P:%d, %d; cx:0x%X000}$%d",
-            ROUND_END_REWARD_AMOUNT_X,
-            interest_y * TILE_SIZE,
-            TTE_YELLOW_PB,
-            interest_reward - interest_to_count
-        );
-    }
+    bool omit_space = cashout_amount >= 10;
+    tte_printf(
+        "#{P:%d, %d; cx:0x%X000}Cash Out:%s$%d",
+        CASHOUT_TEXT_RECT.left,
+        CASHOUT_TEXT_RECT.top,
+        TTE_WHITE_PB,
+        omit_space ? "" : " ",
+        cashout_amount
+    );
+    return false;
 }
 
-static void game_round_end_display_rewards()
+// Wait until the player presses A to cash out
+static bool game_round_end_wait_for_cashout(int run)
 {
-    int hand_y_offset = 0;
-    int interest_y_offset = 0;
+    if (!key_hit(SELECT_CARD))
+        return false;
 
-    if (hands > 0)
-    {
-        hand_y_offset = 1;
-    }
-    else
-    {
-        interest_start_time = TM_DISPLAY_REWARDS_CONT_WAIT;
-    }
+    game_round_end_cashout();
 
-    if (interest_reward > 0)
-    {
-        interest_y_offset = hand_y_offset + 1;
-    }
+    sprite_hide(round_end_blind_token);            // Hide the blind token object
+    tte_erase_rect_wrapper(BLIND_TOKEN_TEXT_RECT); // Erase the blind token text
+    return true;
+}
 
-    // Once all rewards are accounted for go to the next state
-    if (hand_reward <= 0 && interest_to_count <= 0)
-    {
-        timer = TM_ZERO;
-        state_info[game_state].substate = DISPLAY_CASHOUT;
-    }
-    else if (timer == TM_START_ROUND_END_REWARDS_ANIM)
-    {
-        game_round_end_extend_black_panel_down(ROUND_END_REWARDS_ELLIPSIS_POS.y);
-    }
-    else if (timer < TM_REWARDS_ELLIPSIS_PRINT_END)
-    {
-        game_round_end_print_separator_ellipsis();
-    }
-    else if (timer >= TM_DISPLAY_REWARDS_CONT_WAIT && hand_reward > 0)
+static bool game_round_end_dismiss_round_end_panel(int run)
+{
+    Rect round_end_down = ROUND_END_MENU_RECT;
+    round_end_down.top--;
+    main_bg_se_copy_rect_1_tile_vert(round_end_down, SCREEN_DOWN);
+    return false;
+}
+
+// clang-format off
+static const TimelineStep _round_end_cashout_steps[] = {
+    {.delay = TM_CASHOUT_BTN_WAIT, .action = game_round_end_display_cashout},
+    {.delay = 1, .interval = 1,
+     .runs = TIMELINE_UNTIL_DONE, .action = game_round_end_wait_for_cashout},
+    {.delay = 1, .interval = 1, .runs = TM_DISMISS_ROUND_END_PANEL,
+     .action = game_round_end_dismiss_round_end_panel},
+};
+// clang-format on
+
+static bool game_round_end_start_cashout(int run)
+{
+    START_SEQUENCE(TRACK_MAIN, _round_end_cashout_steps);
+    return false;
+}
+
+static inline int game_round_end_get_interest_y(void)
+{
+    // Below the hand reward, when there is one
+    return ROUND_END_REWARDS_ELLIPSIS_POS.y + (hands > 0 ? 2 : 1);
+}
+
+static bool game_round_end_print_interest_reward(int run)
+{
+    int interest_y = game_round_end_get_interest_y();
+
+    game_round_end_extend_black_panel_down(interest_y);
+
+    tte_printf(
+        "#{P:%d,%d; cx:0x%X000}%d #{cx:0x%X000}Interest",
+        ROUND_END_REWARD_TEXT_X,
+        interest_y * TILE_SIZE,
+        TTE_YELLOW_PB,
+        interest_reward,
+        TTE_WHITE_PB
+    );
+    return false;
+}
+
+// Increment the interest reward text until the interest reward variable is depleted
+static bool game_round_end_count_interest_reward(int run)
+{
+    interest_to_count--;
+    tte_printf(
+        "#{P:%d, %d; cx:0x%X000}$%d",
+        ROUND_END_REWARD_AMOUNT_X,
+        game_round_end_get_interest_y() * TILE_SIZE,
+        TTE_YELLOW_PB,
+        interest_reward - interest_to_count
+    );
+    return interest_to_count <= 0;
+}
+
+// clang-format off
+static const TimelineStep _round_end_interest_steps[] = {
+    {.delay = TM_REWARD_DISPLAY_INTERVAL, .action = game_round_end_print_interest_reward},
+    {.delay = TM_REWARD_INCREMENT_WAIT, .interval = TM_REWARD_INCREMENT_INTERVAL,
+     .runs = TIMELINE_UNTIL_DONE, .action = game_round_end_count_interest_reward},
+    {.action = game_round_end_start_cashout},
+};
+// clang-format on
+
+static bool game_round_end_start_interest_reward(int run)
+{
+    if (interest_to_count > 0)
     {
-        game_round_end_print_hand_reward(hand_y_offset);
+        START_SEQUENCE(TRACK_MAIN, _round_end_interest_steps);
     }
-    else if (interest_start_time != UNDEFINED && timer >= interest_start_time &&
-             interest_to_count > 0)
+    else
     {
-        game_round_end_print_interest_reward(interest_y_offset);
+        START_SEQUENCE(TRACK_MAIN, _round_end_cashout_steps);
     }
+    return false;
 }
 
-static inline void game_round_end_cashout(void)
+// TODO: Allow for more generic rewards and consolidate with game_round_end_print_interest_reward()
+static bool game_round_end_print_hand_reward(int run)
 {
-    // Reward the player
-    money += hands + blind_get_reward(current_blind) + calculate_interest_reward();
-    display_money();
+    int hand_y = ROUND_END_REWARDS_ELLIPSIS_POS.y + 1;
 
-    hands = max_hands;          // Reset the hands to the maximum
-    discards = max_discards;    // Reset the discards to the maximum
-    display_hands(hands);       // Set the hands display
-    display_discards(discards); // Set the discards display
+    game_round_end_extend_black_panel_down(hand_y);
 
-    score = 0;
-    display_score(score); // Set the score display
+    tte_printf(
+        "#{P:%d,%d; cx:0x%X000}%d #{cx:0x%X000}Hands",
+        ROUND_END_REWARD_TEXT_X,
+        hand_y * TILE_SIZE,
+        TTE_BLUE_PB,
+        hand_reward,
+        TTE_WHITE_PB
+    );
+    return false;
 }
 
-static void game_round_end_display_cashout()
+// Increment the hand reward text until the hand reward variable is depleted
+static bool game_round_end_count_hand_reward(int run)
 {
-    if (timer == FRAMES(40))
-    {
-        // Put the "cash out" button onto the round end panel
-        main_bg_se_copy_expand_3x3_rect(CASHOUT_DEST_RECT, CASHOUT_SRC_3X3_RECT_POS);
+    hand_reward--;
+    tte_printf(
+        "#{P:%d, %d; cx:0x%X000}$%d",
+        ROUND_END_REWARD_AMOUNT_X,
+        (ROUND_END_REWARDS_ELLIPSIS_POS.y + 1) * TILE_SIZE,
+        TTE_YELLOW_PB,
+        hands - hand_reward
+    );
+    return hand_reward <= 0;
+}
 
-        int cashout_amount = hands + blind_get_reward(current_blind) + calculate_interest_reward();
+// clang-format off
+static const TimelineStep _round_end_hand_steps[] = {
+    {.delay = TM_REWARD_DISPLAY_INTERVAL, .action = game_round_end_print_hand_reward},
+    {.delay = TM_REWARD_INCREMENT_WAIT, .interval = TM_REWARD_INCREMENT_INTERVAL,
+     .runs = TIMELINE_UNTIL_DONE, .action = game_round_end_count_hand_reward},
+    {.action = game_round_end_start_interest_reward},
+};
+// clang-format on
 
-        bool omit_space = cashout_amount >= 10;
-        tte_printf(
-            "#{P:%d, %d; cx:0x%X000}Cash Out:%s$%d",
-            CASHOUT_TEXT_RECT.left,
-            CASHOUT_TEXT_RECT.top,
-            TTE_WHITE_PB,
-            omit_space ? "" : " ",
-            cashout_amount
-        );
+static bool game_round_end_start_hand_reward(int run)
+{
+    if (hand_reward > 0)
+    {
+        START_SEQUENCE(TRACK_MAIN, _round_end_hand_steps);
     }
-
-    // Wait until the player presses A to cash out
-    else if (timer > FRAMES(40) && key_hit(SELECT_CARD))
+    else
     {
-        game_round_end_cashout();
+        START_SEQUENCE(TRACK_MAIN, _round_end_interest_steps);
+    }
+    return false;
+}
 
-        state_info[game_state].substate = DISMISS_ROUND_END_PANEL; // Go to the next state
-        timer = TM_ZERO;
+// clang-format off
+static const TimelineStep _round_end_rewards_steps[] = {
+    {.delay = 1, .action = game_round_end_display_rewards},
+    {.delay = 1, .interval = 1, .runs = TM_REWARDS_ELLIPSIS_LEN,
+     .action = game_round_end_print_separator_ellipsis},
+    {.delay = 1, .action = game_round_end_start_hand_reward},
+};
+// clang-format on
 
-        obj_hide(round_end_blind_token->obj);          // Hide the blind token object
-        tte_erase_rect_wrapper(BLIND_TOKEN_TEXT_RECT); // Erase the blind token text
+static bool game_round_end_start_rewards(int run)
+{
+    memset16(&pal_bg_mem[REWARD_PANEL_BORDER_PID], 0x1483, 1);
+
+    // Once all rewards are accounted for go to the cash out
+    if (hand_reward <= 0 && interest_to_count <= 0)
+    {
+        START_SEQUENCE(TRACK_MAIN, _round_end_cashout_steps);
     }
+    else
+    {
+        START_SEQUENCE(TRACK_MAIN, _round_end_rewards_steps);
+    }
+    return false;
 }
 
-static void game_round_end_dismiss_round_end_panel()
+// clang-format off
+static const TimelineStep _round_end_steps[] = {
+    {.delay = TM_ROUND_END_START_WAIT, .action = game_round_end_start},
+    {.delay = 1, .interval = 1, .runs = TM_ROUND_END_POP_MENU_ANIM,
+     .action = game_round_end_expand_popup},
+    {.delay = 1, .action = game_round_end_display_finished_blind},
+    {.delay = TM_DISPLAY_FIN_BLIND, .interval = 1, .runs = TM_DISPLAY_SCORE_MIN,
+     .action = game_round_end_display_score_min},
+    {.delay = TM_REWARD_INCREMENT_INTERVAL, .interval = TM_REWARD_INCREMENT_INTERVAL,
+     .runs = TIMELINE_UNTIL_DONE, .action = game_round_end_update_blind_reward},
+    {.delay = 1, .interval = 1, .runs = TM_TOP_LEFT_PANEL_ANIM,
+     .action = game_round_end_panel_exit},
+    {.delay = TM_REWARDS_PANEL_WAIT, .action = game_round_end_start_rewards},
+};
+// clang-format on
+
+static void game_round_end_on_init()
 {
-    Rect round_end_down = ROUND_END_MENU_RECT;
-    round_end_down.top--;
-    main_bg_se_copy_rect_1_tile_vert(round_end_down, SCREEN_DOWN);
+    START_SEQUENCE(TRACK_MAIN, _round_end_steps);
+}
 
-    if (timer >= TM_DISMISS_ROUND_END_TM)
+static void game_round_end_on_update()
+{
+    if (timeline_is_done(&_timeline))
     {
-        timer = TM_ZERO;
-        state_info[game_state].substate = ROUND_END_EXIT;
+        game_change_state(GAME_STATE_SHOP);
+        return;
     }
+
+    timeline_update(&_timeline);
 }
 
 static Rect get_text_rect_under_sprite_object(SpriteObject* sprite_object)
@@ -3808,8 +3545,7 @@ static void game_shop_create_items(void)
     if (no_avail_jokers())
         return;
 
-    list_clear(&_shop_jokers_list);
-    _shop_jokers_list = list_create();
+    vector_clear(&_shop_jokers_list);
 
     for (int i = 0; i < MAX_SHOP_JOKERS; i++)
     {
@@ -3836,9 +3572,17 @@ static void game_shop_create_items(void)
         if (joker_id == UNDEFINED)
             break;
 
-        set_shop_joker_avail(joker_id, false);
+        Joker* joker = joker_new(joker_id);
+        JokerObject* joker_object = joker_object_new(joker);
+
+        // Out of pooled Jokers, the pool stats show which one
+        if (joker_object == NULL)
+        {
+            joker_destroy(&joker);
+            break;
+        }
 
-        JokerObject* joker_object = joker_object_new(joker_new(joker_id));
+        set_shop_joker_avail(joker_id, false);
 
         joker_object->sprite_object->x = int2fx(120 + i * CARD_SPRITE_SIZE);
         joker_object->sprite_object->y = int2fx(160);
@@ -3853,47 +3597,76 @@ static void game_shop_create_items(void)
             fx2int(joker_object->sprite_object->y)
         );
 
-        list_push_back(&_shop_jokers_list, joker_object);
+        vector_push_back(&_shop_jokers_list, joker_object);
     }
 }
 
 // Intro sequence (menu and shop icon coming into frame)
-static void game_shop_intro()
+static bool game_shop_intro_pop_up(int run)
 {
     main_bg_se_copy_rect_1_tile_vert(POP_MENU_ANIM_RECT, SCREEN_UP);
+    return false;
+}
 
-    if (timer == TM_CREATE_SHOP_ITEMS_WAIT)
-    {
-        game_shop_create_items();
-    }
+static bool game_shop_intro_create_items(int run)
+{
+    game_shop_create_items();
+    return false;
+}
 
-    if (timer >= TM_SHIFT_SHOP_ICON_WAIT) // Shift the shop icon
-    {
-        int timer_offset = timer - 6;
+// Shift the shop icon
+static bool game_shop_intro_shift_icon(int run)
+{
+    int num_rows = run + 1;
 
-        // TODO: Extract to generic function?
-        for (int y = 0; y < timer_offset; y++)
-        {
-            int y_from = 26 + y - timer_offset;
-            int y_to = 0 + y;
+    // TODO: Extract to generic function?
+    for (int y = 0; y < num_rows; y++)
+    {
+        int y_from = 26 + y - num_rows;
+        int y_to = 0 + y;
 
-            Rect from = {0, y_from, 8, y_from};
-            BG_POINT to = {0, y_to};
+        Rect from = {0, y_from, 8, y_from};
+        BG_POINT to = {0, y_to};
 
-            main_bg_se_copy_rect(from, to);
-        }
+        main_bg_se_copy_rect(from, to);
     }
+    return false;
+}
 
-    if (timer == TM_END_GAME_SHOP_INTRO)
-    {
-        state_info[game_state].substate = GAME_SHOP_ACTIVE;
-        timer = TM_ZERO; // Reset the timer
-    }
+static bool game_shop_intro_end(int run)
+{
+    state_info[game_state].substate = GAME_SHOP_ACTIVE;
+
+    // The selection grid is initialized outside of bounds and moved
+    // to trigger the selection change so the initial selection is visible
+    shop_selection_grid.selection = SHOP_INIT_SEL;
+    selection_grid_move_selection_horz(&shop_selection_grid, 1);
+    tte_printf(
+        "#{P:%d,%d; cx:0x%X000}$%d",
+        SHOP_REROLL_RECT.left,
+        SHOP_REROLL_RECT.top,
+        TTE_WHITE_PB,
+        reroll_cost
+    );
+    return false;
 }
 
+// clang-format off
+static const TimelineStep _shop_intro_steps[] = {
+    {.delay = 1, .interval = 1, .runs = TM_POP_MENU_ANIM, .action = game_shop_intro_pop_up},
+    {.delay = 1, .action = game_shop_intro_end},
+};
+
+static const TimelineStep _shop_icon_steps[] = {
+    {.delay = 1, .action = game_shop_intro_create_items},
+    {.delay = TM_SHIFT_SHOP_ICON_WAIT, .interval = 1, .runs = TM_SHIFT_SHOP_ICON_ANIM,
+     .action = game_shop_intro_shift_icon},
+};
+// clang-format on
+
 static int jokers_sel_row_get_size(void)
 {
-    return list_get_len(&_owned_jokers_list);
+    return vector_get_len(&_owned_jokers_list);
 }
 
 static void jokers_sel_row_on_selection_changed(
@@ -3910,7 +3683,7 @@ static void jokers_sel_row_on_selection_changed(
     if (prev_selection->y == row_idx)
     {
         JokerObject* joker_object =
-            (JokerObject*)list_get_at_idx(&_owned_jokers_list, prev_selection->x);
+            (JokerObject*)vector_get_at_idx(&_owned_jokers_list, prev_selection->x);
         // Don't change focus from current Joker if swapping
         if (joker_object != NULL && !swapping)
         {
@@ -3922,7 +3695,7 @@ static void jokers_sel_row_on_selection_changed(
     if (new_selection->y == row_idx)
     {
         JokerObject* joker_object =
-            (JokerObject*)list_get_at_idx(&_owned_jokers_list, new_selection->x);
+            (JokerObject*)vector_get_at_idx(&_owned_jokers_list, new_selection->x);
         if (joker_object != NULL)
         {
             if (!swapping)
@@ -3944,11 +3717,12 @@ static void jokers_sel_row_on_selection_changed(
 
     if (swapping)
     {
-        list_swap(
+        vector_swap(
             &_owned_jokers_list,
             (unsigned int)prev_selection->x,
             (unsigned int)new_selection->x
         );
+        owned_jokers_on_change();
     }
 }
 
@@ -3956,15 +3730,15 @@ static inline void joker_start_discard_animation(JokerObject* joker_object)
 {
     joker_object->sprite_object->tx = int2fx(JOKER_DISCARD_TARGET.x);
     joker_object->sprite_object->ty = int2fx(JOKER_DISCARD_TARGET.y);
-    list_push_back(&_discarded_jokers_list, joker_object);
+    vector_push_back(&_discarded_jokers_list, joker_object);
 }
 
 static inline void game_sell_joker(int joker_idx)
 {
-    if (joker_idx < 0 || joker_idx >= list_get_len(&_owned_jokers_list))
+    if (joker_idx < 0 || joker_idx >= vector_get_len(&_owned_jokers_list))
         return;
 
-    JokerObject* joker_object = (JokerObject*)list_get_at_idx(&_owned_jokers_list, joker_idx);
+    JokerObject* joker_object = (JokerObject*)vector_get_at_idx(&_owned_jokers_list, joker_idx);
     money += joker_get_sell_value(joker_object->joker);
     display_money();
     erase_price_under_sprite_object(joker_object->sprite_object);
@@ -3976,7 +3750,7 @@ static inline void game_sell_joker(int joker_idx)
 
 static void jokers_sel_row_on_key_transit(SelectionGrid* selection_grid, Selection* selection)
 {
-    JokerObject* joker_object = (JokerObject*)list_get_at_idx(&_owned_jokers_list, selection->x);
+    JokerObject* joker_object = (JokerObject*)vector_get_at_idx(&_owned_jokers_list, selection->x);
     if (joker_object != NULL)
     {
         if (key_hit(SELECT_CARD))
@@ -4004,7 +3778,7 @@ static void jokers_sel_row_on_key_transit(SelectionGrid* selection_grid, Selecti
 static int shop_top_row_get_size(void)
 {
     // + 1 to account for next round button
-    return list_get_len(&_shop_jokers_list) + 1;
+    return vector_get_len(&_shop_jokers_list) + 1;
 }
 
 static inline void add_to_held_jokers(JokerObject* joker_object)
@@ -4015,14 +3789,14 @@ static inline void add_to_held_jokers(JokerObject* joker_object)
 
 static inline void game_shop_buy_joker(int shop_joker_idx)
 {
-    JokerObject* joker_object = (JokerObject*)list_get_at_idx(&_shop_jokers_list, shop_joker_idx);
+    JokerObject* joker_object = (JokerObject*)vector_get_at_idx(&_shop_jokers_list, shop_joker_idx);
 
     money -= joker_object->joker->value; // Deduct the money spent on the joker
     display_money();                     // Update the money display
     erase_price_under_sprite_object(joker_object->sprite_object);
     sprite_object_set_focus(joker_object->sprite_object, false);
     add_to_held_jokers(joker_object);
-    list_remove_at_idx(&_shop_jokers_list, shop_joker_idx); // Remove the joker from the shop
+    vector_remove_at_idx(&_shop_jokers_list, shop_joker_idx); // Remove the joker from the shop
 }
 
 static void shop_top_row_on_key_transit(SelectionGrid* selection_grid, Selection* selection)
@@ -4035,8 +3809,7 @@ static void shop_top_row_on_key_transit(SelectionGrid* selection_grid, Selection
         play_sfx(SFX_BUTTON, MM_BASE_PITCH_RATE, BUTTON_SFX_VOLUME);
 
         // Go to next blind selection game state
-        state_info[game_state].substate = GAME_SHOP_EXIT; // Go to the outro sequence state
-        timer = TM_ZERO;                                  // Reset the timer
+        game_shop_start_outro(); // Go to the outro sequence state
         reroll_cost = REROLL_BASE_COST;
 
         memcpy16(
@@ -4054,8 +3827,8 @@ static void shop_top_row_on_key_transit(SelectionGrid* selection_grid, Selection
     {
         int shop_joker_idx = selection->x - 1; // - 1 to account for next round button
         JokerObject* joker_object =
-            (JokerObject*)list_get_at_idx(&_shop_jokers_list, shop_joker_idx);
-        if (joker_object == NULL || list_get_len(&_owned_jokers_list) >= MAX_JOKERS_HELD_SIZE ||
+            (JokerObject*)vector_get_at_idx(&_shop_jokers_list, shop_joker_idx);
+        if (joker_object == NULL || vector_get_len(&_owned_jokers_list) >= MAX_JOKERS_HELD_SIZE ||
             money < joker_object->joker->value)
         {
             return;
@@ -4092,7 +3865,7 @@ static void shop_top_row_on_selection_changed(
         else
         {
             int idx = prev_selection->x - 1; // -1 to account for next round button
-            JokerObject* joker_object = (JokerObject*)list_get_at_idx(&_shop_jokers_list, idx);
+            JokerObject* joker_object = (JokerObject*)vector_get_at_idx(&_shop_jokers_list, idx);
             sprite_object_set_focus(joker_object->sprite_object, false);
             // -1 to account for next round button
         }
@@ -4108,7 +3881,7 @@ static void shop_top_row_on_selection_changed(
         else
         {
             int idx = new_selection->x - 1; // -1 to account for next round button
-            JokerObject* joker_object = (JokerObject*)list_get_at_idx(&_shop_jokers_list, idx);
+            JokerObject* joker_object = (JokerObject*)vector_get_at_idx(&_shop_jokers_list, idx);
             sprite_object_set_focus(joker_object->sprite_object, true);
         }
     }
@@ -4142,10 +3915,10 @@ static inline void game_shop_reroll(int* reroll_cost)
     money -= *reroll_cost;
     display_money(); // Update the money display
 
-    ListItr itr = list_itr_create(&_shop_jokers_list);
+    VectorItr itr = vector_itr_create(&_shop_jokers_list);
     JokerObject* joker_object;
 
-    while ((joker_object = list_itr_next(&itr)))
+    while ((joker_object = vector_itr_next(&itr)))
     {
         if (joker_object != NULL)
         {
@@ -4154,14 +3927,13 @@ static inline void game_shop_reroll(int* reroll_cost)
         }
     }
 
-    list_clear(&_shop_jokers_list);
-    _shop_jokers_list = list_create();
+    vector_clear(&_shop_jokers_list);
 
     game_shop_create_items();
 
-    itr = list_itr_create(&_shop_jokers_list);
+    itr = vector_itr_create(&_shop_jokers_list);
 
-    while ((joker_object = list_itr_next(&itr)))
+    while ((joker_object = vector_itr_next(&itr)))
     {
         if (joker_object != NULL)
         {
@@ -4201,27 +3973,12 @@ static void shop_reroll_row_on_key_transit(SelectionGrid* selection_grid, Select
 // Shop menu input and selection
 static void game_shop_process_user_input()
 {
-    if (timer == TM_SHOP_PRC_INPUT_START)
-    {
-        // The selection grid is initialized outside of bounds and moved
-        // to trigger the selection change so the initial selection is visible
-        shop_selection_grid.selection = SHOP_INIT_SEL;
-        selection_grid_move_selection_horz(&shop_selection_grid, 1);
-        tte_printf(
-            "#{P:%d,%d; cx:0x%X000}$%d",
-            SHOP_REROLL_RECT.left,
-            SHOP_REROLL_RECT.top,
-            TTE_WHITE_PB,
-            reroll_cost
-        );
-    }
-
     // Shop input logic
     selection_grid_process_input(&shop_selection_grid);
 }
 
 // Outro sequence (menu and shop icon going out of frame)
-static void game_shop_outro()
+static bool game_shop_outro(int run)
 {
     // Shift the shop panel
     main_bg_se_move_rect_1_tile_vert(POP_MENU_ANIM_RECT, SCREEN_DOWN);
@@ -4230,13 +3987,13 @@ static void game_shop_outro()
 
     // TODO: make heads or tails of what's going on here and replace
     // magic numbers.
-    if (timer == 1)
+    if (run == 0)
     {
         tte_erase_rect_wrapper(SHOP_PRICES_TEXT_RECT); // Erase the shop prices text
 
-        ListItr itr = list_itr_create(&_shop_jokers_list);
+        VectorItr itr = vector_itr_create(&_shop_jokers_list);
         JokerObject* joker_object;
-        while ((joker_object = list_itr_next(&itr)))
+        while ((joker_object = vector_itr_next(&itr)))
         {
             if (joker_object != NULL)
             {
@@ -4246,22 +4003,36 @@ static void game_shop_outro()
 
         reset_top_left_panel_bottom_row();
     }
-    else if (timer == 2)
+    else if (run == 1)
     {
         int y = 5;
         memset16(&se_mat[MAIN_BG_SBB][y - 1][0], 0x0001, 1);
         memset16(&se_mat[MAIN_BG_SBB][y - 1][1], 0x0002, 7);
         memset16(&se_mat[MAIN_BG_SBB][y - 1][8], SE_HFLIP | 0x0001, 1);
     }
+    return false;
+}
 
-    if (timer >= MENU_POP_OUT_ANIM_FRAMES)
-    {
-        state_info[game_state].substate = GAME_SHOP_MAX; // Go to the next state
-        timer = TM_ZERO;                                 // Reset the timer
-    }
+static bool game_shop_outro_end(int run)
+{
+    state_info[game_state].substate = GAME_SHOP_MAX; // Go to the next state
+    return false;
 }
 
-static inline void game_shop_lights_anim_frame(void)
+// clang-format off
+static const TimelineStep _shop_outro_steps[] = {
+    {.delay = 1, .interval = 1, .runs = MENU_POP_OUT_ANIM_FRAMES, .action = game_shop_outro},
+    {.action = game_shop_outro_end},
+};
+// clang-format on
+
+static void game_shop_start_outro(void)
+{
+    state_info[game_state].substate = GAME_SHOP_EXIT;
+    START_SEQUENCE(TRACK_MAIN, _shop_outro_steps);
+}
+
+static bool game_shop_lights_anim_frame(int run)
 {
     // Shift palette around the border of the shop icon
     COLOR shifted_palette[4];
@@ -4285,17 +4056,33 @@ static inline void game_shop_lights_anim_frame(void)
     memcpy16(&pal_bg_mem[SHOP_LIGHTS_3_PID], &shifted_palette[1], 1);
     memcpy16(&pal_bg_mem[SHOP_LIGHTS_4_PID], &shifted_palette[2], 1);
     memcpy16(&pal_bg_mem[SHOP_LIGHTS_1_PID], &shifted_palette[3], 1);
+    return false;
+}
+
+// clang-format off
+// The lights start blinking once the shop panel is up, until the shop is left
+static const TimelineStep _shop_lights_steps[] = {
+    {.delay = TM_POP_MENU_ANIM + TM_SHOP_LIGHTS_INTERVAL, .interval = TM_SHOP_LIGHTS_INTERVAL,
+     .runs = TIMELINE_UNTIL_DONE, .action = game_shop_lights_anim_frame},
+};
+// clang-format on
+
+static void game_shop_on_init()
+{
+    START_SEQUENCE(TRACK_MAIN, _shop_intro_steps);
+    START_SEQUENCE(TRACK_SHOP_ICON, _shop_icon_steps);
+    START_SEQUENCE(TRACK_SHOP_LIGHTS, _shop_lights_steps);
 }
 
 static void game_shop_on_update()
 {
     change_background(BG_SHOP);
 
-    if (!list_is_empty(&_shop_jokers_list))
+    if (!vector_is_empty(&_shop_jokers_list))
     {
-        ListItr itr = list_itr_create(&_shop_jokers_list);
+        VectorItr itr = vector_itr_create(&_shop_jokers_list);
         JokerObject* joker_object;
-        while ((joker_object = list_itr_next(&itr)))
+        while ((joker_object = vector_itr_next(&itr)))
         {
             if (joker_object != NULL)
             {
@@ -4304,28 +4091,26 @@ static void game_shop_on_update()
         }
     }
 
-    if (timer % 20 == 0)
-    {
-        game_shop_lights_anim_frame();
-    }
-
     if (state_info[game_state].substate == GAME_SHOP_MAX)
     {
         game_change_state(GAME_STATE_BLIND_SELECT);
         return;
     }
 
-    int substate = state_info[game_state].substate;
+    timeline_update(&_timeline);
 
-    shop_state_actions[substate]();
+    if (state_info[game_state].substate == GAME_SHOP_ACTIVE)
+    {
+        game_shop_process_user_input();
+    }
 }
 
 static void game_shop_on_exit()
 {
-    ListItr itr = list_itr_create(&_shop_jokers_list);
+    VectorItr itr = vector_itr_create(&_shop_jokers_list);
     JokerObject* joker_object;
 
-    while ((joker_object = list_itr_next(&itr)))
+    while ((joker_object = vector_itr_next(&itr)))
     {
         if (joker_object != NULL)
         {
@@ -4335,57 +4120,133 @@ static void game_shop_on_exit()
         joker_object_destroy(&joker_object); // Destroy the joker objects
     }
 
-    list_clear(&_shop_jokers_list);
+    vector_clear(&_shop_jokers_list);
 
     increment_blind(BLIND_STATE_DEFEATED); // TODO: Move to game_round_end()?
 }
 
-static void game_blind_select_on_init()
+static bool game_blind_select_pop_up(int run)
 {
-    change_background(BG_BLIND_SELECT);
+    main_bg_se_copy_rect_1_tile_vert(POP_MENU_ANIM_RECT, SCREEN_UP);
 
-    play_sfx(SFX_POP, MM_BASE_PITCH_RATE, SFX_DEFAULT_VOLUME);
+    for (int i = 0; i < BLIND_TYPE_MAX; i++)
+    {
+        sprite_position(
+            blind_select_tokens[i],
+            blind_select_tokens[i]->pos.x,
+            blind_select_tokens[i]->pos.y - TILE_SIZE
+        );
+    }
+    return false;
 }
 
-static void game_blind_select_on_update()
+static bool game_blind_select_start(int run)
 {
-    if (state_info[game_state].substate == BLIND_SELECT_MAX)
+    state_info[game_state].substate = BLIND_SELECT;
+
+    if (current_blind == BLIND_TYPE_BOSS)
     {
-        game_change_state(GAME_STATE_PLAYING);
-        return;
+        selection_y = 0;
     }
-
-    int substate = state_info[game_state].substate;
-    blind_select_state_actions[substate]();
+    return false;
 }
 
-static void game_blind_select_start_anim_seq()
+static bool game_blind_select_pop_down(int run)
 {
-    main_bg_se_copy_rect_1_tile_vert(POP_MENU_ANIM_RECT, SCREEN_UP);
+    Rect blinds_rect = POP_MENU_ANIM_RECT;
+    blinds_rect.top -= 1; // Because of the raised blind
+    main_bg_se_move_rect_1_tile_vert(blinds_rect, SCREEN_DOWN);
 
     for (int i = 0; i < BLIND_TYPE_MAX; i++)
     {
         sprite_position(
             blind_select_tokens[i],
             blind_select_tokens[i]->pos.x,
-            blind_select_tokens[i]->pos.y - TILE_SIZE
+            blind_select_tokens[i]->pos.y + TILE_SIZE
         );
     }
+    return false;
+}
 
-    if (timer == TM_END_ANIM_SEQ)
+static bool game_blind_select_hide_tokens(int run)
+{
+    for (int i = 0; i < BLIND_TYPE_MAX; i++)
     {
-        state_info[game_state].substate = BLIND_SELECT;
-        timer = TM_ZERO; // Reset the timer
+        sprite_hide(blind_select_tokens[i]);
     }
+
+    state_info[game_state].substate = DISPLAY_BLIND_PANEL;
+    return false;
 }
 
-static void game_blind_select_handle_input()
+static bool game_blind_select_display_blind_panel(int run)
 {
-    if (timer == TM_BLIND_SELECT_START && current_blind == BLIND_TYPE_BOSS)
+    // Switches to the selecting background and clears the blind panel area
+    if (run == 0)
     {
-        selection_y = 0;
+        change_background(BG_CARD_SELECTING);
+
+        main_bg_se_clear_rect(ROUND_END_MENU_RECT);
+
+        for (int y = 0; y < 5; y++)
+        {
+            int y_from = 28;
+            int y_to = 0 + y;
+
+            Rect from = {0, y_from, 8, y_from + 1};
+            BG_POINT to = {0, y_to};
+
+            main_bg_se_copy_rect(from, to);
+        }
+
+        reset_top_left_panel_bottom_row();
+    }
+
+    // Shift the blind panel down onto screen
+    int num_rows = run + 1;
+
+    for (int y = 0; y < num_rows; y++)
+    {
+        int y_from = 26 + y - num_rows;
+        int y_to = 0 + y;
+
+        Rect from = {0, y_from, 8, y_from};
+        BG_POINT to = {0, y_to};
+
+        main_bg_se_copy_rect(from, to);
     }
+    return false;
+}
+
+static bool game_blind_select_end(int run)
+{
+    state_info[game_state].substate = BLIND_SELECT_MAX;
+    return false;
+}
+
+// clang-format off
+static const TimelineStep _blind_select_start_steps[] = {
+    {.delay = 1, .action = game_blind_select_start},
+};
+
+static const TimelineStep _blind_select_intro_steps[] = {
+    {.delay = 1, .interval = 1, .runs = TM_POP_MENU_ANIM, .action = game_blind_select_pop_up},
+    {.delay = 1, .action = game_blind_select_start},
+};
+
+static const TimelineStep _blind_select_selected_steps[] = {
+    {.delay = 1, .interval = 1, .runs = TM_BLIND_SELECTED_ANIM,
+     .action = game_blind_select_pop_down},
+    {.delay = MENU_POP_OUT_ANIM_FRAMES - TM_BLIND_SELECTED_ANIM,
+     .action = game_blind_select_hide_tokens},
+    {.delay = 1, .interval = 1, .runs = TM_BLIND_PANEL_ANIM,
+     .action = game_blind_select_display_blind_panel},
+    {.delay = 1, .action = game_blind_select_end},
+};
+// clang-format on
 
+static void game_blind_select_handle_input()
+{
     // Blind select input logic
     if (key_hit(KEY_UP))
     {
@@ -4401,7 +4262,7 @@ static void game_blind_select_handle_input()
         {
             play_sfx(SFX_BUTTON, MM_BASE_PITCH_RATE, BUTTON_SFX_VOLUME);
             state_info[game_state].substate = BLIND_SELECTED_ANIM_SEQ;
-            timer = TM_ZERO;
+            START_SEQUENCE(TRACK_MAIN, _blind_select_selected_steps);
             display_round(++round);
         }
         else if (current_blind != BLIND_TYPE_BOSS)
@@ -4427,7 +4288,7 @@ static void game_blind_select_handle_input()
                 );
             }
 
-            timer = TM_ZERO;
+            START_SEQUENCE(TRACK_MAIN, _blind_select_start_steps);
         }
     }
 
@@ -4453,74 +4314,28 @@ static void game_blind_select_handle_input()
     }
 }
 
-static void game_blind_select_selected_anim_seq()
+static void game_blind_select_on_init()
 {
-    if (timer < 15)
-    {
-        Rect blinds_rect = POP_MENU_ANIM_RECT;
-        blinds_rect.top -= 1; // Because of the raised blind
-        main_bg_se_move_rect_1_tile_vert(blinds_rect, SCREEN_DOWN);
+    change_background(BG_BLIND_SELECT);
 
-        for (int i = 0; i < BLIND_TYPE_MAX; i++)
-        {
-            sprite_position(
-                blind_select_tokens[i],
-                blind_select_tokens[i]->pos.x,
-                blind_select_tokens[i]->pos.y + TILE_SIZE
-            );
-        }
-    }
-    else if (timer >= MENU_POP_OUT_ANIM_FRAMES)
-    {
-        for (int i = 0; i < BLIND_TYPE_MAX; i++)
-        {
-            obj_hide(blind_select_tokens[i]->obj);
-        }
+    play_sfx(SFX_POP, MM_BASE_PITCH_RATE, SFX_DEFAULT_VOLUME);
 
-        state_info[game_state].substate = DISPLAY_BLIND_PANEL; // Reset the state
-        timer = TM_ZERO;                                       // Reset the timer
-    }
+    START_SEQUENCE(TRACK_MAIN, _blind_select_intro_steps);
 }
 
-static void game_blind_select_display_blind_panel()
+static void game_blind_select_on_update()
 {
-    if (timer >= TM_DISP_BLIND_PANEL_FINISH)
+    if (state_info[game_state].substate == BLIND_SELECT_MAX)
     {
-        state_info[game_state].substate = BLIND_SELECT_MAX;
+        game_change_state(GAME_STATE_PLAYING);
         return;
     }
 
-    // Switches to the selecting background and clears the blind panel area
-    if (timer == TM_DISP_BLIND_PANEL_START)
-    {
-        change_background(BG_CARD_SELECTING);
-
-        main_bg_se_clear_rect(ROUND_END_MENU_RECT);
-
-        for (int y = 0; y < 5; y++)
-        {
-            int y_from = 28;
-            int y_to = 0 + y;
+    timeline_update(&_timeline);
 
-            Rect from = {0, y_from, 8, y_from + 1};
-            BG_POINT to = {0, y_to};
-
-            main_bg_se_copy_rect(from, to);
-        }
-
-        reset_top_left_panel_bottom_row();
-    }
-
-    // Shift the blind panel down onto screen
-    for (int y = 0; y < timer; y++)
+    if (state_info[game_state].substate == BLIND_SELECT)
     {
-        int y_from = 26 + y - timer;
-        int y_to = 0 + y;
-
-        Rect from = {0, y_from, 8, y_from};
-        BG_POINT to = {0, y_to};
-
-        main_bg_se_copy_rect(from, to);
+        game_blind_select_handle_input();
     }
 }
 
@@ -4681,10 +4496,10 @@ static void game_lose_on_update()
 // util we decide what we want to do after a game over.
 static void game_over_on_exit()
 {
-    ListItr itr = list_itr_create(&_owned_jokers_list);
+    VectorItr itr = vector_itr_create(&_owned_jokers_list);
     JokerObject* joker_object;
 
-    while ((joker_object = list_itr_next(&itr)))
+    while ((joker_object = vector_itr_next(&itr)))
     {
         joker_object_destroy(&joker_object);
     }
@@ -4700,10 +4515,10 @@ static void game_over_on_exit()
     sprite_destroy(&blind_select_tokens[BLIND_TYPE_BIG]);
     sprite_destroy(&blind_select_tokens[BLIND_TYPE_BOSS]);
 
-    list_clear(&_owned_jokers_list);
-    list_clear(&_discarded_jokers_list);
-    list_clear(&_expired_jokers_list);
-    list_clear(&_shop_jokers_list);
+    vector_clear(&_owned_jokers_list);
+    vector_clear(&_discarded_jokers_list);
+    vector_clear(&_expired_jokers_list);
+    vector_clear(&_shop_jokers_list);
 
     game_init();
 
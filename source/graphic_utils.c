@@ -341,6 +341,29 @@ void memcpy32_tile8_with_palette_offset(u32* dst, const u32* src, uint wcount, u
     }
 }
 
+void memcpy32_tile4_with_palette_remap(
+    u32* dst,
+    const u32* src,
+    uint wcount,
+    const u8 palette_remap[PAL_ROW_LEN]
+)
+{
+    // Remap both pixels of a byte at once
+    u8 byte_remap[256];
+    for (int i = 0; i < 256; i++)
+    {
+        byte_remap[i] = palette_remap[i & 0xF] | (palette_remap[i >> 4] << 4);
+    }
+
+    for (int i = 0; i < wcount; i++)
+    {
+        u32 word = src[i];
+        // VRAM can't be written a byte at a time, the word is built before being written
+        dst[i] = byte_remap[word & 0xFF] | (byte_remap[(word >> 8) & 0xFF] << 8) |
+                 (byte_remap[(word >> 16) & 0xFF] << 16) | ((u32)byte_remap[word >> 24] << 24);
+    }
+}
+
 void toggle_windows(bool win0, bool win1)
 {
     if (win0)
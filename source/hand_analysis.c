@@ -3,40 +3,64 @@
 #include "card.h"
 #include "game.h"
 
-void get_hand_distribution(u8* ranks_out, u8* suits_out)
+// find_straight_in_played_cards() works on rank masks extended with a low ace below TWO:
+// bit 0 is the low ace and bit n + 1 is rank n, so the high ace is bit 13. Whether there is a
+// straight at all is looked up in hand_straight_lut instead.
+#define ACE_LOW_EXTENDED_BITS (NUM_RANKS + 1)
+
+static inline u32 s_ace_low_extended(u16 rank_mask)
 {
-    for (int i = 0; i < NUM_RANKS; i++)
-        ranks_out[i] = 0;
-    for (int i = 0; i < NUM_SUITS; i++)
-        suits_out[i] = 0;
+    return (rank_mask << 1) | ((rank_mask >> ACE) & 1);
+}
 
-    CardObject** cards = get_hand_array();
-    int top = get_hand_top();
-    for (int i = 0; i <= top; i++)
+static inline u16 s_ace_low_reduced(u32 extended_mask)
+{
+    return (extended_mask >> 1) | ((extended_mask & 1) << ACE);
+}
+
+// Cards that continue a straight ending on the bits of chain_ends, Shortcut allows skipping a rank
+static inline u32 s_straight_chain_step(u32 chain_ends, u32 extended_mask, bool shortcut_active)
+{
+    u32 next = chain_ends << 1;
+    if (shortcut_active)
+        next |= chain_ends << 2;
+    return next & extended_mask;
+}
+
+// Fills chains[n] with the mask of bits that end a straight of at least n + 1 cards and returns
+// the length of the longest straight, chains needs room for ACE_LOW_EXTENDED_BITS entries
+static int s_straight_chains(u32 extended_mask, bool shortcut_active, u32* chains)
+{
+    int len = 0;
+    for (u32 chain_ends = extended_mask; chain_ends != 0;
+         chain_ends = s_straight_chain_step(chain_ends, extended_mask, shortcut_active))
     {
-        if (cards[i] && card_object_is_selected(cards[i]))
-        {
-            ranks_out[cards[i]->card->rank]++;
-            suits_out[cards[i]->card->suit]++;
-        }
+        chains[len++] = chain_ends;
     }
+    return len;
 }
 
-void get_played_distribution(u8* ranks_out, u8* suits_out)
+void hand_masks_add_card(HandMasks* masks, const Card* card)
 {
-    for (int i = 0; i < NUM_RANKS; i++)
-        ranks_out[i] = 0;
-    for (int i = 0; i < NUM_SUITS; i++)
-        suits_out[i] = 0;
+    u16 rank_bit = 1 << card->rank;
+
+    // Each count layer gains the rank if the layer below already had it
+    masks->quads |= masks->trips & rank_bit;
+    masks->trips |= masks->pairs & rank_bit;
+    masks->pairs |= masks->ranks & rank_bit;
+    masks->ranks |= rank_bit;
+    masks->suits[card->suit] |= rank_bit;
+}
 
-    CardObject** played = get_played_array();
-    int top = get_played_top();
+void hand_masks_from_cards(HandMasks* masks, CardObject** cards, int top)
+{
+    *masks = (HandMasks){0};
     for (int i = 0; i <= top; i++)
     {
-        if (!played[i])
-            continue;
-        ranks_out[played[i]->card->rank]++;
-        suits_out[played[i]->card->suit]++;
+        if (cards[i] && cards[i]->card)
+        {
+            hand_masks_add_card(masks, cards[i]->card);
+        }
     }
 }
 
@@ -90,126 +114,143 @@ bool hand_contains_full_house(u8* ranks)
     return (count_three >= 2 || (count_three && count_pair));
 }
 
-// This is mostly from Google Gemini
-bool hand_contains_straight(u8* ranks)
+bool hand_contains_straight(u16 rank_mask)
+{
+    u8 straight_variant = HAND_STRAIGHT_LUT_VARIANT(
+        is_shortcut_joker_active(),
+        get_straight_and_flush_size() <= STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS
+    );
+    return hand_straight_lut[rank_mask] & straight_variant;
+}
+
+bool hand_contains_flush(u8* suits)
 {
-    if (!is_shortcut_joker_active())
+    for (int i = 0; i < NUM_SUITS; i++)
     {
-        int straight_size = get_straight_and_flush_size();
-        // This is the regular case of detecting straights
-        int run = 0;
-        for (int i = 0; i < NUM_RANKS; ++i)
+        if (suits[i] >= get_straight_and_flush_size())
         {
-            if (ranks[i])
-            {
-                if (++run >= straight_size)
-                    return true;
-            }
-            else
-            {
-                run = 0;
-            }
+            return true;
         }
+    }
+    return false;
+}
 
-        // Check for ace low straight
-        if (straight_size >= 2 && ranks[ACE])
-        {
-            // With A as low, the highest rank you can use is FIVE.
-            // -1 for inclusive integer distance and another -1 for the Ace e.g. need=5 -> need 2..5
-            int last_needed = TWO + (straight_size - 2);
-            if (last_needed <= FIVE)
-            {
-                bool ok = true;
-                for (int r = TWO; r <= last_needed; ++r)
-                {
-                    if (!ranks[r])
-                    {
-                        ok = false;
-                        break;
-                    }
-                }
-                if (ok)
-                    return true;
-            }
-        }
+// Hands are classified by a signature of their rank counts: the highest count (clamped to 5) and
+// the second highest (clamped to 2), that is all the n-of-a-kind, full house and two pair checks
+// need to know
+#define KIND_SIGNATURE_MAX_N      5
+#define KIND_SIGNATURE_MAX_SECOND 2
+#define NUM_KIND_SIGNATURES       ((KIND_SIGNATURE_MAX_N + 1) * (KIND_SIGNATURE_MAX_SECOND + 1))
 
-        return false;
+enum StraightKind
+{
+    STRAIGHT_KIND_NONE,
+    STRAIGHT_KIND_STRAIGHT,
+    // Straight with TEN to ACE present, a Royal Flush if it is also a flush
+    STRAIGHT_KIND_ROYAL,
+    NUM_STRAIGHT_KINDS
+};
+
+#define ROYAL_RANKS_MASK ((1 << TEN) | (1 << JACK) | (1 << QUEEN) | (1 << KING) | (1 << ACE))
+
+// clang-format off
+#define NO_KIND_ROW(kind_hand_type)                                                               \
+    {                                                                                             \
+        {kind_hand_type, STRAIGHT, STRAIGHT},                                                     \
+        {FLUSH, STRAIGHT_FLUSH, ROYAL_FLUSH}                                                      \
     }
-    else
-    {
-        // Shortcut Joker is active, we have to detect straights where any card may "skip" 1 rank
-        // We do this with a dynamic programming algorithm that calculates
-        // the longest possible straight that can end on each rank
-        // and stopping when we find one that is {straight-size} cards long
-        u8 longest_short_cut_at[NUM_RANKS] = {0};
-
-        // A low ace can start a sequence. 'ace_low_len' is 1 if an ace is present,
-        // acting as a potential predecessor for TWO and THREE.
-        int ace_low_len = ranks[ACE] ? 1 : 0;
-
-        // Iterate through all ranks from TWO up to ACE.
-        for (int i = 0; i < NUM_RANKS; i++)
-        {
-            // No cards in this rank, no straight can end here, continue
-            if (ranks[i] == 0)
-            {
-                longest_short_cut_at[i] = 0;
-                continue;
-            }
 
-            int prev_len1 = 0;
-            int prev_len2 = 0;
+// Indexed by [kind signature][flush][enum StraightKind]
+static const u8 _hand_type_lut[NUM_KIND_SIGNATURES][2][NUM_STRAIGHT_KINDS] = {
+    // No cards
+    NO_KIND_ROW(HIGH_CARD),
+    NO_KIND_ROW(HIGH_CARD),
+    NO_KIND_ROW(HIGH_CARD),
+    // High card
+    NO_KIND_ROW(HIGH_CARD),
+    NO_KIND_ROW(HIGH_CARD),
+    NO_KIND_ROW(HIGH_CARD),
+    // Pair
+    NO_KIND_ROW(PAIR),
+    NO_KIND_ROW(PAIR),
+    NO_KIND_ROW(TWO_PAIR),
+    // Three of a kind
+    NO_KIND_ROW(THREE_OF_A_KIND),
+    NO_KIND_ROW(THREE_OF_A_KIND),
+    {
+        {FULL_HOUSE, FULL_HOUSE, FULL_HOUSE},
+        {FULL_HOUSE, STRAIGHT_FLUSH, ROYAL_FLUSH}
+    },
+    // Four of a kind
+    {
+        {FOUR_OF_A_KIND, FOUR_OF_A_KIND, FOUR_OF_A_KIND},
+        {FOUR_OF_A_KIND, STRAIGHT_FLUSH, ROYAL_FLUSH}
+    },
+    {
+        {FOUR_OF_A_KIND, FOUR_OF_A_KIND, FOUR_OF_A_KIND},
+        {FOUR_OF_A_KIND, STRAIGHT_FLUSH, ROYAL_FLUSH}
+    },
+    {
+        {FOUR_OF_A_KIND, FOUR_OF_A_KIND, FOUR_OF_A_KIND},
+        {FOUR_OF_A_KIND, STRAIGHT_FLUSH, ROYAL_FLUSH}
+    },
+    // Five of a kind
+    {
+        {FIVE_OF_A_KIND, FIVE_OF_A_KIND, FIVE_OF_A_KIND},
+        {FLUSH_FIVE, FLUSH_FIVE, FLUSH_FIVE}
+    },
+    {
+        {FIVE_OF_A_KIND, FIVE_OF_A_KIND, FIVE_OF_A_KIND},
+        {FLUSH_FIVE, FLUSH_FIVE, FLUSH_FIVE}
+    },
+    {
+        {FIVE_OF_A_KIND, FIVE_OF_A_KIND, FIVE_OF_A_KIND},
+        {FLUSH_FIVE, FLUSH_FIVE, FLUSH_FIVE}
+    },
+};
+// clang-format on
 
-            // This logic handles the special connections for ace-low straights.
-            if (i == TWO)
-            {
-                // A TWO can be preceded by a low ACE (no skip).
-                prev_len1 = ace_low_len;
-            }
-            else if (i == THREE)
-            {
-                // A THREE can be preceded by a TWO (no skip) or a low ACE (skip).
-                prev_len1 = longest_short_cut_at[TWO];
-                prev_len2 = ace_low_len;
-            }
-            else if (i == ACE)
-            {
-                // An ACE (as the highest card) can be preceded by a KING or a QUEEN.
-                prev_len1 = longest_short_cut_at[KING];
-                prev_len2 = longest_short_cut_at[QUEEN];
-            }
-            else // For all other cards (FOUR through KING).
-            {
-                // A card can be preceded by the rank directly below or two ranks below.
-                prev_len1 = longest_short_cut_at[i - 1];
-                prev_len2 = longest_short_cut_at[i - 2];
-            }
+enum HandType hand_get_type_from_distribution(u8* ranks, u8* suits)
+{
+    u32 rank_mask = 0;
+    u8 highest_n = 0;
+    u8 second_n = 0;
 
-            // The length of the straight ending at rank 'i' is 1 (for the card itself)
-            // plus the length of the longest valid preceding straight.
-            longest_short_cut_at[i] = 1 + max(prev_len1, prev_len2);
+    for (int i = 0; i < NUM_RANKS; i++)
+    {
+        u8 count = ranks[i];
+        rank_mask |= (count != 0) << i;
 
-            // If we've formed a sequence of {straight-size} or more cards, we have a straight.
-            if (longest_short_cut_at[i] >= get_straight_and_flush_size())
-            {
-                return true;
-            }
+        if (count > highest_n)
+        {
+            second_n = highest_n;
+            highest_n = count;
+        }
+        else if (count > second_n)
+        {
+            second_n = count;
         }
     }
 
-    return false;
-}
+    int straight_and_flush_size = get_straight_and_flush_size();
 
-bool hand_contains_flush(u8* suits)
-{
+    bool flush = false;
     for (int i = 0; i < NUM_SUITS; i++)
     {
-        if (suits[i] >= get_straight_and_flush_size())
-        {
-            return true;
-        }
+        flush |= suits[i] >= straight_and_flush_size;
     }
-    return false;
+
+    enum StraightKind straight_kind = STRAIGHT_KIND_NONE;
+    if (hand_contains_straight(rank_mask))
+    {
+        straight_kind = (rank_mask & ROYAL_RANKS_MASK) == ROYAL_RANKS_MASK ? STRAIGHT_KIND_ROYAL
+                                                                           : STRAIGHT_KIND_STRAIGHT;
+    }
+
+    int kind_signature = min(highest_n, KIND_SIGNATURE_MAX_N) * (KIND_SIGNATURE_MAX_SECOND + 1) +
+                         min(second_n, KIND_SIGNATURE_MAX_SECOND);
+
+    return _hand_type_lut[kind_signature][flush][straight_kind];
 }
 
 // Returns the number of cards in the best flush found
@@ -232,11 +273,14 @@ int find_flush_in_played_cards(CardObject** played, int top, int min_len, bool*
     for (int i = 0; i <= top; i++)
         out_selection[i] = false;
 
+    // Masks of the played indices of each suit, counted as they are built so no popcount is needed
+    u32 suit_cards[NUM_SUITS] = {0};
     int suit_counts[NUM_SUITS] = {0};
     for (int i = 0; i <= top; i++)
     {
         if (played[i] && played[i]->card)
         {
+            suit_cards[played[i]->card->suit] |= 1 << i;
             suit_counts[played[i]->card->suit]++;
         }
     }
@@ -252,22 +296,18 @@ int find_flush_in_played_cards(CardObject** played, int top, int min_len, bool*
         }
     }
 
-    if (best_count >= min_len)
+    if (best_suit < 0 || best_count < min_len)
+        return 0;
+
+    for (u32 cards = suit_cards[best_suit]; cards != 0; cards &= cards - 1)
     {
-        for (int i = 0; i <= top; i++)
-        {
-            if (played[i] && played[i]->card && played[i]->card->suit == best_suit)
-            {
-                out_selection[i] = true;
-            }
-        }
-        return best_count;
+        out_selection[__builtin_ctz(cards)] = true;
     }
-    return 0;
+    return best_count;
 }
 
 // Returns the number of cards in the best straight or 0 if no straight of min_len is found, marks
-// as true them in out_selection[]. This is mostly from Google Gemini
+// as true them in out_selection[].
 int find_straight_in_played_cards(
     CardObject** played,
     int top,
@@ -281,140 +321,41 @@ int find_straight_in_played_cards(
     for (int i = 0; i <= top; i++)
         out_selection[i] = false;
 
-    // --- Setup for Backtracking DP ---
-    u8 longest_straight_at[NUM_RANKS] = {0};
-    int parent[NUM_RANKS];
-    for (int i = 0; i < NUM_RANKS; i++)
-        parent[i] = -1;
-
-    u8 ranks[NUM_RANKS] = {0};
-    for (int i = 0; i <= top; i++)
-    {
-        if (played[i] && played[i]->card)
-        {
-            ranks[played[i]->card->rank]++;
-        }
-    }
-
-    // --- Run DP to find longest straight ---
-    // This is nearly identical to hand_contains_straight() logic
-    // TODO: Consolidate functions to avoid code duplication?
-    // Might cost performance because this does a little more
-    int ace_low_len = ranks[ACE] ? 1 : 0;
-    for (int i = 0; i < NUM_RANKS; i++)
-    {
-        if (ranks[i] > 0)
-        {
-            int prev1 = 0, prev2 = 0;
-            int parent1 = -1, parent2 = -1;
+    HandMasks masks;
+    hand_masks_from_cards(&masks, played, top);
 
-            if (shortcut_active)
-            {
-                if (i == TWO)
-                {
-                    prev1 = ace_low_len;
-                    parent1 = ACE;
-                }
-                else if (i == THREE)
-                {
-                    prev1 = longest_straight_at[TWO];
-                    parent1 = TWO;
-                    prev2 = ace_low_len;
-                    parent2 = ACE;
-                }
-                else if (i == ACE)
-                {
-                    prev1 = longest_straight_at[KING];
-                    parent1 = KING;
-                    prev2 = longest_straight_at[QUEEN];
-                    parent2 = QUEEN;
-                }
-                else
-                {
-                    prev1 = longest_straight_at[i - 1];
-                    parent1 = i - 1;
-                    if (i > 1)
-                    {
-                        prev2 = longest_straight_at[i - 2];
-                        parent2 = i - 2;
-                    }
-                }
-            }
-            else
-            {
-                if (i == TWO)
-                {
-                    prev1 = ace_low_len;
-                    parent1 = ACE;
-                }
-                else if (i == ACE)
-                {
-                    prev1 = longest_straight_at[KING];
-                    parent1 = KING;
-                }
-                else
-                {
-                    prev1 = longest_straight_at[i - 1];
-                    parent1 = i - 1;
-                }
-            }
+    // chains[n] has the ends of the straights of n + 1 cards, the last one is the longest straight
+    u32 chains[ACE_LOW_EXTENDED_BITS];
+    int best_len = s_straight_chains(s_ace_low_extended(masks.ranks), shortcut_active, chains);
 
-            // Parallels longest_short_cut_at[i] = 1 + max(prev_len1, prev_len2);
-            // in hand_contains_straight()
-            if (prev1 >= prev2)
-            {
-                longest_straight_at[i] = 1 + prev1;
-                parent[i] = parent1;
-            }
-            else
-            {
-                longest_straight_at[i] = 1 + prev2;
-                parent[i] = parent2;
-            }
-        }
-    }
+    if (best_len == 0 || best_len < min_len)
+        return 0;
 
-    // --- Find best straight and backtrack ---
-    int best_len = 0;
-    int end_rank = -1;
-    for (int i = 0; i < NUM_RANKS; i++)
+    // Walk the longest straight back from its highest end, preferring the rank right below like
+    // the original DP did when two predecessors were equally long
+    u32 end_bit = 31 - __builtin_clz(chains[best_len - 1]);
+    u32 needed_bits = 0;
+    for (int len = best_len - 1; len >= 0; len--)
     {
-        if (longest_straight_at[i] >= best_len)
+        needed_bits |= 1 << end_bit;
+        if (len > 0)
         {
-            best_len = longest_straight_at[i];
-            end_rank = i;
+            end_bit = (chains[len - 1] & (1 << (end_bit - 1))) ? end_bit - 1 : end_bit - 2;
         }
     }
 
-    if (best_len >= min_len)
+    u16 needed_ranks = s_ace_low_reduced(needed_bits);
+    int final_card_count = 0;
+    for (int i = 0; i <= top; i++)
     {
-        u8 needed_ranks[NUM_RANKS] = {0};
-        int current_rank = end_rank;
-        while (current_rank != -1 && best_len > 0)
-        {
-            needed_ranks[current_rank]++;
-            current_rank = parent[current_rank];
-            best_len--;
-        }
-
-        for (int i = 0; i <= top; i++)
-        {
-            if (played[i] && played[i]->card && needed_ranks[played[i]->card->rank] > 0)
-            {
-                out_selection[i] = true;
-                needed_ranks[played[i]->card->rank]--;
-            }
-        }
-
-        int final_card_count = 0;
-        for (int i = 0; i <= top; i++)
+        if (played[i] && played[i]->card && (needed_ranks & (1 << played[i]->card->rank)))
         {
-            if (out_selection[i])
-                final_card_count++;
+            out_selection[i] = true;
+            needed_ranks &= ~(1 << played[i]->card->rank);
+            final_card_count++;
         }
-        return final_card_count;
     }
-    return 0;
+    return final_card_count;
 }
 
 // This is used for the special case in "Four Fingers" where you can add a pair into a straight
@@ -0,0 +1,690 @@
+// Generated by scripts/generate_hand_straight_lut.py, do not edit
+#include "hand_analysis.h"
+
+// clang-format off
+const u8 hand_straight_lut[HAND_STRAIGHT_LUT_SIZE] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc,
+    0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc,
+    0x8, 0xc, 0xc, 0xe, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc,
+    0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xc, 0xe, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xc, 0x8, 0x8, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc,
+    0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc,
+    0x0, 0x0, 0x8, 0xc, 0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc, 0x8, 0x8, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0x8, 0x8, 0x8, 0x8,
+    0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xe, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x8, 0x8, 0x8, 0x8,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc, 0xa, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc,
+    0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc, 0xa, 0xa, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc,
+    0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x8, 0x8, 0x8, 0x8,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0xa, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc,
+    0x0, 0x0, 0x8, 0xc, 0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc,
+    0x8, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xc, 0xe, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xc, 0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc, 0x8, 0x8, 0xc, 0xc,
+    0xe, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xc, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc, 0xa, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc,
+    0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc,
+    0x8, 0xc, 0xc, 0xe, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc,
+    0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0xa, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xa, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc,
+    0x0, 0x0, 0x8, 0xc, 0xa, 0xe, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xf, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc, 0xa, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc,
+    0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc, 0xa, 0xa, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc,
+    0x8, 0xc, 0xc, 0xe, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc,
+    0x8, 0x8, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc, 0x8, 0x8, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xa, 0xa, 0xa, 0xa,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc,
+    0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xc, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0x8, 0x8, 0x8, 0x8,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc,
+    0x0, 0x0, 0x8, 0xc, 0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc,
+    0x8, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xc, 0xe, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xc, 0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xe, 0xe, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc, 0xa, 0xe, 0xf, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xa, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc,
+    0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc,
+    0x8, 0xc, 0xc, 0xe, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc,
+    0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xc, 0xe, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xc, 0x8, 0x8, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc,
+    0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0xa, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc,
+    0x0, 0x0, 0x8, 0xc, 0xa, 0xe, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xa, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xe, 0xe, 0xf, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0xa, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xc, 0x0, 0x0, 0x8, 0xc, 0xa, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xc,
+    0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0x8, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xc, 0xa, 0xa, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xf, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xe,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xe, 0xa, 0xa, 0xa, 0xe,
+    0xa, 0xe, 0xf, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x8, 0xc,
+    0x0, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0xc, 0xc, 0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc,
+    0x8, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xe, 0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xc, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe, 0x8, 0x8, 0xc, 0xc,
+    0xe, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xe, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x8, 0x8, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc,
+    0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc, 0xa, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe,
+    0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x8, 0x8, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xc, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc,
+    0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xc, 0xc,
+    0x8, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe,
+    0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc,
+    0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xa, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x8, 0xc,
+    0x0, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0xc, 0xc, 0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xa, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xe, 0xe, 0xf, 0xf, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xf, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc,
+    0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc, 0xa, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xc, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe, 0xa, 0xa, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xc, 0xc,
+    0x8, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe,
+    0x8, 0x8, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe, 0x8, 0x8, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf, 0xa, 0xa, 0xa, 0xa,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xc, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc,
+    0xa, 0xe, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xa, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xe, 0x8, 0x8, 0x8, 0xc,
+    0x8, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x8, 0xc,
+    0x0, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0xc, 0xc, 0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc,
+    0x8, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xe, 0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xe,
+    0x8, 0x8, 0x8, 0xc, 0x8, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xe, 0xe, 0xf, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xa, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xe, 0x8, 0x8, 0x8, 0xc,
+    0x8, 0xc, 0xe, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa,
+    0x8, 0x8, 0x8, 0xc, 0x8, 0xc, 0xc, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0xc, 0xc, 0xe, 0x8, 0x8, 0xc, 0xc, 0xa, 0xe, 0xf, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xc, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc,
+    0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xc, 0xc,
+    0x8, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe,
+    0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc,
+    0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xe, 0x8, 0x8, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe,
+    0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x8, 0xc,
+    0x0, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0xc, 0xc, 0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe, 0x8, 0x8, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xe, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc,
+    0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc, 0xa, 0xe, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xc, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe, 0xa, 0xa, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xe, 0x8, 0x8, 0x8, 0xc, 0x8, 0xc, 0xe, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xe,
+    0x8, 0x8, 0x8, 0xc, 0x8, 0xc, 0xe, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xa, 0x8, 0x8, 0x8, 0xc, 0x8, 0xc, 0xc, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0xc, 0xc, 0xe, 0x8, 0x8, 0xc, 0xc,
+    0xa, 0xe, 0xf, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x8, 0xe, 0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x8, 0xc,
+    0x0, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe,
+    0x0, 0x0, 0xc, 0xc, 0xa, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xc, 0xe, 0x0, 0x0, 0xc, 0xc,
+    0x8, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xc, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xe, 0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8, 0xe,
+    0x0, 0x0, 0x8, 0xc, 0x0, 0xc, 0xe, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0xc, 0xc, 0x8, 0xc, 0xc, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xc, 0xc, 0xe, 0x8, 0x8, 0xc, 0xc,
+    0xe, 0xe, 0xf, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x8, 0x8, 0xf, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xc, 0xc, 0xe, 0x8, 0x8, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x8, 0x8, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0xa, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xf,
+    0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xe, 0x8, 0x8, 0x8, 0xc,
+    0x8, 0xc, 0xe, 0xf, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0xa,
+    0x8, 0x8, 0x8, 0xc, 0x8, 0xc, 0xc, 0xf, 0x8, 0x8, 0x8, 0x8,
+    0x8, 0xc, 0xc, 0xe, 0x8, 0x8, 0xc, 0xc, 0xa, 0xe, 0xf, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xf, 0xf, 0xf, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xf, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe,
+    0xc, 0xc, 0xc, 0xc, 0xe, 0xe, 0xf, 0xf, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xf,
+    0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xc, 0xe, 0xc, 0xc, 0xc, 0xc,
+    0xc, 0xc, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xf, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xe,
+    0xa, 0xa, 0xa, 0xe, 0xa, 0xe, 0xe, 0xf, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xe, 0xa, 0xe, 0xe, 0xf,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe, 0xa, 0xa, 0xe, 0xe,
+    0xa, 0xe, 0xf, 0xf, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xf, 0xa, 0xa, 0xa, 0xa,
+    0xa, 0xe, 0xe, 0xe, 0xa, 0xa, 0xe, 0xe, 0xa, 0xe, 0xe, 0xf,
+    0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xe, 0xe,
+    0xa, 0xe, 0xe, 0xf, 0xa, 0xa, 0xa, 0xa, 0xa, 0xe, 0xe, 0xe,
+    0xa, 0xa, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xe, 0xe, 0xe, 0xe,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf,
+    0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xe, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+    0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf, 0xf,
+};
+// clang-format on
@@ -5,6 +5,7 @@
 #include "joker_gfx.h"
 #include "pool.h"
 #include "soundbank.h"
+#include "tile_cache.h"
 #include "util.h"
 
 #include <maxmod.h>
@@ -47,28 +48,26 @@ const static u8 edition_price_lut[MAX_EDITIONS] = {
 static bool _used_layers[MAX_JOKER_OBJECTS] = {false}; // Track used layers for joker sprites
 // TODO: Refactor sorting into SpriteObject?
 
-// Maps the spritesheet index to the palette bank index allocated to it.
-// Spritesheets that were not allocated are
-static int _joker_spritesheet_pb_map[(MAX_DEFINABLE_JOKERS + 1) / NUM_JOKERS_PER_SPRITESHEET];
-static int _joker_pb_num_sprite_users[JOKER_LAST_PB - JOKER_BASE_PB + 1] = {0};
+// The Joker palette banks, keyed by the shared palette of the spritesheet (see
+// joker_spritesheet_palettes). A palette stays in its bank after its last Joker is gone, until the
+// bank is needed for another palette.
+TILE_CACHE_DEFINE(_joker_pb_cache, JOKER_LAST_PB - JOKER_BASE_PB + 1)
 
-static int s_get_num_spritesheets(void);
+// Keyed by Joker ID, so duplicate Jokers (e.g. the same Joker owned and in the shop) share their
+// tiles, and a Joker bought again doesn't have to be uploaded again
+TILE_CACHE_DEFINE(_joker_tile_cache, MAX_JOKER_OBJECTS)
+
+static int s_joker_tiles_acquire(u8 joker_id);
+static void s_joker_tiles_release(int tile_index);
 static int s_joker_get_spritesheet_idx(u8 joker_id);
-static void s_joker_pb_add_sprite_user(int pb);
-static void s_joker_pb_remove_sprite_user(int pb);
-static int s_joker_pb_get_num_sprite_users(int joker_pb);
-static int s_get_unused_joker_pb(void);
-static int s_allocate_pb_if_needed(u8 joker_id);
+static void s_joker_get_palette_remap(int spritesheet_idx, u8 palette_remap[PAL_ROW_LEN]);
+static int s_joker_pb_acquire(u8 joker_id);
+static void s_joker_pb_release(int pb);
 
 void joker_init()
 {
-    // This should init once only so no need to free
-    int num_spritesheets = s_get_num_spritesheets();
-
-    for (int i = 0; i < num_spritesheets; i++)
-    {
-        _joker_spritesheet_pb_map[i] = UNDEFINED;
-    }
+    tile_cache_clear(&_joker_tile_cache);
+    tile_cache_clear(&_joker_pb_cache);
 }
 
 Joker* joker_new(u8 id)
@@ -77,6 +76,9 @@ Joker* joker_new(u8 id)
         return NULL;
 
     Joker* joker = POOL_GET(Joker);
+    if (joker == NULL)
+        return NULL;
+
     const JokerInfo* jinfo = get_joker_registry_entry(id);
 
     joker->id = id;
@@ -87,12 +89,91 @@ Joker* joker_new(u8 id)
     joker->persistent_state = 0;
 
     // initialize persistent Joker data if needed
-    JokerEffect* joker_effect = NULL;
-    jinfo->joker_effect_func(joker, NULL, JOKER_EVENT_ON_JOKER_CREATED, &joker_effect);
+    if (jinfo->event_flags & JOKER_EVENT_FLAG(JOKER_EVENT_ON_JOKER_CREATED))
+    {
+        JokerEffect* joker_effect = NULL;
+        jinfo->joker_effect_func(joker, NULL, JOKER_EVENT_ON_JOKER_CREATED, &joker_effect);
+    }
 
     return joker;
 }
 
+// Follow the copies starting at joker_idx, Blueprint copies the next Joker and Brainstorm the
+// first (leftmost) one, until a Joker that isn't a copying Joker.
+// Returns NULL for a Blueprint at the end of the list, or when the copies loop back on a Joker
+// that was already visited (e.g. Brainstorm first, or Blueprint followed by Brainstorm)
+static Joker* s_resolve_copied_joker(JokerObject** joker_objects, int num_jokers, int joker_idx)
+{
+    bool visited[MAX_JOKERS_HELD_SIZE] = {false};
+
+    while (joker_idx < num_jokers && !visited[joker_idx])
+    {
+        visited[joker_idx] = true;
+
+        switch (joker_objects[joker_idx]->joker->id)
+        {
+            case BLUEPRINT_JOKER_ID:
+                joker_idx++;
+                break;
+
+            case BRAINSTORM_JOKER_ID:
+                joker_idx = 0;
+                break;
+
+            default:
+                return joker_objects[joker_idx]->joker;
+        }
+    }
+
+    return NULL;
+}
+
+void joker_event_index_build(JokerEventIndex* index, Vector* jokers)
+{
+    memset(index->num_subscribers, 0, sizeof(index->num_subscribers));
+
+    JokerObject** joker_objects = (JokerObject**)jokers->data;
+    // The shop never lets the player own more than MAX_JOKERS_HELD_SIZE Jokers
+    int num_jokers = min(vector_get_len(jokers), MAX_JOKERS_HELD_SIZE);
+
+    for (int joker_idx = 0; joker_idx < num_jokers; joker_idx++)
+    {
+        Joker* joker = joker_objects[joker_idx]->joker;
+        const JokerInfo* jinfo = get_joker_registry_entry(joker->id);
+        if (!jinfo)
+            continue;
+
+        u16 event_flags = jinfo->event_flags;
+        JokerEffectFunc effect_func = jinfo->joker_effect_func;
+        Joker* copied_joker = NULL;
+
+        // Copying Jokers only subscribe to the events the copied Joker reacts to, and to none
+        // when they have nothing to copy
+        if (joker->id == BLUEPRINT_JOKER_ID || joker->id == BRAINSTORM_JOKER_ID)
+        {
+            copied_joker = s_resolve_copied_joker(joker_objects, num_jokers, joker_idx);
+            if (copied_joker == NULL)
+                continue;
+
+            const JokerInfo* copied_jinfo = get_joker_registry_entry(copied_joker->id);
+            event_flags &= copied_jinfo->event_flags;
+            effect_func = copied_jinfo->joker_effect_func;
+        }
+
+        for (int event = 0; event < NUM_JOKER_EVENTS; event++)
+        {
+            if (event_flags & JOKER_EVENT_FLAG(event))
+            {
+                JokerSubscriber* subscriber =
+                    &index->subscribers[event][index->num_subscribers[event]++];
+                subscriber->joker_object = joker_objects[joker_idx];
+                subscriber->effect_func = effect_func;
+                subscriber->copied_joker = copied_joker;
+            }
+        }
+    }
+}
+
 void joker_destroy(Joker** joker)
 {
     POOL_FREE(Joker, *joker);
@@ -113,6 +194,29 @@ u32 joker_get_score_effect(
     return jinfo->joker_effect_func(joker, scored_card, joker_event, joker_effect);
 }
 
+u32 joker_subscriber_get_score_effect(
+    const JokerSubscriber* subscriber,
+    Card* scored_card,
+    enum JokerEvent joker_event,
+    JokerEffect** joker_effect
+)
+{
+    Joker* joker = subscriber->joker_object->joker;
+
+    if (subscriber->copied_joker == NULL)
+    {
+        return subscriber->effect_func(joker, scored_card, joker_event, joker_effect);
+    }
+
+    // Copying Jokers apply the copied effect to their own Joker, with the copied Joker's
+    // persistent data, and never expire
+    joker->persistent_state = subscriber->copied_joker->persistent_state;
+
+    u32 effect_flags = subscriber->effect_func(joker, scored_card, joker_event, joker_effect);
+
+    return effect_flags & ~JOKER_EFFECT_FLAG_EXPIRE;
+}
+
 int joker_get_sell_value(const Joker* joker)
 {
     if (joker == NULL)
@@ -126,7 +230,12 @@ int joker_get_sell_value(const Joker* joker)
 // JokerObject methods
 JokerObject* joker_object_new(Joker* joker)
 {
+    if (joker == NULL)
+        return NULL;
+
     JokerObject* joker_object = POOL_GET(JokerObject);
+    if (joker_object == NULL)
+        return NULL;
 
     int layer = 0;
     for (int i = 0; i < MAX_JOKER_OBJECTS; i++)
@@ -139,21 +248,18 @@ JokerObject* joker_object_new(Joker* joker)
         }
     }
 
+    int tile_index = s_joker_tiles_acquire(joker->id);
+    if (tile_index == UNDEFINED)
+    {
+        _used_layers[layer] = false;
+        POOL_FREE(JokerObject, joker_object);
+        return NULL;
+    }
+
     joker_object->joker = joker;
     joker_object->sprite_object = sprite_object_new();
 
-    int tile_index = JOKER_TID + (layer * JOKER_SPRITE_OFFSET);
-
-    int joker_spritesheet_idx = s_joker_get_spritesheet_idx(joker->id);
-    int joker_idx = joker->id % NUM_JOKERS_PER_SPRITESHEET;
-    int joker_pb = s_allocate_pb_if_needed(joker->id);
-    s_joker_pb_add_sprite_user(joker_pb);
-
-    memcpy32(
-        &tile_mem[TILE_MEM_OBJ_CHARBLOCK0_IDX][tile_index],
-        &joker_gfxTiles[joker_spritesheet_idx][joker_idx * TILE_SIZE * JOKER_SPRITE_OFFSET],
-        TILE_SIZE * JOKER_SPRITE_OFFSET
-    );
+    int joker_pb = s_joker_pb_acquire(joker->id);
 
     sprite_object_set_sprite(
         joker_object->sprite_object,
@@ -176,13 +282,8 @@ void joker_object_destroy(JokerObject** joker_object)
 
     int layer = sprite_get_layer(joker_object_get_sprite(*joker_object)) - JOKER_STARTING_LAYER;
     _used_layers[layer] = false;
-    s_joker_pb_remove_sprite_user(sprite_get_pb(joker_object_get_sprite(*joker_object)));
-    if (s_joker_pb_get_num_sprite_users((sprite_get_pb(joker_object_get_sprite(*joker_object)))) ==
-        0)
-    {
-        _joker_spritesheet_pb_map[s_joker_get_spritesheet_idx((*joker_object)->joker->id)] =
-            UNDEFINED;
-    }
+    s_joker_tiles_release(sprite_get_tid(joker_object_get_sprite(*joker_object)));
+    s_joker_pb_release(sprite_get_pb(joker_object_get_sprite(*joker_object)));
 
     sprite_object_destroy(&(*joker_object)->sprite_object); // Destroy the sprite
     joker_destroy(&(*joker_object)->joker);                 // Destroy the joker
@@ -212,33 +313,17 @@ void set_and_shift_text(char* str, int* cursor_pos_x, int* cursor_pos_y, int col
     *cursor_pos_x += joker_score_display_offset_px;
 }
 
-bool joker_object_score(
+void joker_object_display_effect(
     JokerObject* joker_object,
     CardObject* card_object,
-    enum JokerEvent joker_event
+    enum JokerEvent joker_event,
+    u32 effect_flags,
+    const JokerEffect* joker_effect
 )
 {
-    if (joker_object == NULL)
-    {
-        return false;
-    }
-
-    JokerEffect* joker_effect = NULL;
-    u32 effect_flags_ret =
-        joker_get_score_effect(joker_object->joker, card_object->card, joker_event, &joker_effect);
-
-    if (effect_flags_ret == JOKER_EFFECT_FLAG_NONE)
+    if (joker_object == NULL || effect_flags == JOKER_EFFECT_FLAG_NONE)
     {
-        return false;
-    }
-
-    u32 chips = get_chips();
-    u32 mult = get_mult();
-    int money = get_money();
-
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_RETRIGGER)
-    {
-        set_retrigger(joker_effect->retrigger);
+        return;
     }
 
     // joker_effect.message will have been set if the Joker had anything custom to say
@@ -259,34 +344,30 @@ bool joker_object_score(
     }
 
     mm_word sfx_id;
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_CHIPS)
+    if (effect_flags & JOKER_EFFECT_FLAG_CHIPS)
     {
-        chips = u32_protected_add(chips, joker_effect->chips);
         char score_buffer[INT_MAX_DIGITS + 2]; // For '+' and null terminator
         snprintf(score_buffer, sizeof(score_buffer), "+%lu", joker_effect->chips);
         set_and_shift_text(score_buffer, &cursorPosX, &cursorPosY, TTE_BLUE_PB);
         sfx_id = SFX_CHIPS_GENERIC; // The joker chips effect is "generic"
     }
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_MULT)
+    if (effect_flags & JOKER_EFFECT_FLAG_MULT)
     {
-        mult = u32_protected_add(mult, joker_effect->mult);
         char score_buffer[INT_MAX_DIGITS + 2];
         snprintf(score_buffer, sizeof(score_buffer), "+%lu", joker_effect->mult);
         set_and_shift_text(score_buffer, &cursorPosX, &cursorPosY, TTE_RED_PB);
         sfx_id = SFX_MULT;
     }
-    // if xmult is zero, DO NOT multiply by it
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_XMULT && joker_effect->xmult > 0)
+    // if xmult is zero, it was not applied
+    if (effect_flags & JOKER_EFFECT_FLAG_XMULT && joker_effect->xmult > 0)
     {
-        mult = u32_protected_mult(mult, joker_effect->xmult);
         char score_buffer[INT_MAX_DIGITS + 2];
         snprintf(score_buffer, sizeof(score_buffer), "X%lu", joker_effect->xmult);
         set_and_shift_text(score_buffer, &cursorPosX, &cursorPosY, TTE_RED_PB);
         sfx_id = SFX_XMULT;
     }
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_MONEY)
+    if (effect_flags & JOKER_EFFECT_FLAG_MONEY)
     {
-        money += joker_effect->money;
         char score_buffer[INT_MAX_DIGITS + 2];
         snprintf(score_buffer, sizeof(score_buffer), "%d$", joker_effect->money);
         set_and_shift_text(score_buffer, &cursorPosX, &cursorPosY, TTE_YELLOW_PB);
@@ -294,30 +375,18 @@ bool joker_object_score(
     }
     // custom message for Jokers (including retriggers where Jokers will say "Again!")
     // joker_effect->message will have been set if the Joker had anything custom to say
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_MESSAGE)
+    if (effect_flags & JOKER_EFFECT_FLAG_MESSAGE)
     {
         set_and_shift_text(joker_effect->message, &cursorPosX, &cursorPosY, TTE_WHITE_PB);
     }
     // this will start the Joker expire animation
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_EXPIRE && joker_effect->expire)
+    if (effect_flags & JOKER_EFFECT_FLAG_EXPIRE && joker_effect->expire)
     {
         joker_object_shake(joker_object, UNDEFINED);
-        list_push_back(get_expired_jokers_list(), joker_object);
+        vector_push_back(get_expired_jokers_list(), joker_object);
     }
 
-    // Update values
-    set_chips(chips);
-    set_mult(mult);
-    set_money(money);
-
-    // Update displays
-    display_chips();
-    display_mult();
-    display_money();
-
     joker_object_shake(joker_object, sfx_id);
-
-    return true;
 }
 
 Sprite* joker_object_get_sprite(JokerObject* joker_object)
@@ -327,6 +396,16 @@ Sprite* joker_object_get_sprite(JokerObject* joker_object)
     return sprite_object_get_sprite(joker_object->sprite_object);
 }
 
+const TileCache* joker_get_tile_cache(void)
+{
+    return &_joker_tile_cache;
+}
+
+const TileCache* joker_get_pb_cache(void)
+{
+    return &_joker_pb_cache;
+}
+
 int joker_get_random_rarity()
 {
     int joker_rarity = 0;
@@ -352,73 +431,103 @@ int joker_get_random_rarity()
     return joker_rarity;
 }
 
-static int s_get_num_spritesheets()
+// Returns the tile index of the Joker's tiles in VRAM, copying them there if needed, or UNDEFINED
+// if every slot is in use
+static int s_joker_tiles_acquire(u8 joker_id)
 {
-    return (get_joker_registry_size() + NUM_JOKERS_PER_SPRITESHEET - 1) /
-           NUM_JOKERS_PER_SPRITESHEET;
-}
+    bool upload;
+    int slot = tile_cache_acquire(&_joker_tile_cache, joker_id, &upload);
+    if (slot == UNDEFINED)
+        return UNDEFINED;
 
-static int s_joker_get_spritesheet_idx(u8 joker_id)
-{
-    return joker_id / NUM_JOKERS_PER_SPRITESHEET;
+    int tile_index = JOKER_TID + slot * JOKER_SPRITE_OFFSET;
+    if (upload)
+    {
+        int joker_spritesheet_idx = s_joker_get_spritesheet_idx(joker_id);
+        int joker_idx = joker_id % NUM_JOKERS_PER_SPRITESHEET;
+        u8 palette_remap[PAL_ROW_LEN];
+        s_joker_get_palette_remap(joker_spritesheet_idx, palette_remap);
+
+        memcpy32_tile4_with_palette_remap(
+            (u32*)&tile_mem[TILE_MEM_OBJ_CHARBLOCK0_IDX][tile_index],
+            &joker_gfxTiles[joker_spritesheet_idx][joker_idx * TILE_SIZE * JOKER_SPRITE_OFFSET],
+            TILE_SIZE * JOKER_SPRITE_OFFSET,
+            palette_remap
+        );
+    }
+
+    return tile_index;
 }
 
-static void s_joker_pb_add_sprite_user(int pb)
+static void s_joker_tiles_release(int tile_index)
 {
-    _joker_pb_num_sprite_users[pb - JOKER_BASE_PB]++;
+    tile_cache_release(&_joker_tile_cache, (tile_index - JOKER_TID) / JOKER_SPRITE_OFFSET);
 }
 
-static void s_joker_pb_remove_sprite_user(int pb)
+static int s_joker_get_spritesheet_idx(u8 joker_id)
 {
-    int num_sprite_users = _joker_pb_num_sprite_users[pb - JOKER_BASE_PB];
-    _joker_pb_num_sprite_users[pb - JOKER_BASE_PB] = max(0, num_sprite_users - 1);
+    return joker_id / NUM_JOKERS_PER_SPRITESHEET;
 }
 
-static int s_joker_pb_get_num_sprite_users(int joker_pb)
+static int s_rgb15_distance_sq(COLOR a, COLOR b)
 {
-    return _joker_pb_num_sprite_users[joker_pb - JOKER_BASE_PB];
+    int dr = (a & 0x1F) - (b & 0x1F);
+    int dg = ((a >> 5) & 0x1F) - ((b >> 5) & 0x1F);
+    int db = ((a >> 10) & 0x1F) - ((b >> 10) & 0x1F);
+    return dr * dr + dg * dg + db * db;
 }
 
-static int s_get_unused_joker_pb()
+// The closest color to color in palette, ignoring the transparent color 0
+static int s_get_closest_color_idx(const u16* palette, COLOR color)
 {
-    for (int i = 0; i < NUM_ELEM_IN_ARR(_joker_pb_num_sprite_users); i++)
+    int closest_idx = 1;
+    int closest_distance = s_rgb15_distance_sq(palette[1], color);
+
+    for (int i = 2; i < PAL_ROW_LEN; i++)
     {
-        if (_joker_pb_num_sprite_users[i] == 0)
+        int distance = s_rgb15_distance_sq(palette[i], color);
+        if (distance < closest_distance)
         {
-            return (i + JOKER_BASE_PB);
+            closest_idx = i;
+            closest_distance = distance;
         }
     }
 
-    return UNDEFINED;
+    return closest_idx;
 }
 
-static int s_allocate_pb_if_needed(u8 joker_id)
+// The spritesheet tiles index into their own grit palette, the Jokers are displayed with the shared
+// palette of the spritesheet instead. The colors of the shared palette are at most
+// --max-error of cluster_joker_palettes.py away from the spritesheet ones.
+static void s_joker_get_palette_remap(int spritesheet_idx, u8 palette_remap[PAL_ROW_LEN])
 {
-    int joker_spritesheet_idx = s_joker_get_spritesheet_idx(joker_id);
-    int joker_pb = _joker_spritesheet_pb_map[joker_spritesheet_idx];
-    if (joker_pb != UNDEFINED)
+    const u16* palette = joker_palettes[joker_spritesheet_palettes[spritesheet_idx]];
+
+    palette_remap[0] = 0; // Transparent
+    for (int i = 1; i < PAL_ROW_LEN; i++)
     {
-        // Already allocated
-        return joker_pb;
+        palette_remap[i] = s_get_closest_color_idx(palette, joker_gfxPal[spritesheet_idx][i]);
     }
+}
 
-    // Allocate a new palette
-    joker_pb = s_get_unused_joker_pb();
+static int s_joker_pb_acquire(u8 joker_id)
+{
+    int palette_idx = joker_spritesheet_palettes[s_joker_get_spritesheet_idx(joker_id)];
 
-    if (joker_pb == UNDEFINED)
-    {
-        // Ran out of palettes, default to base and pray
-        joker_pb = JOKER_BASE_PB;
-    }
-    else
+    // Never fails, there is a bank for every shared palette (see joker_palettes.c)
+    bool upload;
+    int slot = tile_cache_acquire(&_joker_pb_cache, palette_idx, &upload);
+
+    int joker_pb = JOKER_BASE_PB + slot;
+    if (upload)
     {
-        _joker_spritesheet_pb_map[joker_spritesheet_idx] = joker_pb;
-        memcpy16(
-            &pal_obj_mem[PAL_ROW_LEN * joker_pb],
-            joker_gfxPal[joker_spritesheet_idx],
-            NUM_ELEM_IN_ARR(joker_gfx0Pal)
-        );
+        sprite_queue_palette(joker_pb, joker_palettes[palette_idx]);
     }
 
     return joker_pb;
 }
+
+static void s_joker_pb_release(int pb)
+{
+    tile_cache_release(&_joker_pb_cache, pb - JOKER_BASE_PB);
+}
@@ -1,9 +1,10 @@
 #include "game.h"
 #include "hand_analysis.h"
 #include "joker.h"
-#include "list.h"
 #include "pool.h"
+#include "scoring.h"
 #include "util.h"
+#include "vector.h"
 
 #include <stdlib.h>
 
@@ -305,12 +306,6 @@ static u32 dusk_joker_effect(
     enum JokerEvent joker_event,
     JokerEffect** joker_effect
 );
-static u32 blueprint_brainstorm_joker_effect(
-    Joker* joker,
-    Card* scored_card,
-    enum JokerEvent joker_event,
-    JokerEffect** joker_effect
-);
 static u32 hack_joker_effect(
     Joker* joker,
     Card* scored_card,
@@ -331,6 +326,29 @@ static u32 sock_and_buskin_joker_effect(
 );
 
 // clang-format off
+// Shorthands for the JokerInfo.event_flags of the registry below
+#define ON_JOKER_CREATED   JOKER_EVENT_FLAG(JOKER_EVENT_ON_JOKER_CREATED)
+#define ON_HAND_PLAYED     JOKER_EVENT_FLAG(JOKER_EVENT_ON_HAND_PLAYED)
+#define ON_CARD_SCORED     JOKER_EVENT_FLAG(JOKER_EVENT_ON_CARD_SCORED)
+#define ON_CARD_SCORED_END JOKER_EVENT_FLAG(JOKER_EVENT_ON_CARD_SCORED_END)
+#define ON_CARD_HELD       JOKER_EVENT_FLAG(JOKER_EVENT_ON_CARD_HELD)
+#define ON_INDEPENDENT     JOKER_EVENT_FLAG(JOKER_EVENT_INDEPENDENT)
+#define ON_HAND_SCORED_END JOKER_EVENT_FLAG(JOKER_EVENT_ON_HAND_SCORED_END)
+#define ON_HAND_DISCARDED  JOKER_EVENT_FLAG(JOKER_EVENT_ON_HAND_DISCARDED)
+#define ON_BLIND_SELECTED  JOKER_EVENT_FLAG(JOKER_EVENT_ON_BLIND_SELECTED)
+
+// Jokers that reset their scoring state when the hand is played
+#define STATE_ON_SCORED (ON_HAND_PLAYED | ON_CARD_SCORED)
+#define STATE_ON_HELD   (ON_HAND_PLAYED | ON_CARD_HELD)
+#define ON_RETRIGGER    (ON_HAND_PLAYED | ON_CARD_SCORED_END)
+#define SELTZER_EVENTS  (ON_RETRIGGER | ON_JOKER_CREATED | ON_HAND_SCORED_END)
+
+// Blueprint and Brainstorm copy the effect of another Joker for these events, the copied Joker is
+// resolved by joker_event_index_build() when the owned Jokers change
+#define COPYING_EVENTS                                                                      \
+    (ON_HAND_PLAYED | ON_CARD_SCORED | ON_CARD_SCORED_END | ON_CARD_HELD | ON_INDEPENDENT | \
+     ON_HAND_DISCARDED | ON_BLIND_SELECTED)
+
 /* The index of a joker in the registry matches its ID.
  * The joker sprites are matched by ID so the position in the registry
  * determines the joker's sprite.
@@ -342,64 +360,64 @@ static u32 sock_and_buskin_joker_effect(
  */
 const JokerInfo joker_registry[] = 
 {
-    { COMMON_JOKER,    2, default_joker_effect              }, // DEFAULT_JOKER_ID = 0
-    { COMMON_JOKER,    5, greedy_joker_effect               }, // GREEDY_JOKER_ID  = 1
-    { COMMON_JOKER,    5, lusty_joker_effect                }, // etc...  2
-    { COMMON_JOKER,    5, wrathful_joker_effect             }, // 3
-    { COMMON_JOKER,    5, gluttonous_joker_effect           }, // 4
-    { COMMON_JOKER,    3, jolly_joker_effect                }, // 5
-    { COMMON_JOKER,    4, zany_joker_effect                 }, // 6
-    { COMMON_JOKER,    4, mad_joker_effect                  }, // 7
-    { COMMON_JOKER,    4, crazy_joker_effect                }, // 8
-    { COMMON_JOKER,    4, droll_joker_effect                }, // 9
-    { COMMON_JOKER,    3, sly_joker_effect                  }, // 10
-    { COMMON_JOKER,    4, wily_joker_effect                 }, // 11
-    { COMMON_JOKER,    4, clever_joker_effect               }, // 12
-    { COMMON_JOKER,    4, devious_joker_effect              }, // 13 
-    { COMMON_JOKER,    4, crafty_joker_effect               }, // 14
-    { COMMON_JOKER,    5, half_joker_effect                 }, // 15
-    { UNCOMMON_JOKER,  8, joker_stencil_effect              }, // 16
-    { COMMON_JOKER,    5, photograph_joker_effect,          }, // 17
-    { COMMON_JOKER,    4, walkie_talkie_joker_effect        }, // 18
-    { COMMON_JOKER,    5, banner_joker_effect               }, // 19
-    { UNCOMMON_JOKER,  6, blackboard_joker_effect           }, // 20
-    { COMMON_JOKER,    5, mystic_summit_joker_effect        }, // 21
-    { COMMON_JOKER,    4, misprint_joker_effect             }, // 22
-    { COMMON_JOKER,    4, even_steven_joker_effect          }, // 23
-    { COMMON_JOKER,    5, blue_joker_effect                 }, // 24
-    { COMMON_JOKER,    4, odd_todd_joker_effect             }, // 25
-    { UNCOMMON_JOKER,  7, joker_effect_noop,                }, // 26 Shortcut
-    { COMMON_JOKER,    4, business_card_joker_effect        }, // 27
-    { COMMON_JOKER,    4, scary_face_joker_effect           }, // 28
-    { UNCOMMON_JOKER,  7, bootstraps_joker_effect           }, // 29
-    { UNCOMMON_JOKER,  5, joker_effect_noop                 }, // 30 Pareidolia
-    { COMMON_JOKER,    6, reserved_parking_joker_effect     }, // 31
-    { COMMON_JOKER,    4, abstract_joker_effect             }, // 32
-    { UNCOMMON_JOKER,  6, bull_joker_effect                 }, // 33
-    { RARE_JOKER,      8, the_duo_joker_effect              }, // 34
-    { RARE_JOKER,      8, the_trio_joker_effect             }, // 35
-    { RARE_JOKER,      8, the_family_joker_effect           }, // 36
-    { RARE_JOKER,      8, the_order_joker_effect            }, // 37
-    { RARE_JOKER,      8, the_tribe_joker_effect            }, // 38
-    { RARE_JOKER,     10, blueprint_brainstorm_joker_effect }, // 39 Blueprint
-    { RARE_JOKER,     10, blueprint_brainstorm_joker_effect }, // 40 Brainstorm
-    { COMMON_JOKER,    5, raised_fist_joker_effect          }, // 41
-    { COMMON_JOKER,    4, smiley_face_joker_effect          }, // 42
-    { UNCOMMON_JOKER,  6, acrobat_joker_effect              }, // 43
-    { UNCOMMON_JOKER,  5, dusk_joker_effect                 }, // 44
-    { UNCOMMON_JOKER,  6, sock_and_buskin_joker_effect      }, // 45
-    { UNCOMMON_JOKER,  6, hack_joker_effect                 }, // 46
-    { COMMON_JOKER,    4, hanging_chad_joker_effect         }, // 47
-    { UNCOMMON_JOKER,  7, joker_effect_noop,                }, // 48 Four Fingers
-    { COMMON_JOKER,    4, scholar_joker_effect              }, // 49
-    { UNCOMMON_JOKER,  8, fibonnaci_joker_effect            }, // 50
-    { UNCOMMON_JOKER,  6, seltzer_joker_effect,             }, // 51
+    { COMMON_JOKER,    2, default_joker_effect,              ON_INDEPENDENT  }, // DEFAULT_JOKER_ID = 0
+    { COMMON_JOKER,    5, greedy_joker_effect,               ON_CARD_SCORED  }, // GREEDY_JOKER_ID  = 1
+    { COMMON_JOKER,    5, lusty_joker_effect,                ON_CARD_SCORED  }, // etc...  2
+    { COMMON_JOKER,    5, wrathful_joker_effect,             ON_CARD_SCORED  }, // 3
+    { COMMON_JOKER,    5, gluttonous_joker_effect,           ON_CARD_SCORED  }, // 4
+    { COMMON_JOKER,    3, jolly_joker_effect,                ON_INDEPENDENT  }, // 5
+    { COMMON_JOKER,    4, zany_joker_effect,                 ON_INDEPENDENT  }, // 6
+    { COMMON_JOKER,    4, mad_joker_effect,                  ON_INDEPENDENT  }, // 7
+    { COMMON_JOKER,    4, crazy_joker_effect,                ON_INDEPENDENT  }, // 8
+    { COMMON_JOKER,    4, droll_joker_effect,                ON_INDEPENDENT  }, // 9
+    { COMMON_JOKER,    3, sly_joker_effect,                  ON_INDEPENDENT  }, // 10
+    { COMMON_JOKER,    4, wily_joker_effect,                 ON_INDEPENDENT  }, // 11
+    { COMMON_JOKER,    4, clever_joker_effect,               ON_INDEPENDENT  }, // 12
+    { COMMON_JOKER,    4, devious_joker_effect,              ON_INDEPENDENT  }, // 13 
+    { COMMON_JOKER,    4, crafty_joker_effect,               ON_INDEPENDENT  }, // 14
+    { COMMON_JOKER,    5, half_joker_effect,                 ON_INDEPENDENT  }, // 15
+    { UNCOMMON_JOKER,  8, joker_stencil_effect,              ON_INDEPENDENT  }, // 16
+    { COMMON_JOKER,    5, photograph_joker_effect,           STATE_ON_SCORED }, // 17
+    { COMMON_JOKER,    4, walkie_talkie_joker_effect,        ON_CARD_SCORED  }, // 18
+    { COMMON_JOKER,    5, banner_joker_effect,               ON_INDEPENDENT  }, // 19
+    { UNCOMMON_JOKER,  6, blackboard_joker_effect,           ON_INDEPENDENT  }, // 20
+    { COMMON_JOKER,    5, mystic_summit_joker_effect,        ON_INDEPENDENT  }, // 21
+    { COMMON_JOKER,    4, misprint_joker_effect,             ON_INDEPENDENT  }, // 22
+    { COMMON_JOKER,    4, even_steven_joker_effect,          ON_CARD_SCORED  }, // 23
+    { COMMON_JOKER,    5, blue_joker_effect,                 ON_INDEPENDENT  }, // 24
+    { COMMON_JOKER,    4, odd_todd_joker_effect,             ON_CARD_SCORED  }, // 25
+    { UNCOMMON_JOKER,  7, joker_effect_noop,                 0               }, // 26 Shortcut
+    { COMMON_JOKER,    4, business_card_joker_effect,        ON_CARD_SCORED  }, // 27
+    { COMMON_JOKER,    4, scary_face_joker_effect,           ON_CARD_SCORED  }, // 28
+    { UNCOMMON_JOKER,  7, bootstraps_joker_effect,           ON_INDEPENDENT  }, // 29
+    { UNCOMMON_JOKER,  5, joker_effect_noop,                 0               }, // 30 Pareidolia
+    { COMMON_JOKER,    6, reserved_parking_joker_effect,     ON_CARD_HELD    }, // 31
+    { COMMON_JOKER,    4, abstract_joker_effect,             ON_INDEPENDENT  }, // 32
+    { UNCOMMON_JOKER,  6, bull_joker_effect,                 ON_INDEPENDENT  }, // 33
+    { RARE_JOKER,      8, the_duo_joker_effect,              ON_INDEPENDENT  }, // 34
+    { RARE_JOKER,      8, the_trio_joker_effect,             ON_INDEPENDENT  }, // 35
+    { RARE_JOKER,      8, the_family_joker_effect,           ON_INDEPENDENT  }, // 36
+    { RARE_JOKER,      8, the_order_joker_effect,            ON_INDEPENDENT  }, // 37
+    { RARE_JOKER,      8, the_tribe_joker_effect,            ON_INDEPENDENT  }, // 38
+    { RARE_JOKER,     10, joker_effect_noop,                 COPYING_EVENTS  }, // 39 Blueprint
+    { RARE_JOKER,     10, joker_effect_noop,                 COPYING_EVENTS  }, // 40 Brainstorm
+    { COMMON_JOKER,    5, raised_fist_joker_effect,          STATE_ON_HELD   }, // 41
+    { COMMON_JOKER,    4, smiley_face_joker_effect,          ON_CARD_SCORED  }, // 42
+    { UNCOMMON_JOKER,  6, acrobat_joker_effect,              ON_INDEPENDENT  }, // 43
+    { UNCOMMON_JOKER,  5, dusk_joker_effect,                 ON_RETRIGGER    }, // 44
+    { UNCOMMON_JOKER,  6, sock_and_buskin_joker_effect,      ON_RETRIGGER    }, // 45
+    { UNCOMMON_JOKER,  6, hack_joker_effect,                 ON_RETRIGGER    }, // 46
+    { COMMON_JOKER,    4, hanging_chad_joker_effect,         ON_RETRIGGER    }, // 47
+    { UNCOMMON_JOKER,  7, joker_effect_noop,                 0               }, // 48 Four Fingers
+    { COMMON_JOKER,    4, scholar_joker_effect,              ON_CARD_SCORED  }, // 49
+    { UNCOMMON_JOKER,  8, fibonnaci_joker_effect,            ON_CARD_SCORED  }, // 50
+    { UNCOMMON_JOKER,  6, seltzer_joker_effect,              SELTZER_EVENTS  }, // 51
     
     // The following jokers don't have sprites yet,
     // uncomment them when their sprites are added.
 #if 0
 
-    { COMMON_JOKER,   5, shoot_the_moon_joker_effect,   },
+    { COMMON_JOKER,    5, shoot_the_moon_joker_effect,       ON_CARD_HELD    },
 #endif
 };
 // clang-format on
@@ -519,7 +537,7 @@ static u32 jolly_joker_effect(
     // This is really inefficient but the only way at the moment to check for whole-hand conditions
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_n_of_a_kind(ranks) >= 2)
     {
@@ -546,7 +564,7 @@ static u32 zany_joker_effect(
     // This is really inefficient but the only way at the moment to check for whole-hand conditions
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_n_of_a_kind(ranks) >= 3)
     {
@@ -572,7 +590,7 @@ static u32 mad_joker_effect(
 
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_two_pair(ranks))
     {
@@ -596,11 +614,7 @@ static u32 crazy_joker_effect(
 
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_straight(ranks))
+    if (hand_contains_straight(score_get_played_masks()->ranks))
     {
         *joker_effect = &shared_joker_effect;
 
@@ -624,7 +638,7 @@ static u32 droll_joker_effect(
 
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_flush(suits))
     {
@@ -650,7 +664,7 @@ static u32 sly_joker_effect(
 
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_n_of_a_kind(ranks) >= 2)
     {
@@ -676,7 +690,7 @@ static u32 wily_joker_effect(
 
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_n_of_a_kind(ranks) >= 3)
     {
@@ -702,7 +716,7 @@ static u32 clever_joker_effect(
 
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_two_pair(ranks))
     {
@@ -726,11 +740,7 @@ static u32 devious_joker_effect(
 
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_straight(ranks))
+    if (hand_contains_straight(score_get_played_masks()->ranks))
     {
         *joker_effect = &shared_joker_effect;
 
@@ -754,7 +764,7 @@ static u32 crafty_joker_effect(
 
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_flush(suits))
     {
@@ -778,7 +788,7 @@ static u32 half_joker_effect(
 
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
-    int played_size = get_played_top() + 1;
+    int played_size = score_get_played_size();
     if (played_size <= 3)
     {
         *joker_effect = &shared_joker_effect;
@@ -801,18 +811,18 @@ static u32 joker_stencil_effect(
 
     *joker_effect = &shared_joker_effect;
 
-    List* jokers = get_jokers_list();
+    Vector* jokers = score_get_jokers_list();
 
     // +1 xmult per empty joker slot...
-    int num_jokers = list_get_len(jokers);
+    int num_jokers = vector_get_len(jokers);
 
     (*joker_effect)->xmult = (MAX_JOKERS_HELD_SIZE)-num_jokers;
 
     // ...and also each stencil_joker adds +1 xmult
-    ListItr itr = list_itr_create(jokers);
+    VectorItr itr = vector_itr_create(jokers);
     JokerObject* joker_object;
 
-    while ((joker_object = list_itr_next(&itr)))
+    while ((joker_object = vector_itr_next(&itr)))
     {
         if (joker_object->joker->id == STENCIL_JOKER_ID)
             (*joker_effect)->xmult++;
@@ -901,11 +911,11 @@ static u32 banner_joker_effect(
 
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
-    if (get_num_discards_remaining() > 0)
+    if (score_get_num_discards_remaining() > 0)
     {
         *joker_effect = &shared_joker_effect;
 
-        (*joker_effect)->chips = 30 * get_num_discards_remaining();
+        (*joker_effect)->chips = 30 * score_get_num_discards_remaining();
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -923,7 +933,7 @@ static u32 mystic_summit_joker_effect(
 
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
-    if (get_num_discards_remaining() == 0)
+    if (score_get_num_discards_remaining() == 0)
     {
         *joker_effect = &shared_joker_effect;
 
@@ -946,8 +956,8 @@ static u32 blackboard_joker_effect(
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
     bool all_cards_are_spades_or_clubs = true;
-    CardObject** hand = get_hand_array();
-    int hand_size = hand_get_size();
+    CardObject** hand = score_get_held_cards();
+    int hand_size = score_get_held_size();
     for (int i = 0; i < hand_size; i++)
     {
         u8 suit = hand[i]->card->suit;
@@ -980,7 +990,7 @@ static u32 blue_joker_effect(
 
     *joker_effect = &shared_joker_effect;
 
-    (*joker_effect)->chips = (get_deck_top() + 1) * 2;
+    (*joker_effect)->chips = score_get_deck_size() * 2;
 
     return JOKER_EFFECT_FLAG_CHIPS;
 }
@@ -1005,8 +1015,8 @@ static u32 raised_fist_joker_effect(
             // hand_size > 0 so we're never out of bounds
             *p_lowest_value_index = 0;
             u8 lowest_value = IMPOSSIBLY_HIGH_CARD_VALUE;
-            CardObject** hand = get_hand_array();
-            int hand_size = hand_get_size();
+            CardObject** hand = score_get_held_cards();
+            int hand_size = score_get_held_size();
             for (int i = 0; i < hand_size; i++)
             {
                 u8 value = card_get_value(hand[i]->card);
@@ -1019,7 +1029,7 @@ static u32 raised_fist_joker_effect(
             break;
 
         case JOKER_EVENT_ON_CARD_HELD:
-            if (get_scored_card_index() == *p_lowest_value_index)
+            if (score_get_scored_card_index() == *p_lowest_value_index)
             {
                 *joker_effect = &shared_joker_effect;
 
@@ -1136,7 +1146,7 @@ static u32 abstract_joker_effect(
     *joker_effect = &shared_joker_effect;
 
     // +1 xmult per occupied joker slot
-    int num_jokers = list_get_len(get_jokers_list());
+    int num_jokers = vector_get_len(score_get_jokers_list());
 
     (*joker_effect)->mult = num_jokers * 3;
 
@@ -1156,11 +1166,11 @@ static u32 bull_joker_effect(
 
     // The wiki says it does nothing if money is 0 or below
     // This allows us to avoid scoring negative Chips
-    if (get_money() > 0)
+    if (score_get_money() > 0)
     {
         *joker_effect = &shared_joker_effect;
 
-        (*joker_effect)->chips = get_money() * 2;
+        (*joker_effect)->chips = score_get_money() * 2;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -1254,7 +1264,7 @@ static u32 acrobat_joker_effect(
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
     // 0 remaining hands mean we're scoring the last hand
-    if (get_num_hands_remaining() == 0)
+    if (score_get_num_hands_remaining() == 0)
     {
         *joker_effect = &shared_joker_effect;
 
@@ -1317,7 +1327,7 @@ static u32 the_duo_joker_effect(
     // This is really inefficient but the only way at the moment to check for whole-hand conditions
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_n_of_a_kind(ranks) >= 2)
     {
@@ -1344,7 +1354,7 @@ static u32 the_trio_joker_effect(
     // This is really inefficient but the only way at the moment to check for whole-hand conditions
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_n_of_a_kind(ranks) >= 3)
     {
@@ -1371,7 +1381,7 @@ static u32 the_family_joker_effect(
     // This is really inefficient but the only way at the moment to check for whole-hand conditions
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_n_of_a_kind(ranks) >= 4)
     {
@@ -1395,11 +1405,7 @@ static u32 the_order_joker_effect(
 
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
-
-    if (hand_contains_straight(ranks))
+    if (hand_contains_straight(score_get_played_masks()->ranks))
     {
         *joker_effect = &shared_joker_effect;
 
@@ -1423,7 +1429,7 @@ static u32 the_tribe_joker_effect(
 
     u8 suits[NUM_SUITS];
     u8 ranks[NUM_RANKS];
-    get_played_distribution(ranks, suits);
+    score_get_played_distribution(ranks, suits);
 
     if (hand_contains_flush(suits))
     {
@@ -1448,11 +1454,11 @@ static u32 bootstraps_joker_effect(
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
     // Same protection as the Bull Joker
-    if (get_money() > 0)
+    if (score_get_money() > 0)
     {
         *joker_effect = &shared_joker_effect;
 
-        (*joker_effect)->mult = (get_money() / 5) * 2;
+        (*joker_effect)->mult = (score_get_money() / 5) * 2;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -1508,12 +1514,12 @@ static u32 photograph_joker_effect(
             // face card?
             if (*p_first_face_index == UNDEFINED && card_is_face(scored_card))
             {
-                *p_first_face_index = get_scored_card_index();
+                *p_first_face_index = score_get_scored_card_index();
             }
             // if we have a face card index saved, check against it and give mult accordingly
             // Doing this now will trigger the effect the first time we encounter the face card,
             // and we will catch potential retriggers
-            if (*p_first_face_index == get_scored_card_index())
+            if (*p_first_face_index == score_get_scored_card_index())
             {
                 *joker_effect = &shared_joker_effect;
 
@@ -1548,14 +1554,15 @@ static u32 dusk_joker_effect(
 
         case JOKER_EVENT_ON_CARD_SCORED_END:
             // Only retrigger current card if it's strictly after the last one we retriggered
-            if (get_num_hands_remaining() == 0)
+            if (score_get_num_hands_remaining() == 0)
             {
                 *joker_effect = &shared_joker_effect;
 
-                (*joker_effect)->retrigger = (*p_last_retriggered_index < get_scored_card_index());
+                (*joker_effect)->retrigger =
+                    (*p_last_retriggered_index < score_get_scored_card_index());
                 if ((*joker_effect)->retrigger)
                 {
-                    *p_last_retriggered_index = get_scored_card_index();
+                    *p_last_retriggered_index = score_get_scored_card_index();
                     (*joker_effect)->message = "Again!";
                     effect_flags_ret = JOKER_EFFECT_FLAG_RETRIGGER | JOKER_EFFECT_FLAG_MESSAGE;
                 }
@@ -1570,91 +1577,6 @@ static u32 dusk_joker_effect(
     return effect_flags_ret;
 }
 
-static u32 blueprint_brainstorm_joker_effect(
-    Joker* joker,
-    Card* scored_card,
-    enum JokerEvent joker_event,
-    JokerEffect** joker_effect
-)
-{
-    u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
-
-    // No need for this kind of init since these Jokers
-    // will have their data copied when needed
-    if (joker_event == JOKER_EVENT_ON_JOKER_CREATED ||
-        joker_event == JOKER_EVENT_ON_HAND_SCORED_END || joker_event == JOKER_EVENT_ON_ROUND_END)
-    {
-        return effect_flags_ret;
-    }
-
-    // find ourselves in the Jokers list
-    List* jokers = get_jokers_list();
-    ListItr itr = list_itr_create(jokers);
-    JokerObject* copied_joker_object;
-    while ((copied_joker_object = list_itr_next(&itr)))
-    {
-        if (copied_joker_object->joker == joker)
-        {
-            break;
-        }
-    }
-
-    // This shouldn't happen since if we are a scoring Joker, we should always
-    // be part of the Jokers list, but being extra careful doesn't cost much
-    if (copied_joker_object == NULL)
-    {
-        return effect_flags_ret;
-    }
-
-    // find the copied Joker, may need to bounce around Blueprints and a Brainstorm
-    // If we encounter NULL, we have a Blueprint at the end of the list that can't copy anything.
-    // If we go through a Brainstorms twice, we will be in a loop and need to exit
-    u8 brainstorm_counter = 0;
-    do
-    {
-        switch (copied_joker_object->joker->id)
-        {
-            // get the next Joker for Blueprint
-            case BLUEPRINT_JOKER_ID:
-                copied_joker_object = list_itr_next(&itr);
-                break;
-
-            // Get the first (leftmost) Joker for Brainstorm
-            case BRAINSTORM_JOKER_ID:
-                brainstorm_counter++;
-                itr = list_itr_create(jokers);
-                copied_joker_object = list_itr_next(&itr);
-                break;
-
-            // We encountered a Joker that isn't a Copying Joker and copy it now
-            // but how we copy it depends on this Joker's ID because they don't
-            // all handle data the same way.
-            default:
-                u8 copied_joker_id = copied_joker_object->joker->id;
-                const JokerInfo* copied_joker_info = get_joker_registry_entry(copied_joker_id);
-
-                // Copy the persistent data
-                joker->persistent_state = copied_joker_object->joker->persistent_state;
-
-                // Then regardless of if we copied the data above, apply the
-                // copied JokerEffect function to the local data
-                effect_flags_ret =
-                    copied_joker_info
-                        ->joker_effect_func(joker, scored_card, joker_event, joker_effect);
-
-                // make also sure we don't expire
-                effect_flags_ret &= ~JOKER_EFFECT_FLAG_EXPIRE;
-
-                // exit the loop
-                copied_joker_object = NULL;
-
-                break;
-        }
-    } while (copied_joker_object != NULL && brainstorm_counter < 2);
-
-    return effect_flags_ret;
-}
-
 static u32 hack_joker_effect(
     Joker* joker,
     Card* scored_card,
@@ -1683,10 +1605,10 @@ static u32 hack_joker_effect(
                     *joker_effect = &shared_joker_effect;
 
                     (*joker_effect)->retrigger =
-                        (*p_last_retriggered_index < get_scored_card_index());
+                        (*p_last_retriggered_index < score_get_scored_card_index());
                     if ((*joker_effect)->retrigger)
                     {
-                        *p_last_retriggered_index = get_scored_card_index();
+                        *p_last_retriggered_index = score_get_scored_card_index();
                         (*joker_effect)->message = "Again!";
                         effect_flags_ret = JOKER_EFFECT_FLAG_RETRIGGER | JOKER_EFFECT_FLAG_MESSAGE;
                     }
@@ -1729,10 +1651,11 @@ static u32 seltzer_joker_effect(
             // will be destroyed the moment we hit 0
             *joker_effect = &shared_joker_effect;
 
-            (*joker_effect)->retrigger = ((*p_last_retriggered_idx) < get_scored_card_index());
+            (*joker_effect)->retrigger =
+                ((*p_last_retriggered_idx) < score_get_scored_card_index());
             if ((*joker_effect)->retrigger)
             {
-                *p_last_retriggered_idx = get_scored_card_index();
+                *p_last_retriggered_idx = score_get_scored_card_index();
                 (*joker_effect)->message = "Again!";
                 effect_flags_ret = JOKER_EFFECT_FLAG_RETRIGGER | JOKER_EFFECT_FLAG_MESSAGE;
             }
@@ -1788,11 +1711,11 @@ static u32 sock_and_buskin_joker_effect(
 
             // Works the same way as Dusk, but for face cards
             (*joker_effect)->retrigger =
-                ((*p_last_retriggered_face_index < get_scored_card_index()) &&
+                ((*p_last_retriggered_face_index < score_get_scored_card_index()) &&
                  card_is_face(scored_card));
             if ((*joker_effect)->retrigger)
             {
-                *p_last_retriggered_face_index = get_scored_card_index();
+                *p_last_retriggered_face_index = score_get_scored_card_index();
                 (*joker_effect)->message = "Again!";
                 effect_flags_ret = JOKER_EFFECT_FLAG_RETRIGGER | JOKER_EFFECT_FLAG_MESSAGE;
             }
@@ -0,0 +1,69 @@
+// Generated by scripts/cluster_joker_palettes.py, do not edit
+#include "joker.h"
+#include "util.h"
+
+// clang-format off
+const u16 joker_palettes[][PAL_ROW_LEN] = {
+    {
+        0x0000, 0x7fff, 0x0dba, 0x6b38, 0x1e3e, 0x0d30, 0x3189, 0x297f,
+        0x46fe, 0x7220, 0x029f, 0x6bbf, 0x7f30, 0x2e7d, 0x6f7b, 0x573e,
+    },
+    {
+        0x0000, 0x7fff, 0x6b38, 0x5daf, 0x4d2a, 0x421f, 0x5e1b, 0x30de,
+        0x3189, 0x319f, 0x0c74, 0x6194, 0x4e0c, 0x777c, 0x6695, 0x029f,
+    },
+    {
+        0x0000, 0x7fff, 0x6b38, 0x3189, 0x49eb, 0x4a68, 0x39e4, 0x7f52,
+        0x5b10, 0x2964, 0x4ffc, 0x47ff, 0x5a8f, 0x39ea, 0x666b, 0x297f,
+    },
+    {
+        0x0000, 0x7fff, 0x6b38, 0x3189, 0x41ea, 0x256f, 0x29bf, 0x4b7f,
+        0x4a68, 0x772e, 0x337b, 0x5ab0, 0x3e3d, 0x3d9e, 0x4599, 0x7220,
+    },
+    {
+        0x0000, 0x7fff, 0x6b38, 0x3189, 0x299f, 0x7640, 0x029f, 0x7f30,
+        0x3e3e, 0x477f, 0x4a2f, 0x2db4, 0x2b1c, 0x3dcc, 0x1d5c, 0x125b,
+    },
+    {
+        0x0000, 0x7fff, 0x6b38, 0x3d92, 0x49b0, 0x3189, 0x3b3c, 0x41da,
+        0x6fbe, 0x6e92, 0x3999, 0x5696, 0x35f5, 0x477d, 0x65ee, 0x660e,
+    },
+    {
+        0x0000, 0x7fff, 0x6b38, 0x39cb, 0x6987, 0x760c, 0x7b78, 0x297f,
+        0x4a68, 0x2d96, 0x2964, 0x5ef1, 0x029f, 0x7ef5, 0x1659, 0x2114,
+    },
+    {
+        0x0000, 0x6f58, 0x39c9, 0x7fff, 0x4669, 0x297f, 0x5674, 0x29b3,
+        0x524e, 0x67de, 0x431d, 0x7b3c, 0x7e60, 0x2d9a, 0x4dc6, 0x029f,
+    },
+    {
+        0x0000, 0x7fff, 0x6b38, 0x3189, 0x7f35, 0x0aba, 0x7a40, 0x7f98,
+        0x335f, 0x0f5f, 0x7730, 0x662a, 0x0afd, 0x297f, 0x0e7d, 0x4da9,
+    },
+    {
+        0x0000, 0x7fff, 0x6b38, 0x3189, 0x7f0f, 0x3f5c, 0x322f, 0x43bf,
+        0x45c8, 0x66d2, 0x4b9b, 0x7fdb, 0x4e2c, 0x564e, 0x297f, 0x2216,
+    },
+    {
+        0x0000, 0x3189, 0x6b38, 0x2e9d, 0x263d, 0x297f, 0x191f, 0x21ba,
+        0x2df2, 0x3277, 0x7fff, 0x25db, 0x21fd, 0x42fb, 0x41ed, 0x0000,
+    },
+    {
+        0x0000, 0x297e, 0x6bbf, 0x6b38, 0x65ab, 0x7bbd, 0x7e60, 0x3189,
+        0x2aff, 0x624f, 0x2dd4, 0x575b, 0x45a9, 0x6ef2, 0x7f75, 0x029f,
+    },
+};
+
+const u8 joker_spritesheet_palettes[] = {
+    0, 1, 2, 3, 4, 3, 4, 4, 5, 6, 7, 4, 8, 9, 10, 7, 4, 2, 3, 6, 11, 8, 7, 7, 1, 11,
+};
+// clang-format on
+
+_Static_assert(
+    NUM_ELEM_IN_ARR(joker_spritesheet_palettes) == NUM_JOKER_SPRITESHEETS,
+    "Run scripts/cluster_joker_palettes.py after changing the Joker spritesheets"
+);
+_Static_assert(
+    NUM_ELEM_IN_ARR(joker_palettes) <= JOKER_LAST_PB - JOKER_BASE_PB + 1,
+    "Every Joker palette needs its own palette bank"
+);
@@ -5,6 +5,7 @@
 #include "game.h"
 #include "graphic_utils.h"
 #include "joker.h"
+#include "profiler.h"
 #include "sprite.h"
 
 #include <maxmod.h>
@@ -19,11 +20,20 @@
 #include "soundbank.h"
 #include "soundbank_bin.h"
 
+static void s_vblank_isr(void)
+{
+    affine_background_vblank();
+    mmVBlank();
+    PROFILER_VBLANK();
+}
+
 void init()
 {
     irq_init(NULL);
-    irq_add(II_VBLANK, mmVBlank);
+    irq_add(II_VBLANK, s_vblank_isr);
+#if !AFFINE_BG_HBLANK_DMA
     irq_add(II_HBLANK, affine_background_hblank);
+#endif
 
     // Initialize text engine
     tte_init_se(
@@ -79,6 +89,7 @@ void init()
                   DCNT_WIN1;
 
     // Initialize subsystems
+    PROFILER_INIT();
     mmInitDefault((mm_addr)soundbank_bin, 12);
     affine_background_init();
     sprite_init();
@@ -91,13 +102,26 @@ void init()
 
 void update()
 {
+    PROFILER_ZONE_BEGIN(PROFILER_ZONE_AFFINE_BACKGROUND);
     affine_background_update();
+    PROFILER_ZONE_END(PROFILER_ZONE_AFFINE_BACKGROUND);
+
+    PROFILER_ZONE_BEGIN(PROFILER_ZONE_GAME_UPDATE);
     game_update();
+    PROFILER_ZONE_END(PROFILER_ZONE_GAME_UPDATE);
 }
 
+// Copy the video state computed by the last update() to the hardware. This has to be done in
+// VBLANK, before the first scanline is drawn, or the frame tears.
 void draw()
 {
+    PROFILER_ZONE_BEGIN(PROFILER_ZONE_DRAW);
     sprite_draw();
+    affine_background_commit();
+    PROFILER_ZONE_END(PROFILER_ZONE_DRAW);
+
+    PROFILER_CHECK_COMMIT_DEADLINE();
+    PROFILER_DRAW_OVERLAY();
 }
 
 int main()
@@ -106,11 +130,19 @@ int main()
 
     while (true)
     {
-        VBlankIntrWait();
+        PROFILER_WAIT_VBLANK();
+        PROFILER_FRAME_BEGIN();
+
+        // The last frame's video state first, while still in VBLANK
+        draw();
+
+        // Then the mixing and logic of the next frame, they can take the rest of the frame
+        PROFILER_ZONE_BEGIN(PROFILER_ZONE_MM_FRAME);
         mmFrame();
+        PROFILER_ZONE_END(PROFILER_ZONE_MM_FRAME);
+
         key_poll();
         update();
-        draw();
     }
 
     return 0;
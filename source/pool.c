@@ -1,5 +1,45 @@
 #include "pool.h"
 
-#define POOL_ENTRY(name, capacity) POOL_DEFINE_TYPE(name, capacity);
+#include <stdio.h>
+
+#define POOL_ENTRY(name, capacity, flags) POOL_DEFINE_TYPE(name, capacity, flags);
+#include POOLS_DEF_FILE
+#undef POOL_ENTRY
+
+// The stats functions include POOLS_DEF_FILE again, with each POOL_ENTRY as a statement
+
+int pool_get_stats(const PoolStats** stats, int max_stats)
+{
+    int num_stats = 0;
+
+#define POOL_ENTRY(name, capacity, flags) \
+    if (num_stats < max_stats)            \
+    stats[num_stats++] = &name##_stats
 #include POOLS_DEF_FILE
 #undef POOL_ENTRY
+
+    return num_stats;
+}
+
+void pool_reset_stats(void)
+{
+#define POOL_ENTRY(name, capacity, flags)                   \
+    name##_stats.high_water_mark = name##_stats.num_in_use; \
+    name##_stats.failed_gets = 0
+#include POOLS_DEF_FILE
+#undef POOL_ENTRY
+}
+
+int pool_stats_to_str(const PoolStats* stats, char* buffer, size_t size)
+{
+    return snprintf(
+        buffer,
+        size,
+        "%s %u/%u max %u failed %u",
+        stats->name,
+        stats->num_in_use,
+        stats->capacity,
+        stats->high_water_mark,
+        stats->failed_gets
+    );
+}
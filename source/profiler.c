@@ -0,0 +1,301 @@
+#include "profiler.h"
+
+#include "graphic_utils.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef PROFILER
+
+#ifdef PROFILER_OVERLAY
+#include "pool.h"
+
+// Enough for every pool of POOLS_DEF_FILE
+#define OVERLAY_MAX_POOLS 8
+
+static int _overlay_pool = 0;
+
+static const char* const _zone_names[PROFILER_NUM_ZONES] = {
+    [PROFILER_ZONE_MM_FRAME] = "MM",
+    [PROFILER_ZONE_AFFINE_BACKGROUND] = "BG",
+    [PROFILER_ZONE_GAME_UPDATE] = "GU",
+    [PROFILER_ZONE_DRAW] = "DR",
+};
+#endif
+
+#ifdef PROFILER_LOG
+#include <stdio.h>
+
+// mGBA's debug log registers, other emulators and the hardware ignore the writes
+#define MGBA_DEBUG_ENABLE      *(vu16*)0x4FFF780
+#define MGBA_DEBUG_FLAGS       *(vu16*)0x4FFF700
+#define MGBA_DEBUG_STRING      ((char*)0x4FFF600)
+#define MGBA_DEBUG_STRING_SIZE 256
+#define MGBA_DEBUG_ENABLE_KEY  0xC0DE
+#define MGBA_DEBUG_SEND_INFO   (0x100 | 3)
+#endif
+
+static ProfilerStats _stats;
+static bool _stats_published = false;
+
+static volatile u32 _vblank_count = 0;
+static u32 _frame_vblank_count = 0;
+static bool _frame_started = false;
+
+// Cycles per spin of s_profiler_spin() in 24.8 fixed point, and the spins of the last wait
+static u32 _spin_cycles_fx = 0;
+static u32 _frame_wait_spins = 0;
+
+// The current frame
+static u32 _zone_start[PROFILER_NUM_ZONES];
+static u32 _zone_cycles[PROFILER_NUM_ZONES];
+
+// The current window
+static int _window_frames = 0;
+static u32 _window_min[PROFILER_NUM_ZONES];
+static u32 _window_max[PROFILER_NUM_ZONES];
+static u32 _window_sum[PROFILER_NUM_ZONES];
+static u32 _window_free_sum = 0;
+
+static inline u32 s_profiler_now(void)
+{
+    // Read the high half again in case the low half overflowed in between
+    u16 high, low;
+    do
+    {
+        high = REG_TM3D;
+        low = REG_TM2D;
+    } while (high != REG_TM3D);
+
+    return ((u32)high << 16) | low;
+}
+
+static void s_profiler_window_reset(void)
+{
+    _window_frames = 0;
+    memset(_window_sum, 0, sizeof(_window_sum));
+    memset(_window_max, 0, sizeof(_window_max));
+    memset(_window_min, 0xFF, sizeof(_window_min));
+    _window_free_sum = 0;
+}
+
+// The calibration and the wait both use this loop so a spin always takes as many cycles, the
+// interrupts that run in the middle of a wait only make it spin less
+__attribute__((noinline)) static u32 s_profiler_spin(u32 vblank_count, u32 max_spins)
+{
+    u32 spins = 0;
+    while (_vblank_count == vblank_count && spins < max_spins)
+    {
+        spins++;
+    }
+
+    return spins;
+}
+
+static enum ProfilerZone s_profiler_get_frame_worst_zone(void)
+{
+    enum ProfilerZone worst = PROFILER_ZONE_NONE;
+    u32 worst_cycles = 0;
+
+    for (int zone = 0; zone < PROFILER_NUM_ZONES; zone++)
+    {
+        if (_zone_cycles[zone] > worst_cycles)
+        {
+            worst = zone;
+            worst_cycles = _zone_cycles[zone];
+        }
+    }
+
+    return worst;
+}
+
+void profiler_init(void)
+{
+    REG_TM2CNT = 0;
+    REG_TM3CNT = 0;
+    REG_TM2D = 0;
+    REG_TM3D = 0;
+    // Timer 3 counts the overflows of timer 2, which counts every cycle
+    REG_TM3CNT = TM_ENABLE | TM_CASCADE;
+    REG_TM2CNT = TM_ENABLE | TM_FREQ_1;
+
+    // With the interrupts off no VBLANK can end the spins early
+    u16 ime = REG_IME;
+    REG_IME = 0;
+    u32 start = s_profiler_now();
+    s_profiler_spin(_vblank_count, PROFILER_CALIBRATION_SPINS);
+    _spin_cycles_fx = ((s_profiler_now() - start) << 8) / PROFILER_CALIBRATION_SPINS;
+    REG_IME = ime;
+    _frame_wait_spins = 0;
+
+#ifdef PROFILER_LOG
+    MGBA_DEBUG_ENABLE = MGBA_DEBUG_ENABLE_KEY;
+#endif
+
+    memset(&_stats, 0, sizeof(_stats));
+    _stats.last_drop_zone = PROFILER_ZONE_NONE;
+    _stats_published = false;
+
+    memset(_zone_cycles, 0, sizeof(_zone_cycles));
+    s_profiler_window_reset();
+    _frame_started = false;
+}
+
+IWRAM_CODE void profiler_vblank(void)
+{
+    _vblank_count++;
+}
+
+void profiler_frame_begin(void)
+{
+    u32 vblank_count = _vblank_count;
+    u32 frame_vblanks = vblank_count - _frame_vblank_count;
+    _frame_vblank_count = vblank_count;
+
+    // The first call only starts the first frame
+    if (!_frame_started)
+    {
+        _frame_started = true;
+        memset(_zone_cycles, 0, sizeof(_zone_cycles));
+        _frame_wait_spins = 0;
+        return;
+    }
+
+    if (frame_vblanks > 1)
+    {
+        _stats.missed_vblanks += frame_vblanks - 1;
+
+        enum ProfilerZone worst = s_profiler_get_frame_worst_zone();
+        _stats.last_drop_zone = worst;
+        if (worst != PROFILER_ZONE_NONE)
+        {
+            _stats.zones[worst].drops++;
+        }
+    }
+
+    for (int zone = 0; zone < PROFILER_NUM_ZONES; zone++)
+    {
+        u32 cycles = _zone_cycles[zone];
+        _window_sum[zone] += cycles;
+        // Not tonc's min() and max(), they take ints
+        if (cycles < _window_min[zone])
+        {
+            _window_min[zone] = cycles;
+        }
+        if (cycles > _window_max[zone])
+        {
+            _window_max[zone] = cycles;
+        }
+    }
+    memset(_zone_cycles, 0, sizeof(_zone_cycles));
+    _window_free_sum += (_frame_wait_spins * _spin_cycles_fx) >> 8;
+    _frame_wait_spins = 0;
+    _stats.frames++;
+
+    if (++_window_frames < PROFILER_WINDOW)
+        return;
+
+    for (int zone = 0; zone < PROFILER_NUM_ZONES; zone++)
+    {
+        _stats.zones[zone].min = _window_min[zone];
+        _stats.zones[zone].avg = _window_sum[zone] / PROFILER_WINDOW;
+        _stats.zones[zone].max = _window_max[zone];
+    }
+    _stats.free_cycles = _window_free_sum / PROFILER_WINDOW;
+    _stats_published = true;
+    s_profiler_window_reset();
+
+#ifdef PROFILER_LOG
+    // Average cycles per frame, exact where the overlay only has room for percents
+    snprintf(
+        MGBA_DEBUG_STRING,
+        MGBA_DEBUG_STRING_SIZE,
+        "profiler MM %lu BG %lu GU %lu DR %lu free %lu X %lu C %lu",
+        _stats.zones[PROFILER_ZONE_MM_FRAME].avg,
+        _stats.zones[PROFILER_ZONE_AFFINE_BACKGROUND].avg,
+        _stats.zones[PROFILER_ZONE_GAME_UPDATE].avg,
+        _stats.zones[PROFILER_ZONE_DRAW].avg,
+        _stats.free_cycles,
+        _stats.missed_vblanks,
+        _stats.missed_commit_deadlines
+    );
+    MGBA_DEBUG_FLAGS = MGBA_DEBUG_SEND_INFO;
+#endif
+}
+
+void profiler_wait_vblank(void)
+{
+    _frame_wait_spins = s_profiler_spin(_vblank_count, UINT32_MAX);
+}
+
+void profiler_zone_begin(enum ProfilerZone zone)
+{
+    _zone_start[zone] = s_profiler_now();
+}
+
+void profiler_zone_end(enum ProfilerZone zone)
+{
+    _zone_cycles[zone] += s_profiler_now() - _zone_start[zone];
+}
+
+void profiler_check_commit_deadline(void)
+{
+    // VCOUNT is back on a visible scanline once VBLANK is over
+    if (REG_VCOUNT < SCREEN_HEIGHT)
+    {
+        _stats.missed_commit_deadlines++;
+    }
+}
+
+const ProfilerStats* profiler_get_stats(void)
+{
+    return &_stats;
+}
+
+void profiler_draw_overlay(void)
+{
+#ifdef PROFILER_OVERLAY
+    if (!_stats_published)
+        return;
+
+    _stats_published = false;
+
+    // Average percent of the frame per zone, the missed VBLANKs and the zone of the last one, then
+    // the missed commit deadlines and the free percent
+    tte_erase_rect(0, 0, SCREEN_WIDTH, TTE_CHAR_SIZE);
+    tte_set_pos(0, 0);
+    for (int zone = 0; zone < PROFILER_NUM_ZONES; zone++)
+    {
+        u32 percent = _stats.zones[zone].avg * 100 / PROFILER_FRAME_CYCLES;
+        tte_printf("%s%lu ", _zone_names[zone], percent);
+    }
+    tte_printf(
+        "X%lu %s C%lu F%lu",
+        _stats.missed_vblanks,
+        _stats.last_drop_zone == PROFILER_ZONE_NONE ? "-" : _zone_names[_stats.last_drop_zone],
+        _stats.missed_commit_deadlines,
+        _stats.free_cycles * 100 / PROFILER_FRAME_CYCLES
+    );
+
+    // One pool per window on the second line: objects in use/capacity, high water mark and failed
+    // gets, the same stats as pool_stats_to_str() but short enough for a line
+    const PoolStats* pool_stats[OVERLAY_MAX_POOLS];
+    int num_pools = pool_get_stats(pool_stats, OVERLAY_MAX_POOLS);
+    if (num_pools > 0)
+    {
+        const PoolStats* stats = pool_stats[_overlay_pool++ % num_pools];
+        tte_erase_rect(0, TTE_CHAR_SIZE, SCREEN_WIDTH, 2 * TTE_CHAR_SIZE);
+        tte_set_pos(0, TTE_CHAR_SIZE);
+        tte_printf(
+            "%s %u/%u ^%u !%u",
+            stats->name,
+            stats->num_in_use,
+            stats->capacity,
+            stats->high_water_mark,
+            stats->failed_gets
+        );
+    }
+#endif
+}
+
+#endif // PROFILER
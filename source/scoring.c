@@ -0,0 +1,607 @@
+#include "scoring.h"
+
+#include "hand_analysis.h"
+#include "util.h"
+#include "vector.h"
+
+#include <string.h>
+
+// clang-format off
+static const HandValues hand_base_values[] = {
+    {.chips = 0,   .mult = 0,  .display_name = NULL     }, // NONE
+    {.chips = 5,   .mult = 1,  .display_name = "HIGH C" }, // HIGH_CARD
+    {.chips = 10,  .mult = 2,  .display_name = "PAIR"   }, // PAIR
+    {.chips = 20,  .mult = 2,  .display_name = "2 PAIR" }, // TWO_PAIR
+    {.chips = 30,  .mult = 3,  .display_name = "3 OAK"  }, // THREE_OF_A_KIND
+    {.chips = 60,  .mult = 7,  .display_name = "4 OAK"  }, // FOUR_OF_A_KIND
+    {.chips = 30,  .mult = 4,  .display_name = "STRT"   }, // STRAIGHT
+    {.chips = 35,  .mult = 4,  .display_name = "FLUSH"  }, // FLUSH
+    {.chips = 40,  .mult = 4,  .display_name = "FULL H" }, // FULL_HOUSE
+    {.chips = 100, .mult = 8,  .display_name = "STRT F" }, // STRAIGHT_FLUSH
+    {.chips = 100, .mult = 8,  .display_name = "ROYAL F"}, // ROYAL_FLUSH
+    {.chips = 120, .mult = 12, .display_name = "5 OAK"  }, // FIVE_OF_A_KIND
+    {.chips = 140, .mult = 14, .display_name = "FLUSH H"}, // FLUSH_HOUSE
+    {.chips = 160, .mult = 16, .display_name = "FLUSH 5"}  // FLUSH_FIVE
+};
+// clang-format on
+
+// State of the hand currently being scored, read by the Joker effects through the accessors
+static CardObject** _played = NULL;
+static int _num_played = 0;
+static HandMasks _played_masks;
+static CardObject** _held = NULL;
+static int _num_held = 0;
+static Vector* _jokers = NULL;
+static const JokerEventIndex* _joker_index = NULL;
+static const ScoreContext* _ctx = NULL;
+static int _scored_card_index = 0;
+
+static u32 _chips = 0;
+static u32 _mult = 0;
+static int _money = 0;
+
+static ScoreResult* _result = NULL;
+
+static void s_select_scoring_cards(enum HandType hand_type, bool* selection);
+static void s_record_step(
+    enum ScoreStepType type,
+    enum JokerEvent joker_event,
+    int card_idx,
+    JokerObject* joker_object,
+    u32 effect_flags,
+    const JokerEffect* effect
+);
+static bool s_score_joker(
+    const JokerSubscriber* subscriber,
+    Card* card,
+    int card_idx,
+    enum JokerEvent joker_event
+);
+static void s_score_jokers_for_event(Card* card, int card_idx, enum JokerEvent joker_event);
+static void s_score_played_card(int played_idx);
+
+const HandValues* score_get_hand_base_values(enum HandType hand_type)
+{
+    return &hand_base_values[hand_type];
+}
+
+void score_apply_joker_effect(
+    u32 effect_flags,
+    const JokerEffect* joker_effect,
+    u32* chips,
+    u32* mult,
+    int* money
+)
+{
+    if (effect_flags & JOKER_EFFECT_FLAG_CHIPS)
+    {
+        *chips = u32_protected_add(*chips, joker_effect->chips);
+    }
+    if (effect_flags & JOKER_EFFECT_FLAG_MULT)
+    {
+        *mult = u32_protected_add(*mult, joker_effect->mult);
+    }
+    // if xmult is zero, DO NOT multiply by it
+    if (effect_flags & JOKER_EFFECT_FLAG_XMULT && joker_effect->xmult > 0)
+    {
+        *mult = u32_protected_mult(*mult, joker_effect->xmult);
+    }
+    if (effect_flags & JOKER_EFFECT_FLAG_MONEY)
+    {
+        *money += joker_effect->money;
+    }
+}
+
+void score_hand(
+    CardObject** played,
+    int num_played,
+    CardObject** held,
+    int num_held,
+    Vector* jokers,
+    const JokerEventIndex* joker_index,
+    const ScoreContext* ctx,
+    ScoreResult* result
+)
+{
+    _played = played;
+    _num_played = num_played;
+    _held = held;
+    _num_held = num_held;
+    _jokers = jokers;
+    _joker_index = joker_index;
+    _ctx = ctx;
+    _result = result;
+
+    result->num_steps = 0;
+    result->num_expired_jokers = 0;
+    memset(result->scoring_cards, 0, sizeof(result->scoring_cards));
+
+    u8 suits[NUM_SUITS];
+    u8 ranks[NUM_RANKS];
+    score_get_played_distribution(ranks, suits);
+    hand_masks_from_cards(&_played_masks, played, num_played - 1);
+
+    result->hand_type = num_played > 0 ? hand_get_type_from_distribution(ranks, suits) : NONE;
+    s_select_scoring_cards(result->hand_type, result->scoring_cards);
+
+    const HandValues* hand_values = score_get_hand_base_values(result->hand_type);
+    _chips = hand_values->chips;
+    _mult = hand_values->mult;
+    _money = ctx->money;
+
+    // Activate Jokers with an effect just before the hand is scored
+    _scored_card_index = 0;
+    s_score_jokers_for_event(NULL, UNDEFINED, JOKER_EVENT_ON_HAND_PLAYED);
+
+    for (int i = 0; i < num_played; i++)
+    {
+        if (result->scoring_cards[i])
+        {
+            s_score_played_card(i);
+        }
+    }
+
+    // Held cards are scored from the end of the hand like the rest of the hand animations
+    for (int i = num_held - 1; i >= 0; i--)
+    {
+        _scored_card_index = i;
+        s_score_jokers_for_event(held[i]->card, i, JOKER_EVENT_ON_CARD_HELD);
+    }
+
+    _scored_card_index = 0;
+    s_score_jokers_for_event(NULL, UNDEFINED, JOKER_EVENT_INDEPENDENT);
+
+    _scored_card_index = num_played;
+    s_score_jokers_for_event(NULL, UNDEFINED, JOKER_EVENT_ON_HAND_SCORED_END);
+
+    result->chips = _chips;
+    result->mult = _mult;
+    result->score = u32_protected_mult(_chips, _mult);
+    result->money_delta = _money - ctx->money;
+
+    _result = NULL;
+}
+
+static void s_score_played_card(int played_idx)
+{
+    Card* card = _played[played_idx]->card;
+    _scored_card_index = played_idx;
+
+    bool retrigger;
+    do
+    {
+        retrigger = false;
+
+        u8 card_value = card_get_value(card);
+        _chips = u32_protected_add(_chips, card_value);
+
+        JokerEffect card_effect = {.chips = card_value};
+        s_record_step(
+            SCORE_STEP_CARD,
+            JOKER_EVENT_ON_CARD_SCORED,
+            played_idx,
+            NULL,
+            JOKER_EFFECT_FLAG_CHIPS,
+            &card_effect
+        );
+
+        s_score_jokers_for_event(card, played_idx, JOKER_EVENT_ON_CARD_SCORED);
+
+        // Trigger all Jokers that have an effect when a card finishes scoring
+        // (e.g. retriggers) after activating all the other scored_card Jokers normally.
+        // A retrigger scores the card again from the start, the retrigger Jokers themselves
+        // keep track of which cards they already retriggered.
+        const JokerSubscriber* subscribers =
+            _joker_index->subscribers[JOKER_EVENT_ON_CARD_SCORED_END];
+        int num_subscribers = _joker_index->num_subscribers[JOKER_EVENT_ON_CARD_SCORED_END];
+        for (int i = 0; i < num_subscribers && !retrigger; i++)
+        {
+            JokerEffect* joker_effect = NULL;
+            u32 effect_flags = joker_subscriber_get_score_effect(
+                &subscribers[i],
+                card,
+                JOKER_EVENT_ON_CARD_SCORED_END,
+                &joker_effect
+            );
+
+            if (effect_flags != JOKER_EFFECT_FLAG_NONE)
+            {
+                score_apply_joker_effect(effect_flags, joker_effect, &_chips, &_mult, &_money);
+                s_record_step(
+                    SCORE_STEP_JOKER,
+                    JOKER_EVENT_ON_CARD_SCORED_END,
+                    played_idx,
+                    subscribers[i].joker_object,
+                    effect_flags,
+                    joker_effect
+                );
+                retrigger = (effect_flags & JOKER_EFFECT_FLAG_RETRIGGER) && joker_effect->retrigger;
+            }
+        }
+    } while (retrigger);
+}
+
+static void s_score_jokers_for_event(Card* card, int card_idx, enum JokerEvent joker_event)
+{
+    const JokerSubscriber* subscribers = _joker_index->subscribers[joker_event];
+    int num_subscribers = _joker_index->num_subscribers[joker_event];
+
+    for (int i = 0; i < num_subscribers; i++)
+    {
+        s_score_joker(&subscribers[i], card, card_idx, joker_event);
+    }
+}
+
+static bool s_score_joker(
+    const JokerSubscriber* subscriber,
+    Card* card,
+    int card_idx,
+    enum JokerEvent joker_event
+)
+{
+    JokerEffect* joker_effect = NULL;
+    u32 effect_flags =
+        joker_subscriber_get_score_effect(subscriber, card, joker_event, &joker_effect);
+
+    if (effect_flags == JOKER_EFFECT_FLAG_NONE)
+    {
+        return false;
+    }
+
+    score_apply_joker_effect(effect_flags, joker_effect, &_chips, &_mult, &_money);
+    s_record_step(
+        SCORE_STEP_JOKER,
+        joker_event,
+        card_idx,
+        subscriber->joker_object,
+        effect_flags,
+        joker_effect
+    );
+
+    return true;
+}
+
+static void s_record_expired_joker(JokerObject* joker_object)
+{
+    PoolHandle handle = POOL_HANDLE(JokerObject, joker_object);
+    for (int i = 0; i < _result->num_expired_jokers; i++)
+    {
+        if (_result->expired_jokers[i].idx == handle.idx)
+        {
+            return;
+        }
+    }
+
+    _result->expired_jokers[_result->num_expired_jokers++] = handle;
+}
+
+static void s_record_step(
+    enum ScoreStepType type,
+    enum JokerEvent joker_event,
+    int card_idx,
+    JokerObject* joker_object,
+    u32 effect_flags,
+    const JokerEffect* effect
+)
+{
+    // Expirations are kept apart from the steps so they are never dropped
+    if (type == SCORE_STEP_JOKER && (effect_flags & JOKER_EFFECT_FLAG_EXPIRE) && effect->expire)
+    {
+        s_record_expired_joker(joker_object);
+    }
+
+    if (_result->num_steps >= MAX_SCORE_STEPS)
+    {
+        return;
+    }
+
+    ScoreStep* step = &_result->steps[_result->num_steps++];
+    step->type = type;
+    step->joker_event = joker_event;
+    step->card_idx = card_idx;
+    step->joker_object = joker_object;
+    step->effect_flags = effect_flags;
+    step->effect = *effect;
+    step->chips = _chips;
+    step->mult = _mult;
+    step->money = _money;
+}
+
+// The scoring card selection below works on the played cards the same way
+// the game used to mark them as selected before scoring them.
+
+static void s_select_highcard_cards(bool* selection)
+{
+    // find the card with the highest rank in the hand
+    int highest_rank_index = 0;
+
+    for (int i = 0; i < _num_played; i++)
+    {
+        if (_played[i]->card->rank > _played[highest_rank_index]->card->rank)
+        {
+            highest_rank_index = i;
+        }
+    }
+
+    selection[highest_rank_index] = true;
+}
+
+static void s_select_pair_cards(bool* selection)
+{
+    int top = _num_played - 1;
+
+    // find two cards with the same rank
+    for (int i = 0; i <= top - 1; i++)
+    {
+        for (int j = i + 1; j <= top; j++)
+        {
+            if (_played[i]->card->rank == _played[j]->card->rank)
+            {
+                selection[i] = true;
+                selection[j] = true;
+                break;
+            }
+        }
+
+        if (selection[i])
+            break;
+    }
+}
+
+static void s_select_two_pair_cards(bool* selection)
+{
+    int top = _num_played - 1;
+
+    // find two pairs of cards with the same rank
+    int i;
+
+    for (i = 0; i <= top - 1; i++)
+    {
+        for (int j = i + 1; j <= top; j++)
+        {
+            if (_played[i]->card->rank == _played[j]->card->rank)
+            {
+                selection[i] = true;
+                selection[j] = true;
+
+                break;
+            }
+        }
+
+        if (selection[i])
+            break;
+    }
+
+    for (; i <= top - 1; i++) // Find second pair
+    {
+        for (int j = i + 1; j <= top; j++)
+        {
+            if (_played[i]->card->rank == _played[j]->card->rank && !selection[i] && !selection[j])
+            {
+                selection[i] = true;
+                selection[j] = true;
+                break;
+            }
+        }
+    }
+}
+
+static void s_select_three_of_a_kind_cards(bool* selection)
+{
+    int top = _num_played - 1;
+
+    // find three cards with the same rank
+    for (int i = 0; i <= top - 1; i++)
+    {
+        for (int j = i + 1; j <= top; j++)
+        {
+            if (_played[i]->card->rank == _played[j]->card->rank)
+            {
+                selection[i] = true;
+                selection[j] = true;
+
+                for (int k = j + 1; k <= top; k++)
+                {
+                    if (_played[i]->card->rank == _played[k]->card->rank && !selection[k])
+                    {
+                        selection[k] = true;
+                        break;
+                    }
+                }
+
+                break;
+            }
+        }
+
+        if (selection[i])
+            break;
+    }
+}
+
+static void s_select_four_of_a_kind_cards(bool* selection)
+{
+    int top = _num_played - 1;
+
+    // find four cards with the same rank
+    // If there are 5 cards selected we just need to find the one card that doesn't match, and
+    // select the others
+    if (top >= 3)
+    {
+        int unmatched_index = -1;
+
+        for (int i = 0; i <= top; i++)
+        {
+            if (_played[i]->card->rank != _played[(i + 1) % top]->card->rank &&
+                _played[i]->card->rank != _played[(i + 2) % top]->card->rank)
+            {
+                unmatched_index = i;
+                break;
+            }
+        }
+
+        for (int i = 0; i <= top; i++)
+        {
+            if (i != unmatched_index)
+            {
+                selection[i] = true;
+            }
+        }
+    }
+    else // If there are only 4 cards selected we know they match
+    {
+        for (int i = 0; i <= top; i++)
+        {
+            selection[i] = true;
+        }
+    }
+}
+
+static void s_select_flush_and_straight_cards(enum HandType hand_type, bool* selection)
+{
+    int top = _num_played - 1;
+
+    // Will be 4 if Four Fingers is in effect, otherwise 5
+    int min_len = get_straight_and_flush_size();
+
+    // if we have a flush in our hand
+    if (hand_type == FLUSH || hand_type == STRAIGHT_FLUSH || hand_type == ROYAL_FLUSH)
+    {
+        bool flush_selection[MAX_HAND_SIZE] = {false};
+        find_flush_in_played_cards(_played, top, min_len, flush_selection);
+        // Add the results into the final selection
+        for (int i = 0; i <= top; i++)
+        {
+            selection[i] = flush_selection[i];
+        }
+    }
+
+    // If we have a straight in our hand
+    if (hand_type == STRAIGHT || hand_type == STRAIGHT_FLUSH || hand_type == ROYAL_FLUSH)
+    {
+        bool straight_selection[MAX_HAND_SIZE] = {false};
+        find_straight_in_played_cards(
+            _played,
+            top,
+            is_shortcut_joker_active(),
+            min_len,
+            straight_selection
+        );
+        // Add the results into the final selection
+        for (int i = 0; i <= top; i++)
+        {
+            selection[i] = selection[i] || straight_selection[i];
+        }
+        // If Four Fingers is active, pairs can happen in a valid straight
+        // If Four Fingers is not active, pairs are impossible so this will not affect things
+        select_paired_cards_in_hand(_played, top, selection);
+    }
+}
+
+static void s_select_scoring_cards(enum HandType hand_type, bool* selection)
+{
+    switch (hand_type) // select the cards that apply to the hand type
+    {
+        case NONE:
+            break;
+        case HIGH_CARD:
+            s_select_highcard_cards(selection);
+            break;
+        case PAIR:
+            s_select_pair_cards(selection);
+            break;
+        case TWO_PAIR:
+            s_select_two_pair_cards(selection);
+            break;
+        case THREE_OF_A_KIND:
+            s_select_three_of_a_kind_cards(selection);
+            break;
+        case FOUR_OF_A_KIND:
+            s_select_four_of_a_kind_cards(selection);
+            break;
+        case STRAIGHT:
+            /* FALL THROUGH */
+        case FLUSH:
+            /* FALL THROUGH */
+        case STRAIGHT_FLUSH:
+            /* FALL THROUGH */
+        case ROYAL_FLUSH:
+            s_select_flush_and_straight_cards(hand_type, selection);
+            break;
+        case FULL_HOUSE:
+            /* FALL THROUGH */
+        case FIVE_OF_A_KIND:
+            /* FALL THROUGH */
+        case FLUSH_HOUSE:
+            /* FALL THROUGH */
+        case FLUSH_FIVE: // Select all played cards in the hand
+            for (int i = 0; i < _num_played; i++)
+            {
+                selection[i] = true;
+            }
+            break;
+    }
+}
+
+void score_get_played_distribution(u8* ranks_out, u8* suits_out)
+{
+    for (int i = 0; i < NUM_RANKS; i++)
+        ranks_out[i] = 0;
+    for (int i = 0; i < NUM_SUITS; i++)
+        suits_out[i] = 0;
+
+    for (int i = 0; i < _num_played; i++)
+    {
+        ranks_out[_played[i]->card->rank]++;
+        suits_out[_played[i]->card->suit]++;
+    }
+}
+
+const HandMasks* score_get_played_masks(void)
+{
+    return &_played_masks;
+}
+
+int score_get_played_size(void)
+{
+    return _num_played;
+}
+
+int score_get_scored_card_index(void)
+{
+    return _scored_card_index;
+}
+
+CardObject** score_get_held_cards(void)
+{
+    return _held;
+}
+
+int score_get_held_size(void)
+{
+    return _num_held;
+}
+
+int score_get_money(void)
+{
+    return _money;
+}
+
+int score_get_num_hands_remaining(void)
+{
+    return _ctx->hands_remaining;
+}
+
+int score_get_num_discards_remaining(void)
+{
+    return _ctx->discards_remaining;
+}
+
+int score_get_deck_size(void)
+{
+    return _ctx->deck_size;
+}
+
+Vector* score_get_jokers_list(void)
+{
+    return _jokers;
+}
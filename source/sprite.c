@@ -1,7 +1,9 @@
 #include "sprite.h"
 
 #include "audio_utils.h"
+#include "bitset.h"
 #include "game.h"
+#include "graphic_utils.h"
 #include "pool.h"
 #include "soundbank.h"
 #include "util.h"
@@ -14,9 +16,34 @@
 OBJ_ATTR obj_buffer[MAX_SPRITES];
 OBJ_AFFINE* obj_aff_buffer = (OBJ_AFFINE*)obj_buffer;
 
+// 0.7 in 1/256ths, the velocities are damped by it every update
+#define VELOCITY_DAMPING 179
+
 static Sprite* free_sprites[MAX_SPRITES] = {NULL};
 static bool free_affines[MAX_AFFINES] = {false};
 
+// The obj_buffer entries changed since the last sprite_draw()
+BITSET_DEFINE(_dirty_objs, MAX_SPRITES)
+
+// The OBJ palettes to copy in the next sprite_draw(), indexed by palette bank
+static const u16* _queued_palettes[NUM_PALETTES] = {NULL};
+
+// Each OBJ_AFFINE is spread over the unused attr3 of 4 OBJ_ATTRs
+#define OBJS_PER_AFFINE (int)(sizeof(OBJ_AFFINE) / sizeof(OBJ_ATTR))
+
+static void s_mark_obj_dirty(int obj_idx)
+{
+    bitset_set_idx(&_dirty_objs, obj_idx, true);
+}
+
+static void s_mark_affine_dirty(int aff_idx)
+{
+    for (int i = 0; i < OBJS_PER_AFFINE; i++)
+    {
+        s_mark_obj_dirty(aff_idx * OBJS_PER_AFFINE + i);
+    }
+}
+
 // Sprite methods
 Sprite* sprite_new(u16 a0, u16 a1, u32 tid, u32 pb, int sprite_index)
 {
@@ -61,6 +88,7 @@ Sprite* sprite_new(u16 a0, u16 a1, u32 tid, u32 pb, int sprite_index)
         sprite->aff = &obj_aff_buffer[aff_index];
         obj_set_attr(sprite->obj, a0, a1, ATTR2_PALBANK(pb) | tid);
         obj_aff_identity(&obj_aff_buffer[aff_index]);
+        s_mark_affine_dirty(aff_index);
     }
     else
     {
@@ -69,6 +97,7 @@ Sprite* sprite_new(u16 a0, u16 a1, u32 tid, u32 pb, int sprite_index)
     }
 
     sprite->idx = sprite_index;
+    s_mark_obj_dirty(sprite_index);
 
     return sprite;
 }
@@ -78,7 +107,7 @@ void sprite_destroy(Sprite** sprite)
     if (*sprite == NULL)
         return;
 
-    obj_hide((*sprite)->obj);
+    sprite_hide(*sprite);
 
     if ((*sprite)->aff != NULL)
     {
@@ -92,6 +121,57 @@ void sprite_destroy(Sprite** sprite)
     *sprite = NULL;
 }
 
+bool sprite_reorder(Sprite** sprites, int count, int first_index)
+{
+    if (first_index < 0 || first_index + count > MAX_SPRITES)
+        return false;
+
+    // Nothing to move, and attrs below can't have a size of 0
+    if (count <= 0)
+        return true;
+
+    for (int i = 0; i < count; i++)
+    {
+        Sprite* owner = free_sprites[first_index + i];
+        bool reordered = owner == NULL;
+        for (int j = 0; j < count && !reordered; j++)
+        {
+            reordered = sprites[j] == owner;
+        }
+
+        if (!reordered)
+            return false;
+    }
+
+    // Take every sprite out of its entry first, the entries are swapped around between them
+    OBJ_ATTR attrs[count];
+    for (int i = 0; i < count; i++)
+    {
+        if (sprites[i] == NULL)
+            continue;
+
+        attrs[i] = *sprites[i]->obj;
+        sprite_hide(sprites[i]);
+        free_sprites[sprites[i]->idx] = NULL;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        if (sprites[i] == NULL)
+            continue;
+
+        int sprite_index = first_index + i;
+        // Only attr0-2, the attr3 of the entry belongs to an OBJ_AFFINE
+        obj_set_attr(&obj_buffer[sprite_index], attrs[i].attr0, attrs[i].attr1, attrs[i].attr2);
+        sprites[i]->obj = &obj_buffer[sprite_index];
+        sprites[i]->idx = sprite_index;
+        free_sprites[sprite_index] = sprites[i];
+        s_mark_obj_dirty(sprite_index);
+    }
+
+    return true;
+}
+
 int sprite_get_layer(Sprite* sprite)
 {
     if (sprite == NULL || sprite->obj == NULL)
@@ -138,12 +218,77 @@ bool sprite_get_dimensions(Sprite* sprite, int* width, int* height)
 void sprite_init()
 {
     oam_init(obj_buffer, MAX_SPRITES);
+
+    for (int i = 0; i < MAX_SPRITES; i++)
+    {
+        s_mark_obj_dirty(i);
+    }
 }
 
 void sprite_draw()
 {
-    obj_aff_copy(obj_aff_mem, obj_aff_buffer, MAX_AFFINES);
-    oam_copy(oam_mem, obj_buffer, MAX_SPRITES);
+    // Copy each run of consecutive dirty entries at once. The whole OBJ_ATTRs are copied, so the
+    // OBJ_AFFINEs in their attr3 are copied along.
+    for (int word = 0; word < _dirty_objs.nwords; word++)
+    {
+        u32 bits = _dirty_objs.w[word];
+
+        while (bits != 0)
+        {
+            int first = __builtin_ctz(bits);
+            u32 run_bits = ~(bits >> first);
+            int end = run_bits == 0 ? BITSET_BITS_PER_WORD : first + __builtin_ctz(run_bits);
+            int obj_idx = word * BITSET_BITS_PER_WORD + first;
+
+            dma3_cpy(&oam_mem[obj_idx], &obj_buffer[obj_idx], (end - first) * sizeof(OBJ_ATTR));
+
+            // Clear the run, the bits past the end of the word are all 0
+            bits = end == BITSET_BITS_PER_WORD ? 0 : bits & ~((1u << end) - 1);
+        }
+    }
+
+    bitset_clear(&_dirty_objs);
+
+    for (int pb = 0; pb < NUM_PALETTES; pb++)
+    {
+        if (_queued_palettes[pb] != NULL)
+        {
+            memcpy16(&pal_obj_bank[pb], _queued_palettes[pb], PAL_ROW_LEN);
+            _queued_palettes[pb] = NULL;
+        }
+    }
+}
+
+void sprite_queue_palette(int pb, const u16* palette)
+{
+    if (pb < 0 || pb >= NUM_PALETTES)
+        return;
+
+    // Only the last palette queued for a bank is copied
+    _queued_palettes[pb] = palette;
+}
+
+void sprite_mark_dirty(const Sprite* sprite)
+{
+    s_mark_obj_dirty(sprite->idx);
+}
+
+void sprite_hide(Sprite* sprite)
+{
+    obj_hide(sprite->obj);
+    sprite_mark_dirty(sprite);
+}
+
+void sprite_unhide(Sprite* sprite, u16 mode)
+{
+    obj_unhide(sprite->obj, mode);
+    sprite_mark_dirty(sprite);
+}
+
+void sprite_rotscale(Sprite* sprite, FIXED sx, FIXED sy, u16 alpha)
+{
+    obj_aff_rotscale(sprite->aff, sx, sy, alpha);
+    s_mark_affine_dirty(sprite->aff - obj_aff_buffer);
 }
 
 int sprite_get_pb(const Sprite* sprite)
@@ -155,6 +300,15 @@ int sprite_get_pb(const Sprite* sprite)
     return (sprite->obj->attr2 & ATTR2_PALBANK_MASK) >> ATTR2_PALBANK_SHIFT;
 }
 
+int sprite_get_tid(const Sprite* sprite)
+{
+    if (sprite == NULL)
+    {
+        return UNDEFINED;
+    }
+    return sprite->obj->attr2 & ATTR2_ID_MASK;
+}
+
 // SpriteObject methods
 SpriteObject* sprite_object_new()
 {
@@ -181,6 +335,7 @@ void sprite_object_set_sprite(SpriteObject* sprite_object, Sprite* sprite)
         return;
     sprite_destroy(&sprite_object->sprite); // Destroy the old sprite if it exists
     sprite_object->sprite = sprite;
+    sprite_object->settled = false; // The new sprite doesn't show the transform yet
 }
 
 void sprite_object_reset_transform(SpriteObject* sprite_object)
@@ -197,12 +352,54 @@ void sprite_object_reset_transform(SpriteObject* sprite_object)
     sprite_object->trotation = 0; // Target rotation
     sprite_object->rotation = 0;
     sprite_object->vrotation = 0;
+    sprite_object->settled = false;
+}
+
+// Rounded towards 0 like the division by 10 it replaces, so small velocities still die out
+static inline FIXED s_damp_velocity(FIXED velocity)
+{
+    return velocity >= 0 ? (velocity * VELOCITY_DAMPING) >> 8
+                         : -((-velocity * VELOCITY_DAMPING) >> 8);
+}
+
+// Whether an update would leave the SpriteObject and its sprite exactly as they are. The fields
+// are written directly by the game, so this compares them instead of relying on a wake up call.
+static inline bool s_sprite_object_is_settled(const SpriteObject* sprite_object)
+{
+    if (!sprite_object->settled)
+        return false;
+
+    if ((sprite_object->vx | sprite_object->vy | sprite_object->vscale |
+         sprite_object->vrotation) != 0)
+        return false;
+
+    if (sprite_object->x != sprite_object->settled_x ||
+        sprite_object->tx != sprite_object->settled_x ||
+        sprite_object->y != sprite_object->settled_y ||
+        sprite_object->ty != sprite_object->settled_y)
+        return false;
+
+    if (sprite_object->scale != sprite_object->settled_scale ||
+        sprite_object->tscale != sprite_object->settled_scale ||
+        sprite_object->rotation != sprite_object->settled_rotation ||
+        sprite_object->trotation != sprite_object->settled_rotation)
+        return false;
+
+    // The sprite itself can be moved with sprite_position()
+    const Sprite* sprite = sprite_object->sprite;
+    return sprite->pos.x == fx2int(sprite_object->settled_x) &&
+           sprite->pos.y == fx2int(sprite_object->settled_y);
 }
 
-void sprite_object_update(SpriteObject* sprite_object)
+IWRAM_CODE void sprite_object_update(SpriteObject* sprite_object)
 {
-    sprite_object->vx += ((sprite_object->tx - sprite_object->x) * get_game_speed()) / 8;
-    sprite_object->vy += ((sprite_object->ty - sprite_object->y) * get_game_speed()) / 8;
+    if (s_sprite_object_is_settled(sprite_object))
+        return;
+
+    int game_speed = get_game_speed();
+
+    sprite_object->vx += ((sprite_object->tx - sprite_object->x) * game_speed) / 8;
+    sprite_object->vy += ((sprite_object->ty - sprite_object->y) * game_speed) / 8;
 
     // Scale up the card when it's played
     sprite_object->vscale += (sprite_object->tscale - sprite_object->scale) / 8;
@@ -223,8 +420,8 @@ void sprite_object_update(SpriteObject* sprite_object)
     }
     else
     {
-        sprite_object->vx = (sprite_object->vx * 7) / 10;
-        sprite_object->vy = (sprite_object->vy * 7) / 10;
+        sprite_object->vx = s_damp_velocity(sprite_object->vx);
+        sprite_object->vy = s_damp_velocity(sprite_object->vy);
 
         sprite_object->x += sprite_object->vx;
         sprite_object->y += sprite_object->vy;
@@ -238,7 +435,7 @@ void sprite_object_update(SpriteObject* sprite_object)
     }
     else
     {
-        sprite_object->vscale = (sprite_object->vscale * 7) / 10;
+        sprite_object->vscale = s_damp_velocity(sprite_object->vscale);
         sprite_object->scale += sprite_object->vscale;
     }
 
@@ -251,18 +448,26 @@ void sprite_object_update(SpriteObject* sprite_object)
     }
     else
     {
-        sprite_object->vrotation = (sprite_object->vrotation * 7) / 10;
+        sprite_object->vrotation = s_damp_velocity(sprite_object->vrotation);
         sprite_object->rotation += sprite_object->vrotation;
     }
 
     // Apply rotation and scale to the sprite
-    obj_aff_rotscale(
-        sprite_object->sprite->aff,
+    sprite_rotscale(
+        sprite_object->sprite,
         sprite_object->scale,
         sprite_object->scale,
         -sprite_object->vx + sprite_object->rotation
     );
     sprite_position(sprite_object->sprite, fx2int(sprite_object->x), fx2int(sprite_object->y));
+
+    // With no velocity left everything is on its target, the next updates can be skipped
+    sprite_object->settled = (sprite_object->vx | sprite_object->vy | sprite_object->vscale |
+                              sprite_object->vrotation) == 0;
+    sprite_object->settled_x = sprite_object->x;
+    sprite_object->settled_y = sprite_object->y;
+    sprite_object->settled_scale = sprite_object->scale;
+    sprite_object->settled_rotation = sprite_object->rotation;
 }
 
 void sprite_object_shake(SpriteObject* sprite_object, mm_word sound_id)
@@ -0,0 +1,99 @@
+#include "tile_cache.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+void tile_cache_clear(TileCache* cache)
+{
+    memset(cache->slots, 0, cache->num_slots * sizeof(TileCacheSlot));
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    cache->clock = 0;
+}
+
+int tile_cache_acquire(TileCache* cache, int key, bool* upload)
+{
+    int free_slot = -1;
+
+    for (int i = 0; i < cache->num_slots; i++)
+    {
+        TileCacheSlot* slot = &cache->slots[i];
+
+        if (slot->loaded && slot->key == key)
+        {
+            slot->ref_count++;
+            slot->last_used = ++cache->clock;
+            cache->stats.hits++;
+            *upload = false;
+            return i;
+        }
+
+        // Slots that were never loaded have a last_used of 0, so they are used before evicting
+        if (slot->ref_count == 0 &&
+            (free_slot == -1 || slot->last_used < cache->slots[free_slot].last_used))
+        {
+            free_slot = i;
+        }
+    }
+
+    if (free_slot == -1)
+    {
+        cache->stats.failures++;
+        *upload = false;
+        return -1;
+    }
+
+    TileCacheSlot* slot = &cache->slots[free_slot];
+    if (slot->loaded)
+    {
+        cache->stats.evictions++;
+    }
+    cache->stats.misses++;
+
+    slot->loaded = true;
+    slot->key = key;
+    slot->ref_count = 1;
+    slot->last_used = ++cache->clock;
+
+    *upload = true;
+    return free_slot;
+}
+
+void tile_cache_release(TileCache* cache, int slot)
+{
+    if (slot < 0 || slot >= cache->num_slots || cache->slots[slot].ref_count == 0)
+        return;
+
+    cache->slots[slot].ref_count--;
+}
+
+int tile_cache_get_num_free(const TileCache* cache)
+{
+    int num_free = 0;
+
+    for (int i = 0; i < cache->num_slots; i++)
+    {
+        if (cache->slots[i].ref_count == 0)
+        {
+            num_free++;
+        }
+    }
+
+    return num_free;
+}
+
+int tile_cache_get_largest_free_run(const TileCache* cache)
+{
+    int largest_run = 0;
+    int run = 0;
+
+    for (int i = 0; i < cache->num_slots; i++)
+    {
+        run = (cache->slots[i].ref_count == 0) ? run + 1 : 0;
+        if (run > largest_run)
+        {
+            largest_run = run;
+        }
+    }
+
+    return largest_run;
+}
@@ -0,0 +1,124 @@
+#include "timeline.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+// Frames at normal speed to frames at the speed of the timeline, like FRAMES() in game.h
+static inline uint32_t s_timeline_scale(const Timeline* timeline, uint32_t frames)
+{
+    return (frames + timeline->speed - 1) / timeline->speed;
+}
+
+static void s_timeline_update_next_due(Timeline* timeline)
+{
+    timeline->next_due = TIMELINE_NEVER;
+
+    for (int i = 0; i < TIMELINE_MAX_TRACKS; i++)
+    {
+        const TimelineTrack* track = &timeline->tracks[i];
+        if (track->steps != NULL && track->due < timeline->next_due)
+        {
+            timeline->next_due = track->due;
+        }
+    }
+}
+
+static void s_timeline_track_start_step(Timeline* timeline, TimelineTrack* track)
+{
+    if (track->step >= track->num_steps)
+    {
+        track->steps = NULL;
+        return;
+    }
+
+    track->runs = 0;
+    track->due = timeline->frame + s_timeline_scale(timeline, track->steps[track->step].delay);
+}
+
+static void s_timeline_track_run(Timeline* timeline, TimelineTrack* track)
+{
+    const TimelineStep* step = &track->steps[track->step];
+    uint32_t starts = track->starts;
+
+    bool done = step->action != NULL && step->action(track->runs);
+
+    // The action started another sequence on this track, it goes on from there
+    if (track->starts != starts)
+        return;
+
+    track->runs++;
+
+    if (!done && (step->runs == TIMELINE_UNTIL_DONE || track->runs < step->runs))
+    {
+        // At least one frame, the action would run forever otherwise
+        uint32_t interval = s_timeline_scale(timeline, step->interval);
+        track->due = timeline->frame + (interval > 0 ? interval : 1);
+        return;
+    }
+
+    track->step++;
+    s_timeline_track_start_step(timeline, track);
+}
+
+void timeline_init(Timeline* timeline, int speed)
+{
+    memset(timeline->tracks, 0, sizeof(timeline->tracks));
+    timeline->frame = 0;
+    timeline->next_due = TIMELINE_NEVER;
+    timeline->speed = speed;
+}
+
+void timeline_set_speed(Timeline* timeline, int speed)
+{
+    for (int i = 0; i < TIMELINE_MAX_TRACKS; i++)
+    {
+        TimelineTrack* track = &timeline->tracks[i];
+        if (track->steps == NULL)
+            continue;
+
+        uint32_t remaining = track->due - timeline->frame;
+        track->due = timeline->frame + (remaining * timeline->speed + speed - 1) / speed;
+    }
+
+    timeline->speed = speed;
+    s_timeline_update_next_due(timeline);
+}
+
+void timeline_start_track(Timeline* timeline, int track, const TimelineStep* steps, int num_steps)
+{
+    TimelineTrack* timeline_track = &timeline->tracks[track];
+
+    timeline_track->steps = steps;
+    timeline_track->num_steps = num_steps;
+    timeline_track->step = 0;
+    timeline_track->starts++;
+    s_timeline_track_start_step(timeline, timeline_track);
+
+    if (timeline_track->steps != NULL && timeline_track->due < timeline->next_due)
+    {
+        timeline->next_due = timeline_track->due;
+    }
+}
+
+bool timeline_is_done(const Timeline* timeline)
+{
+    return timeline->next_due == TIMELINE_NEVER;
+}
+
+void timeline_run_due(Timeline* timeline)
+{
+    // Actions can start sequences that are already due, go over the tracks until none is
+    do
+    {
+        for (int i = 0; i < TIMELINE_MAX_TRACKS; i++)
+        {
+            TimelineTrack* track = &timeline->tracks[i];
+            while (track->steps != NULL && track->due <= timeline->frame)
+            {
+                s_timeline_track_run(timeline, track);
+            }
+        }
+
+        s_timeline_update_next_due(timeline);
+    } while (timeline->next_due <= timeline->frame);
+}
@@ -0,0 +1,146 @@
+#include "vector.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+void vector_clear(Vector* vector)
+{
+    vector->len = 0;
+}
+
+bool vector_is_empty(const Vector* vector)
+{
+    return vector->len == 0;
+}
+
+bool vector_is_full(const Vector* vector)
+{
+    return vector->len >= vector->cap;
+}
+
+bool vector_push_front(Vector* vector, void* data)
+{
+    return vector_insert(vector, data, 0);
+}
+
+bool vector_push_back(Vector* vector, void* data)
+{
+    if (vector_is_full(vector))
+        return false;
+
+    vector->data[vector->len++] = data;
+    return true;
+}
+
+bool vector_insert(Vector* vector, void* data, unsigned int idx)
+{
+    if (idx >= vector->len)
+        return vector_push_back(vector, data);
+
+    if (vector_is_full(vector))
+        return false;
+
+    memmove(&vector->data[idx + 1], &vector->data[idx], (vector->len - idx) * sizeof(void*));
+    vector->data[idx] = data;
+    vector->len++;
+
+    return true;
+}
+
+bool vector_swap(Vector* vector, unsigned int idx_a, unsigned int idx_b)
+{
+    if (idx_a >= vector->len || idx_b >= vector->len)
+        return false;
+
+    void* tmp = vector->data[idx_a];
+    vector->data[idx_a] = vector->data[idx_b];
+    vector->data[idx_b] = tmp;
+
+    return true;
+}
+
+void* vector_get_at_idx(const Vector* vector, unsigned int idx)
+{
+    if (idx >= vector->len)
+        return NULL;
+
+    return vector->data[idx];
+}
+
+bool vector_remove_at_idx(Vector* vector, unsigned int idx)
+{
+    if (idx >= vector->len)
+        return false;
+
+    vector->len--;
+    memmove(&vector->data[idx], &vector->data[idx + 1], (vector->len - idx) * sizeof(void*));
+
+    return true;
+}
+
+int vector_find(const Vector* vector, const void* data)
+{
+    for (int i = 0; i < vector->len; i++)
+    {
+        if (vector->data[i] == data)
+            return i;
+    }
+
+    return -1;
+}
+
+int vector_get_len(const Vector* vector)
+{
+    return vector->len;
+}
+
+VectorItr vector_itr_create(Vector* vector)
+{
+    VectorItr itr = {
+        .vector = vector,
+        .next_idx = 0,
+        .current_idx = -1,
+        .direction = VECTOR_ITR_FORWARD,
+    };
+
+    return itr;
+}
+
+VectorItr rev_vector_itr_create(Vector* vector)
+{
+    VectorItr itr = {
+        .vector = vector,
+        .next_idx = vector->len - 1,
+        .current_idx = -1,
+        .direction = VECTOR_ITR_REVERSE,
+    };
+
+    return itr;
+}
+
+void* vector_itr_next(VectorItr* itr)
+{
+    if (itr->next_idx < 0 || itr->next_idx >= itr->vector->len)
+        return NULL;
+
+    itr->current_idx = itr->next_idx;
+    itr->next_idx += (itr->direction == VECTOR_ITR_FORWARD) ? 1 : -1;
+
+    return itr->vector->data[itr->current_idx];
+}
+
+void vector_itr_remove_current(VectorItr* itr)
+{
+    if (!itr || itr->current_idx < 0)
+        return;
+
+    vector_remove_at_idx(itr->vector, itr->current_idx);
+
+    // The entries after the removed one moved down, only a forward iterator has to follow them
+    if (itr->direction == VECTOR_ITR_FORWARD)
+    {
+        itr->next_idx--;
+    }
+
+    itr->current_idx = -1;
+}
@@ -0,0 +1,130 @@
+// Checks the sin_lut based wave of the main menu background against the lu_sin() and
+// bg_rotscale_ex() implementation it replaced, for every frame of a full animation cycle.
+// Built against the tonc shim of the host build (host/include), any sin_lut gives the same results.
+#include "affine_wave.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+static BG_AFFINE expected[AFFINE_WAVE_ARR_LEN];
+static BG_AFFINE actual[AFFINE_WAVE_ARR_LEN];
+
+// s_affine_background_prep_bgaff_arr() of affine_background.c before the sin_lut based wave
+static void reference_prep_bgaff_arr(BG_AFFINE* bgaff_arr, uint timer)
+{
+    AFF_SRC_EX asx = {0};
+
+    for (u16 vcount = 0; vcount < SCREEN_HEIGHT; vcount++)
+    {
+        const s32 timer_s32 = timer << 8;
+        const s32 vcount_s32 = vcount << 8;
+        const s16 vcount_s16 = vcount;
+        const s32 vcount_sine = lu_sin(vcount_s32 + timer_s32 / AFFINE_WAVE_SPEED_DIVISOR);
+
+        asx.scr_x = (SCREEN_WIDTH / 2);
+        asx.scr_y = vcount_s16 - (SCREEN_HEIGHT / 2);
+        asx.tex_x = (1000 * 1000) + (vcount_sine);
+        asx.tex_y = (1000 * 1000);
+        asx.sx = 128;
+        asx.sy = 128;
+        asx.alpha = vcount_sine + (timer_s32 / AFFINE_WAVE_SPEED_DIVISOR);
+
+        bg_rotscale_ex(&bgaff_arr[vcount], &asx);
+    }
+
+    bgaff_arr[SCREEN_HEIGHT] = bgaff_arr[0];
+}
+
+static void check_frame(uint timer)
+{
+    reference_prep_bgaff_arr(expected, timer);
+    affine_wave_prep_bgaff_arr(actual, timer);
+
+    for (int vcount = 0; vcount < AFFINE_WAVE_ARR_LEN; vcount++)
+    {
+        const BG_AFFINE* e = &expected[vcount];
+        const BG_AFFINE* a = &actual[vcount];
+        if (memcmp(e, a, sizeof(BG_AFFINE)) != 0)
+        {
+            printf(
+                "Mismatch at timer %u, vcount %d: expected {%d %d %d %d %d %d}, "
+                "got {%d %d %d %d %d %d}\n",
+                timer,
+                vcount,
+                e->pa,
+                e->pb,
+                e->pc,
+                e->pd,
+                e->dx,
+                e->dy,
+                a->pa,
+                a->pb,
+                a->pc,
+                a->pd,
+                a->dx,
+                a->dy
+            );
+        }
+        assert(memcmp(e, a, sizeof(BG_AFFINE)) == 0);
+    }
+
+    // The texture offset of the last scanline, the low quality mode scrolls on from it
+    const s32 timer_s32 = timer << 8;
+    s32 offset = affine_wave_get_offset(timer, SCREEN_HEIGHT - 1);
+    assert(offset == lu_sin(((SCREEN_HEIGHT - 1) << 8) + timer_s32 / AFFINE_WAVE_SPEED_DIVISOR));
+}
+
+// Every frame of the animation
+void test_full_cycle(void)
+{
+    for (uint timer = 0; timer < AFFINE_WAVE_PERIOD; timer++)
+    {
+        check_frame(timer);
+    }
+}
+
+// The wave repeats after AFFINE_WAVE_PERIOD frames
+void test_period(void)
+{
+    static BG_AFFINE next_cycle[AFFINE_WAVE_ARR_LEN];
+
+    for (uint timer = 0; timer < AFFINE_WAVE_PERIOD; timer += 7)
+    {
+        affine_wave_prep_bgaff_arr(actual, timer);
+        affine_wave_prep_bgaff_arr(next_cycle, timer + AFFINE_WAVE_PERIOD);
+        assert(memcmp(actual, next_cycle, sizeof(actual)) == 0);
+    }
+}
+
+// timer << 8 overflows an s32 after 2^23 frames, the negative angles must match too
+void test_timer_overflow(void)
+{
+    const uint starts[] = {(1u << 23) - AFFINE_WAVE_PERIOD, 0xFFFFFFFFu - AFFINE_WAVE_PERIOD};
+
+    for (int i = 0; i < sizeof(starts) / sizeof(starts[0]); i++)
+    {
+        for (uint timer = starts[i]; timer - starts[i] <= 2 * AFFINE_WAVE_PERIOD; timer++)
+        {
+            check_frame(timer);
+        }
+    }
+}
+
+int main(void)
+{
+    printf("Testing Affine Wave Full Cycle.\n");
+    test_full_cycle();
+
+    printf("Testing Affine Wave Period.\n");
+    test_period();
+
+    printf("Testing Affine Wave Timer Overflow.\n");
+    test_timer_overflow();
+
+    printf("-------------------------------------------------------------------------------\n");
+    printf("Affine Wave Tests Passed :)\n");
+    printf("-------------------------------------------------------------------------------\n");
+
+    return 0;
+}
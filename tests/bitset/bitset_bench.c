@@ -0,0 +1,242 @@
+// Compares the bitset operations with the implementations they replaced, which always used
+// BITSET_ARRAY_SIZE words and went through the words a bit at a time.
+// Times are host nanoseconds per call, they only give the ratio between the implementations.
+#include "bitset.h"
+#include "util.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// The capacities of the Joker availability bitset and of a small pool
+#define JOKERS_CAPACITY 150
+#define POOL_CAPACITY   13
+#define ITERATIONS      200000
+
+BITSET_DEFINE(jokers_bitset, JOKERS_CAPACITY)
+BITSET_DEFINE(sparse_bitset, JOKERS_CAPACITY)
+BITSET_DEFINE(pool_bitset, POOL_CAPACITY)
+
+// The same bitsets as defined before, with all the words
+static uint32_t reference_jokers_w[BITSET_ARRAY_SIZE];
+static Bitset reference_jokers_bitset = {
+    .w = reference_jokers_w,
+    .nbits = BITSET_BITS_PER_WORD,
+    .nwords = BITSET_ARRAY_SIZE,
+    .cap = JOKERS_CAPACITY,
+};
+
+static uint32_t reference_sparse_w[BITSET_ARRAY_SIZE];
+static Bitset reference_sparse_bitset = {
+    .w = reference_sparse_w,
+    .nbits = BITSET_BITS_PER_WORD,
+    .nwords = BITSET_ARRAY_SIZE,
+    .cap = JOKERS_CAPACITY,
+};
+
+static uint32_t reference_pool_w[BITSET_ARRAY_SIZE];
+static Bitset reference_pool_bitset = {
+    .w = reference_pool_w,
+    .nbits = BITSET_BITS_PER_WORD,
+    .nwords = BITSET_ARRAY_SIZE,
+    .cap = POOL_CAPACITY,
+};
+
+// Keeps the compiler from dropping the calls
+static volatile int sink;
+
+static double s_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+typedef struct
+{
+    const Bitset* bitset;
+    int word;
+    int bit;
+    int itr;
+} ReferenceBitsetItr;
+
+// Not inlined, like bitset_itr_next() which is in another translation unit
+__attribute__((noinline)) static int s_reference_itr_next(ReferenceBitsetItr* itr)
+{
+    for (; itr->word < itr->bitset->nwords; itr->word++)
+    {
+        for (; itr->bit < itr->bitset->nbits; itr->bit++)
+        {
+            itr->itr++;
+            if (itr->bitset->w[itr->word] & (1 << itr->bit))
+            {
+                itr->bit++;
+                return itr->itr - 1;
+            }
+        }
+        itr->bit = 0;
+    }
+    itr->word = 0;
+
+    return UNDEFINED;
+}
+
+static int s_reference_itr_count(const Bitset* bitset)
+{
+    ReferenceBitsetItr itr = {.bitset = bitset};
+    int count = 0;
+
+    while (s_reference_itr_next(&itr) != UNDEFINED)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+__attribute__((noinline)) static int s_reference_find_idx_of_nth_set(const Bitset* bitset, int n)
+{
+    int tracker = 0;
+    int prev_tracker = 0;
+
+    for (int i = 0; i < bitset->nwords; i++)
+    {
+        tracker += __builtin_popcount(bitset->w[i]);
+
+        if (tracker > n)
+        {
+            int base = prev_tracker - 1;
+            int offset = bitset->nbits * i;
+            for (int j = 0; j < bitset->nbits; j++)
+            {
+                if (base == n)
+                {
+                    return offset - 1;
+                }
+                base += (bitset->w[i] >> j) & 0x01;
+                offset++;
+            }
+
+            break;
+        }
+
+        prev_tracker = tracker;
+    }
+
+    return UNDEFINED;
+}
+
+static int s_itr_count(const Bitset* bitset)
+{
+    BitsetItr itr = bitset_itr_create(bitset);
+    int count = 0;
+
+    while (bitset_itr_next(&itr) != UNDEFINED)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+static void s_print_result(const char* name, double reference_ns, double new_ns)
+{
+    printf(
+        "%-24s reference %8.1f ns   new %8.1f ns   x%.2f\n",
+        name,
+        reference_ns / ITERATIONS,
+        new_ns / ITERATIONS,
+        reference_ns / new_ns
+    );
+}
+
+static void s_bench_iteration(const char* name, const Bitset* reference, const Bitset* bitset)
+{
+    double start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        sink = s_reference_itr_count(reference);
+    }
+    double reference_ns = s_now_ns() - start;
+
+    start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        sink = s_itr_count(bitset);
+    }
+    double new_ns = s_now_ns() - start;
+
+    s_print_result(name, reference_ns, new_ns);
+}
+
+static void s_bench_find_idx_of_nth_set(void)
+{
+    int num_set = bitset_num_set_bits(&jokers_bitset);
+
+    double start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        sink = s_reference_find_idx_of_nth_set(&reference_jokers_bitset, i % num_set);
+    }
+    double reference_ns = s_now_ns() - start;
+
+    start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        sink = bitset_find_idx_of_nth_set(&jokers_bitset, i % num_set);
+    }
+    double new_ns = s_now_ns() - start;
+
+    s_print_result("find nth set", reference_ns, new_ns);
+}
+
+static void s_bench_num_set_bits(void)
+{
+    double start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        sink = bitset_num_set_bits(&reference_pool_bitset);
+    }
+    double reference_ns = s_now_ns() - start;
+
+    start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        sink = bitset_num_set_bits(&pool_bitset);
+    }
+    double new_ns = s_now_ns() - start;
+
+    s_print_result("pool num set bits", reference_ns, new_ns);
+}
+
+int main(void)
+{
+    // Roughly the shop's Joker availability after buying some of them
+    srand(1);
+    for (int i = 0; i < JOKERS_CAPACITY; i++)
+    {
+        bool avail = rand() % 4 != 0;
+        bitset_set_idx(&jokers_bitset, i, avail);
+        bitset_set_idx(&reference_jokers_bitset, i, avail);
+    }
+
+    // A few bits spread over the words
+    for (int i = 0; i < JOKERS_CAPACITY; i += 37)
+    {
+        bitset_set_idx(&sparse_bitset, i, true);
+        bitset_set_idx(&reference_sparse_bitset, i, true);
+    }
+
+    for (int i = 0; i < POOL_CAPACITY / 2; i++)
+    {
+        bitset_set_next_free_idx(&pool_bitset);
+        bitset_set_next_free_idx(&reference_pool_bitset);
+    }
+
+    s_bench_iteration("iterate dense bits", &reference_jokers_bitset, &jokers_bitset);
+    s_bench_iteration("iterate sparse bits", &reference_sparse_bitset, &sparse_bitset);
+    s_bench_find_idx_of_nth_set();
+    s_bench_num_set_bits();
+
+    return 0;
+}
@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 BITSET_DEFINE(test_bitset, BITSET_MAX_BITS)
 
@@ -105,6 +106,161 @@ void test_bitset_iterator(void)
     assert(bitset_is_empty(&test_bitset));
 }
 
+// bitset_itr_create_reverse
+// bitset_itr_create_unset
+// bitset_itr_next
+void test_bitset_reverse_and_unset_iterators(void)
+{
+    assert(bitset_is_empty(&test_bitset));
+
+    int test_indices[6] = {0, 31, 32, 63, 64, BITSET_MAX_BITS - 1};
+
+    for (int i = 0; i < 6; i++)
+    {
+        bitset_set_idx(&test_bitset, test_indices[i], true);
+    }
+
+    BitsetItr itr = bitset_itr_create_reverse(&test_bitset);
+
+    int test_val = UNDEFINED;
+    int index = 6;
+    while ((test_val = bitset_itr_next(&itr)) != UNDEFINED)
+    {
+        assert(test_val == test_indices[--index]);
+    }
+
+    assert(index == 0);
+    // an exhausted iterator stays exhausted
+    assert(bitset_itr_next(&itr) == UNDEFINED);
+
+    itr = bitset_itr_create_unset(&test_bitset);
+
+    int expected = 0;
+    index = 0;
+    while ((test_val = bitset_itr_next(&itr)) != UNDEFINED)
+    {
+        while (index < 6 && test_indices[index] == expected)
+        {
+            expected++;
+            index++;
+        }
+        assert(test_val == expected++);
+    }
+
+    assert(expected == BITSET_MAX_BITS - 1);
+
+    bitset_clear(&test_bitset);
+
+    assert(bitset_is_empty(&test_bitset));
+}
+
+BITSET_DEFINE(small_bitset, 13)
+
+// BITSET_DEFINE
+// bitset_set_next_free_idx
+// bitset_num_set_bits
+// bitset_itr_create_unset
+void test_bitset_capacity(void)
+{
+    assert(small_bitset.nwords == 1);
+    assert(sizeof(small_bitset_w) == sizeof(uint32_t));
+    assert(test_bitset.nwords == BITSET_ARRAY_SIZE);
+
+    for (int i = 0; i < 13; i++)
+    {
+        assert(bitset_set_next_free_idx(&small_bitset) == i);
+    }
+
+    // full, the bits past the capacity must not be used
+    assert(bitset_set_next_free_idx(&small_bitset) == UNDEFINED);
+    assert(bitset_num_set_bits(&small_bitset) == 13);
+
+    BitsetItr itr = bitset_itr_create_unset(&small_bitset);
+    assert(bitset_itr_next(&itr) == UNDEFINED);
+
+    bitset_set_idx(&small_bitset, 5, false);
+
+    itr = bitset_itr_create_unset(&small_bitset);
+    assert(bitset_itr_next(&itr) == 5);
+    assert(bitset_itr_next(&itr) == UNDEFINED);
+
+    bitset_clear(&small_bitset);
+
+    assert(bitset_is_empty(&small_bitset));
+}
+
+BITSET_DEFINE(other_bitset, BITSET_MAX_BITS)
+
+// bitset_or
+// bitset_and
+// bitset_andnot
+void test_bitset_bulk_operations(void)
+{
+    assert(bitset_is_empty(&test_bitset));
+
+    // test_bitset has the multiples of 2, other_bitset the multiples of 3
+    for (int i = 0; i < BITSET_MAX_BITS; i++)
+    {
+        bitset_set_idx(&test_bitset, i, i % 2 == 0);
+        bitset_set_idx(&other_bitset, i, i % 3 == 0);
+    }
+
+    bitset_and(&test_bitset, &other_bitset);
+    for (int i = 0; i < BITSET_MAX_BITS; i++)
+    {
+        assert(bitset_get_idx(&test_bitset, i) == (i % 6 == 0));
+    }
+
+    bitset_andnot(&other_bitset, &test_bitset);
+    for (int i = 0; i < BITSET_MAX_BITS; i++)
+    {
+        assert(bitset_get_idx(&other_bitset, i) == (i % 3 == 0 && i % 6 != 0));
+    }
+
+    bitset_or(&test_bitset, &other_bitset);
+    for (int i = 0; i < BITSET_MAX_BITS; i++)
+    {
+        assert(bitset_get_idx(&test_bitset, i) == (i % 3 == 0));
+    }
+
+    bitset_clear(&test_bitset);
+    bitset_clear(&other_bitset);
+
+    assert(bitset_is_empty(&test_bitset));
+}
+
+// bitset_find_idx_of_nth_set
+void test_bitset_find_idx_of_nth_set(void)
+{
+    assert(bitset_is_empty(&test_bitset));
+
+    srand(1);
+
+    for (int round = 0; round < 100; round++)
+    {
+        for (int i = 0; i < BITSET_MAX_BITS; i++)
+        {
+            bitset_set_idx(&test_bitset, i, rand() % (round % 8 + 2) == 0);
+        }
+
+        int n = 0;
+        for (int i = 0; i < BITSET_MAX_BITS; i++)
+        {
+            if (bitset_get_idx(&test_bitset, i))
+            {
+                assert(bitset_find_idx_of_nth_set(&test_bitset, n++) == i);
+            }
+        }
+
+        assert(n == bitset_num_set_bits(&test_bitset));
+        assert(bitset_find_idx_of_nth_set(&test_bitset, n) == UNDEFINED);
+    }
+
+    bitset_clear(&test_bitset);
+
+    assert(bitset_is_empty(&test_bitset));
+}
+
 int main(void)
 {
     printf("Testing Bitset Fill All and Empty.\n");
@@ -113,6 +269,14 @@ int main(void)
     test_bitset_insertions_at_boundry();
     printf("Testing Bitset Iterator.\n");
     test_bitset_iterator();
+    printf("Testing Bitset Reverse and Unset Iterators.\n");
+    test_bitset_reverse_and_unset_iterators();
+    printf("Testing Bitset Capacity.\n");
+    test_bitset_capacity();
+    printf("Testing Bitset Bulk Operations.\n");
+    test_bitset_bulk_operations();
+    printf("Testing Bitset Find Index of Nth Set.\n");
+    test_bitset_find_idx_of_nth_set();
 
     printf("-------------------------------------------------------------------------------\n");
     printf("Bitset Tests Passed :)\n");
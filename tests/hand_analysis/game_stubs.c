@@ -0,0 +1,15 @@
+// Stubs for the game.h functions hand_analysis.c depends on
+#include "hand_analysis_reference.h"
+
+bool stub_shortcut_active = false;
+int stub_straight_and_flush_size = STRAIGHT_AND_FLUSH_SIZE_DEFAULT;
+
+bool is_shortcut_joker_active(void)
+{
+    return stub_shortcut_active;
+}
+
+int get_straight_and_flush_size(void)
+{
+    return stub_straight_and_flush_size;
+}
@@ -0,0 +1,125 @@
+// Compares the rank mask hand analysis with the reference implementations on random 5 card hands.
+// Times are host nanoseconds per call, they only give the ratio between the implementations.
+#include "hand_analysis_reference.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DECK_SIZE  (NUM_RANKS * NUM_SUITS)
+#define NUM_HANDS  4096
+#define ITERATIONS 200
+
+typedef struct
+{
+    CardObject* played[MAX_SELECTION_SIZE];
+    u8 ranks[NUM_RANKS];
+    u8 suits[NUM_SUITS];
+    u16 rank_mask;
+} BenchHand;
+
+static Card cards[DECK_SIZE];
+static CardObject card_objects[DECK_SIZE];
+static BenchHand hands[NUM_HANDS];
+
+// Keeps the compiler from dropping the calls
+static volatile int sink;
+
+static double s_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void s_deal_hands(void)
+{
+    for (int i = 0; i < DECK_SIZE; i++)
+    {
+        cards[i] = (Card){.suit = i / NUM_RANKS, .rank = i % NUM_RANKS};
+        card_objects[i] = (CardObject){.card = &cards[i]};
+    }
+
+    srand(1);
+    for (int h = 0; h < NUM_HANDS; h++)
+    {
+        bool dealt[DECK_SIZE] = {false};
+        for (int i = 0; i < MAX_SELECTION_SIZE; i++)
+        {
+            int card;
+            do
+            {
+                card = rand() % DECK_SIZE;
+            } while (dealt[card]);
+            dealt[card] = true;
+
+            hands[h].played[i] = &card_objects[card];
+            hands[h].ranks[cards[card].rank]++;
+            hands[h].suits[cards[card].suit]++;
+            hands[h].rank_mask |= 1 << cards[card].rank;
+        }
+    }
+}
+
+#define BENCH(name, call)                                                                          \
+    ({                                                                                             \
+        double start = s_now_ns();                                                                 \
+        for (int iteration = 0; iteration < ITERATIONS; iteration++)                               \
+        {                                                                                          \
+            for (int h = 0; h < NUM_HANDS; h++)                                                    \
+            {                                                                                      \
+                BenchHand* hand = &hands[h];                                                       \
+                sink += (call);                                                                    \
+            }                                                                                      \
+        }                                                                                          \
+        double ns = (s_now_ns() - start) / ((double)ITERATIONS * NUM_HANDS);                       \
+        printf("  %-12s %8.2f ns/call\n", name, ns);                                               \
+        ns;                                                                                        \
+    })
+
+static void s_compare(const char* name, double reference_ns, double current_ns)
+{
+    printf("%s: %.2fx\n\n", name, reference_ns / current_ns);
+}
+
+int main()
+{
+    s_deal_hands();
+
+    bool selection[MAX_SELECTION_SIZE];
+    int top = MAX_SELECTION_SIZE - 1;
+
+    for (int shortcut = 0; shortcut <= 1; shortcut++)
+    {
+        stub_shortcut_active = shortcut;
+        printf("Shortcut %s\n", shortcut ? "active" : "inactive");
+
+        double reference_ns =
+            BENCH("reference", reference_hand_contains_straight(hand->ranks));
+        double current_ns = BENCH("rank masks", hand_contains_straight(hand->rank_mask));
+        s_compare("hand_contains_straight", reference_ns, current_ns);
+
+        reference_ns = BENCH(
+            "reference",
+            reference_find_straight_in_played_cards(hand->played, top, shortcut, 1, selection)
+        );
+        current_ns = BENCH(
+            "rank masks",
+            find_straight_in_played_cards(hand->played, top, shortcut, 1, selection)
+        );
+        s_compare("find_straight_in_played_cards", reference_ns, current_ns);
+    }
+
+    double reference_ns = BENCH(
+        "reference",
+        reference_find_flush_in_played_cards(hand->played, top, 1, selection)
+    );
+    double current_ns =
+        BENCH("rank masks", find_flush_in_played_cards(hand->played, top, 1, selection));
+    s_compare("find_flush_in_played_cards", reference_ns, current_ns);
+
+    reference_ns = BENCH("reference", reference_hand_get_type(hand->ranks, hand->suits));
+    current_ns = BENCH("lookup", hand_get_type_from_distribution(hand->ranks, hand->suits));
+    s_compare("hand_get_type_from_distribution", reference_ns, current_ns);
+
+    return 0;
+}
@@ -0,0 +1,378 @@
+// Copies of the hand_analysis.c implementations replaced by lookup tables and rank masks, the
+// tests check the current implementations against them and the benchmark compares their speed
+#include "hand_analysis_reference.h"
+
+// The implementation of hand_get_type_from_distribution() before the lookup tables
+enum HandType reference_hand_get_type(u8* ranks, u8* suits)
+{
+    enum HandType res_hand_type = HIGH_CARD;
+
+    if (hand_contains_flush(suits))
+        res_hand_type = FLUSH;
+
+    if (reference_hand_contains_straight(ranks))
+    {
+        if (res_hand_type == FLUSH)
+            res_hand_type = STRAIGHT_FLUSH;
+        else
+            res_hand_type = STRAIGHT;
+    }
+
+    u8 n_of_a_kind = hand_contains_n_of_a_kind(ranks);
+
+    if (n_of_a_kind >= 5)
+    {
+        if (res_hand_type == FLUSH)
+        {
+            return FLUSH_FIVE;
+        }
+        return FIVE_OF_A_KIND;
+    }
+
+    if (res_hand_type == STRAIGHT_FLUSH)
+    {
+        if (ranks[TEN] && ranks[JACK] && ranks[QUEEN] && ranks[KING] && ranks[ACE])
+            return ROYAL_FLUSH;
+        return STRAIGHT_FLUSH;
+    }
+
+    if (n_of_a_kind == 4)
+    {
+        return FOUR_OF_A_KIND;
+    }
+
+    if (n_of_a_kind == 3 && hand_contains_full_house(ranks))
+    {
+        return FULL_HOUSE;
+    }
+
+    if (res_hand_type == FLUSH)
+    {
+        if (n_of_a_kind >= 5)
+        {
+            return FLUSH_HOUSE;
+        }
+        return FLUSH;
+    }
+    if (res_hand_type == STRAIGHT)
+    {
+        return STRAIGHT;
+    }
+
+    if (n_of_a_kind == 3)
+    {
+        return THREE_OF_A_KIND;
+    }
+
+    if (n_of_a_kind == 2)
+    {
+        if (hand_contains_two_pair(ranks))
+        {
+            return TWO_PAIR;
+        }
+        return PAIR;
+    }
+
+    return res_hand_type;
+}
+
+bool reference_hand_contains_straight(u8* ranks)
+{
+    if (!is_shortcut_joker_active())
+    {
+        int straight_size = get_straight_and_flush_size();
+        // This is the regular case of detecting straights
+        int run = 0;
+        for (int i = 0; i < NUM_RANKS; ++i)
+        {
+            if (ranks[i])
+            {
+                if (++run >= straight_size)
+                    return true;
+            }
+            else
+            {
+                run = 0;
+            }
+        }
+
+        // Check for ace low straight
+        if (straight_size >= 2 && ranks[ACE])
+        {
+            // With A as low, the highest rank you can use is FIVE.
+            // -1 for inclusive integer distance and another -1 for the Ace e.g. need=5 -> need 2..5
+            int last_needed = TWO + (straight_size - 2);
+            if (last_needed <= FIVE)
+            {
+                bool ok = true;
+                for (int r = TWO; r <= last_needed; ++r)
+                {
+                    if (!ranks[r])
+                    {
+                        ok = false;
+                        break;
+                    }
+                }
+                if (ok)
+                    return true;
+            }
+        }
+
+        return false;
+    }
+    else
+    {
+        // Shortcut Joker is active, we have to detect straights where any card may "skip" 1 rank
+        // We do this with a dynamic programming algorithm that calculates
+        // the longest possible straight that can end on each rank
+        // and stopping when we find one that is {straight-size} cards long
+        u8 longest_short_cut_at[NUM_RANKS] = {0};
+
+        // A low ace can start a sequence. 'ace_low_len' is 1 if an ace is present,
+        // acting as a potential predecessor for TWO and THREE.
+        int ace_low_len = ranks[ACE] ? 1 : 0;
+
+        // Iterate through all ranks from TWO up to ACE.
+        for (int i = 0; i < NUM_RANKS; i++)
+        {
+            // No cards in this rank, no straight can end here, continue
+            if (ranks[i] == 0)
+            {
+                longest_short_cut_at[i] = 0;
+                continue;
+            }
+
+            int prev_len1 = 0;
+            int prev_len2 = 0;
+
+            // This logic handles the special connections for ace-low straights.
+            if (i == TWO)
+            {
+                // A TWO can be preceded by a low ACE (no skip).
+                prev_len1 = ace_low_len;
+            }
+            else if (i == THREE)
+            {
+                // A THREE can be preceded by a TWO (no skip) or a low ACE (skip).
+                prev_len1 = longest_short_cut_at[TWO];
+                prev_len2 = ace_low_len;
+            }
+            else if (i == ACE)
+            {
+                // An ACE (as the highest card) can be preceded by a KING or a QUEEN.
+                prev_len1 = longest_short_cut_at[KING];
+                prev_len2 = longest_short_cut_at[QUEEN];
+            }
+            else // For all other cards (FOUR through KING).
+            {
+                // A card can be preceded by the rank directly below or two ranks below.
+                prev_len1 = longest_short_cut_at[i - 1];
+                prev_len2 = longest_short_cut_at[i - 2];
+            }
+
+            // The length of the straight ending at rank 'i' is 1 (for the card itself)
+            // plus the length of the longest valid preceding straight.
+            longest_short_cut_at[i] = 1 + max(prev_len1, prev_len2);
+
+            // If we've formed a sequence of {straight-size} or more cards, we have a straight.
+            if (longest_short_cut_at[i] >= get_straight_and_flush_size())
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+int reference_find_flush_in_played_cards(
+    CardObject** played,
+    int top,
+    int min_len,
+    bool* out_selection
+)
+{
+    if (top < 0)
+        return 0;
+    for (int i = 0; i <= top; i++)
+        out_selection[i] = false;
+
+    int suit_counts[NUM_SUITS] = {0};
+    for (int i = 0; i <= top; i++)
+    {
+        if (played[i] && played[i]->card)
+        {
+            suit_counts[played[i]->card->suit]++;
+        }
+    }
+
+    int best_suit = -1;
+    int best_count = 0;
+    for (int i = 0; i < NUM_SUITS; i++)
+    {
+        if (suit_counts[i] > best_count)
+        {
+            best_count = suit_counts[i];
+            best_suit = i;
+        }
+    }
+
+    if (best_count >= min_len)
+    {
+        for (int i = 0; i <= top; i++)
+        {
+            if (played[i] && played[i]->card && played[i]->card->suit == best_suit)
+            {
+                out_selection[i] = true;
+            }
+        }
+        return best_count;
+    }
+    return 0;
+}
+
+int reference_find_straight_in_played_cards(
+    CardObject** played,
+    int top,
+    bool shortcut_active,
+    int min_len,
+    bool* out_selection
+)
+{
+    if (top < 0)
+        return 0;
+    for (int i = 0; i <= top; i++)
+        out_selection[i] = false;
+
+    // --- Setup for Backtracking DP ---
+    u8 longest_straight_at[NUM_RANKS] = {0};
+    int parent[NUM_RANKS];
+    for (int i = 0; i < NUM_RANKS; i++)
+        parent[i] = -1;
+
+    u8 ranks[NUM_RANKS] = {0};
+    for (int i = 0; i <= top; i++)
+    {
+        if (played[i] && played[i]->card)
+        {
+            ranks[played[i]->card->rank]++;
+        }
+    }
+
+    // --- Run DP to find longest straight ---
+    int ace_low_len = ranks[ACE] ? 1 : 0;
+    for (int i = 0; i < NUM_RANKS; i++)
+    {
+        if (ranks[i] > 0)
+        {
+            int prev1 = 0, prev2 = 0;
+            int parent1 = -1, parent2 = -1;
+
+            if (shortcut_active)
+            {
+                if (i == TWO)
+                {
+                    prev1 = ace_low_len;
+                    parent1 = ACE;
+                }
+                else if (i == THREE)
+                {
+                    prev1 = longest_straight_at[TWO];
+                    parent1 = TWO;
+                    prev2 = ace_low_len;
+                    parent2 = ACE;
+                }
+                else if (i == ACE)
+                {
+                    prev1 = longest_straight_at[KING];
+                    parent1 = KING;
+                    prev2 = longest_straight_at[QUEEN];
+                    parent2 = QUEEN;
+                }
+                else
+                {
+                    prev1 = longest_straight_at[i - 1];
+                    parent1 = i - 1;
+                    if (i > 1)
+                    {
+                        prev2 = longest_straight_at[i - 2];
+                        parent2 = i - 2;
+                    }
+                }
+            }
+            else
+            {
+                if (i == TWO)
+                {
+                    prev1 = ace_low_len;
+                    parent1 = ACE;
+                }
+                else if (i == ACE)
+                {
+                    prev1 = longest_straight_at[KING];
+                    parent1 = KING;
+                }
+                else
+                {
+                    prev1 = longest_straight_at[i - 1];
+                    parent1 = i - 1;
+                }
+            }
+
+            // Parallels longest_short_cut_at[i] = 1 + max(prev_len1, prev_len2);
+            // in hand_contains_straight()
+            if (prev1 >= prev2)
+            {
+                longest_straight_at[i] = 1 + prev1;
+                parent[i] = parent1;
+            }
+            else
+            {
+                longest_straight_at[i] = 1 + prev2;
+                parent[i] = parent2;
+            }
+        }
+    }
+
+    // --- Find best straight and backtrack ---
+    int best_len = 0;
+    int end_rank = -1;
+    for (int i = 0; i < NUM_RANKS; i++)
+    {
+        if (longest_straight_at[i] >= best_len)
+        {
+            best_len = longest_straight_at[i];
+            end_rank = i;
+        }
+    }
+
+    if (best_len >= min_len)
+    {
+        u8 needed_ranks[NUM_RANKS] = {0};
+        int current_rank = end_rank;
+        while (current_rank != -1 && best_len > 0)
+        {
+            needed_ranks[current_rank]++;
+            current_rank = parent[current_rank];
+            best_len--;
+        }
+
+        for (int i = 0; i <= top; i++)
+        {
+            if (played[i] && played[i]->card && needed_ranks[played[i]->card->rank] > 0)
+            {
+                out_selection[i] = true;
+                needed_ranks[played[i]->card->rank]--;
+            }
+        }
+
+        int final_card_count = 0;
+        for (int i = 0; i <= top; i++)
+        {
+            if (out_selection[i])
+                final_card_count++;
+        }
+        return final_card_count;
+    }
+    return 0;
+}
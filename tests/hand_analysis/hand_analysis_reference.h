@@ -0,0 +1,26 @@
+#ifndef HAND_ANALYSIS_REFERENCE_H
+#define HAND_ANALYSIS_REFERENCE_H
+
+#include <hand_analysis.h>
+
+// Values returned by the game.h stubs in game_stubs.c
+extern bool stub_shortcut_active;
+extern int stub_straight_and_flush_size;
+
+enum HandType reference_hand_get_type(u8* ranks, u8* suits);
+bool reference_hand_contains_straight(u8* ranks);
+int reference_find_flush_in_played_cards(
+    CardObject** played,
+    int top,
+    int min_len,
+    bool* out_selection
+);
+int reference_find_straight_in_played_cards(
+    CardObject** played,
+    int top,
+    bool shortcut_active,
+    int min_len,
+    bool* out_selection
+);
+
+#endif
@@ -0,0 +1,175 @@
+// Checks the lookup table and rank mask based hand analysis against the implementations they
+// replaced (hand_analysis_reference.c) for every 1 to 5 card hand of a standard deck, with and
+// without Four Fingers and Shortcut.
+// Built against the tonc shim of the host build (host/include).
+#include "hand_analysis_reference.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DECK_SIZE (NUM_RANKS * NUM_SUITS)
+
+static Card cards[DECK_SIZE];
+static CardObject card_objects[DECK_SIZE];
+
+static u8 ranks[NUM_RANKS];
+static u8 suits[NUM_SUITS];
+static CardObject* played[MAX_SELECTION_SIZE];
+static int played_top = -1;
+static int hands_checked;
+static int hand_type_counts[FLUSH_FIVE + 1];
+
+static void check_current_hand()
+{
+    enum HandType expected = reference_hand_get_type(ranks, suits);
+    enum HandType actual = hand_get_type_from_distribution(ranks, suits);
+    if (actual != expected)
+    {
+        printf(
+            "Mismatch (shortcut %d, size %d): expected %d, got %d for ranks",
+            stub_shortcut_active,
+            stub_straight_and_flush_size,
+            expected,
+            actual
+        );
+        for (int i = 0; i < NUM_RANKS; i++)
+            printf(" %d", ranks[i]);
+        printf(", suits");
+        for (int i = 0; i < NUM_SUITS; i++)
+            printf(" %d", suits[i]);
+        printf("\n");
+    }
+    assert(actual == expected);
+
+    HandMasks masks;
+    hand_masks_from_cards(&masks, played, played_top);
+    for (int i = 0; i < NUM_RANKS; i++)
+        assert(((masks.ranks >> i) & 1) == (ranks[i] != 0));
+    assert(hand_contains_straight(masks.ranks) == reference_hand_contains_straight(ranks));
+    assert(hand_masks_n_of_a_kind(&masks) == hand_contains_n_of_a_kind(ranks));
+    assert(hand_masks_contains_two_pair(&masks) == hand_contains_two_pair(ranks));
+    assert(hand_masks_contains_full_house(&masks) == hand_contains_full_house(ranks));
+
+    bool selection[MAX_SELECTION_SIZE];
+    bool expected_selection[MAX_SELECTION_SIZE];
+    int min_len = stub_straight_and_flush_size;
+
+    int count = find_flush_in_played_cards(played, played_top, min_len, selection);
+    int expected_count =
+        reference_find_flush_in_played_cards(played, played_top, min_len, expected_selection);
+    assert(count == expected_count);
+    assert(memcmp(selection, expected_selection, played_top + 1) == 0);
+
+    bool shortcut = stub_shortcut_active;
+    count = find_straight_in_played_cards(played, played_top, shortcut, min_len, selection);
+    expected_count = reference_find_straight_in_played_cards(
+        played,
+        played_top,
+        shortcut,
+        min_len,
+        expected_selection
+    );
+    assert(count == expected_count);
+    assert(memcmp(selection, expected_selection, played_top + 1) == 0);
+
+    hands_checked++;
+    hand_type_counts[actual]++;
+}
+
+// Adds the cards from first_card onward to the hand in every possible combination
+static void check_hands_from(int first_card, int hand_size)
+{
+    if (hand_size > 0)
+    {
+        check_current_hand();
+    }
+
+    if (hand_size == MAX_SELECTION_SIZE)
+        return;
+
+    for (int card = first_card; card < DECK_SIZE; card++)
+    {
+        ranks[cards[card].rank]++;
+        suits[cards[card].suit]++;
+        played[++played_top] = &card_objects[card];
+        check_hands_from(card + 1, hand_size + 1);
+        played_top--;
+        ranks[cards[card].rank]--;
+        suits[cards[card].suit]--;
+    }
+}
+
+// Every rank mask with the straight sizes of hand_straight_lut, with and without Four Fingers
+void test_all_rank_masks()
+{
+    for (int shortcut = 0; shortcut <= 1; shortcut++)
+    {
+        for (int size = 4; size <= 5; size++)
+        {
+            stub_shortcut_active = shortcut;
+            stub_straight_and_flush_size = size;
+
+            for (int rank_mask = 0; rank_mask < (1 << NUM_RANKS); rank_mask++)
+            {
+                u8 mask_ranks[NUM_RANKS];
+                for (int i = 0; i < NUM_RANKS; i++)
+                    mask_ranks[i] = (rank_mask >> i) & 1;
+
+                bool straight = hand_contains_straight(rank_mask);
+                assert(straight == reference_hand_contains_straight(mask_ranks));
+            }
+        }
+    }
+}
+
+void test_all_hands(bool shortcut, int size)
+{
+    stub_shortcut_active = shortcut;
+    stub_straight_and_flush_size = size;
+    hands_checked = 0;
+    for (int i = 0; i <= FLUSH_FIVE; i++)
+        hand_type_counts[i] = 0;
+
+    check_hands_from(0, 0);
+
+    // C(52,1) + C(52,2) + C(52,3) + C(52,4) + C(52,5)
+    assert(hands_checked == 52 + 1326 + 22100 + 270725 + 2598960);
+    assert(hand_type_counts[NONE] == 0);
+}
+
+void test_known_five_card_counts()
+{
+    // Number of each 5 card poker hand, the 4 card hands can be anything but a straight or flush
+    stub_shortcut_active = false;
+    stub_straight_and_flush_size = STRAIGHT_AND_FLUSH_SIZE_DEFAULT;
+    for (int i = 0; i <= FLUSH_FIVE; i++)
+        hand_type_counts[i] = 0;
+
+    check_hands_from(0, 0);
+
+    assert(hand_type_counts[ROYAL_FLUSH] == 4);
+    assert(hand_type_counts[STRAIGHT_FLUSH] == 36);
+    assert(hand_type_counts[FULL_HOUSE] == 3744);
+    assert(hand_type_counts[FLUSH] == 5108);
+    assert(hand_type_counts[STRAIGHT] == 10200);
+}
+
+int main()
+{
+    for (int i = 0; i < DECK_SIZE; i++)
+    {
+        cards[i] = (Card){.suit = i / NUM_RANKS, .rank = i % NUM_RANKS};
+        card_objects[i] = (CardObject){.card = &cards[i]};
+    }
+
+    test_all_rank_masks();
+    test_known_five_card_counts();
+
+    test_all_hands(false, STRAIGHT_AND_FLUSH_SIZE_DEFAULT);
+    test_all_hands(false, STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS);
+    test_all_hands(true, STRAIGHT_AND_FLUSH_SIZE_DEFAULT);
+    test_all_hands(true, STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS);
+
+    printf("All hand analysis tests passed!\n");
+    return 0;
+}
@@ -2,5 +2,6 @@
 
 #define TEST_SIZE 240
 
-POOL_ENTRY(ChunkOfData, TEST_SIZE);
+POOL_ENTRY(ChunkOfData, TEST_SIZE, POOL_BITSET);
+POOL_ENTRY(FreeListChunkOfData, TEST_SIZE, POOL_FREE_LIST | POOL_HANDLES);
 
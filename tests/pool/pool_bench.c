@@ -0,0 +1,90 @@
+// Get/free throughput of the bitset and free list pool backends, with the objects freed in a
+// random order like cards and list nodes are in game.
+// Times are host nanoseconds per get + free, they only give the ratio between the backends.
+#include "pool.h"
+
+#include "test_structures.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define ROUNDS 20000
+
+// A random order to free the objects in, the same for both backends
+static int free_order[TEST_SIZE * 2];
+
+static double s_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void s_shuffle_free_order(void)
+{
+    for (int i = 0; i < TEST_SIZE; i++)
+    {
+        free_order[i] = i;
+    }
+
+    srand(1);
+    for (int i = TEST_SIZE - 1; i > 0; i--)
+    {
+        int j = rand() % (i + 1);
+        int tmp = free_order[i];
+        free_order[i] = free_order[j];
+        free_order[j] = tmp;
+    }
+
+    // Repeated so the rounds can start anywhere without wrapping around
+    for (int i = 0; i < TEST_SIZE; i++)
+    {
+        free_order[TEST_SIZE + i] = free_order[i];
+    }
+}
+
+// Fill the pool, then free and get back half of it at a time, like a hand being played and drawn
+#define BENCH_POOL(type, result_ns)                                    \
+    do                                                                 \
+    {                                                                  \
+        type* ptrs[TEST_SIZE];                                         \
+        for (int i = 0; i < TEST_SIZE; i++)                            \
+        {                                                              \
+            ptrs[i] = POOL_GET(type);                                  \
+        }                                                              \
+        double start = s_now_ns();                                     \
+        for (int round = 0; round < ROUNDS; round++)                   \
+        {                                                              \
+            const int* order = &free_order[round % TEST_SIZE];         \
+            for (int i = 0; i < TEST_SIZE / 2; i++)                    \
+            {                                                          \
+                POOL_FREE(type, ptrs[order[i]]);                       \
+            }                                                          \
+            for (int i = 0; i < TEST_SIZE / 2; i++)                    \
+            {                                                          \
+                ptrs[order[i]] = POOL_GET(type);                       \
+            }                                                          \
+        }                                                              \
+        result_ns = (s_now_ns() - start) / (ROUNDS * (TEST_SIZE / 2)); \
+        for (int i = 0; i < TEST_SIZE; i++)                            \
+        {                                                              \
+            POOL_FREE(type, ptrs[i]);                                  \
+        }                                                              \
+    } while (0)
+
+int main(void)
+{
+    s_shuffle_free_order();
+
+    double bitset_ns;
+    double free_list_ns;
+    BENCH_POOL(ChunkOfData, bitset_ns);
+    BENCH_POOL(FreeListChunkOfData, free_list_ns);
+
+    printf("%d objects, get + free:\n", TEST_SIZE);
+    printf("bitset    %6.1f ns\n", bitset_ns);
+    printf("free list %6.1f ns   x%.2f\n", free_list_ns, bitset_ns / free_list_ns);
+
+    return 0;
+}
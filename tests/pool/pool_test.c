@@ -6,6 +6,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 typedef struct timespec timestamp_t;
@@ -91,6 +92,189 @@ bool test_fill_and_remove_at_random_and_refill_and_empty(void)
     return true;
 }
 
+bool test_free_list_fill_and_empty(void)
+{
+    FreeListChunkOfData* myPtrs[TEST_SIZE];
+
+    // Twice, the second time everything comes from the free list
+    for(int round = 0; round < 2; round++)
+    {
+        for(int itr = 0; itr < TEST_SIZE; itr++)
+        {
+            myPtrs[itr] = POOL_GET(FreeListChunkOfData);
+            if(myPtrs[itr] == NULL)
+            {
+                fprintf(stderr, "Error: free list pool ran out after %d objects\n", itr);
+                return false;
+            }
+
+            for(int prev = 0; prev < itr; prev++)
+            {
+                if(myPtrs[prev] == myPtrs[itr])
+                {
+                    fprintf(stderr, "Error: free list pool handed out object %d twice\n", itr);
+                    return false;
+                }
+            }
+        }
+
+        if(POOL_GET(FreeListChunkOfData) != NULL)
+        {
+            fprintf(stderr, "Error: free list pool handed out more than its capacity\n");
+            return false;
+        }
+
+        for(int itr = 0; itr < TEST_SIZE; itr++)
+        {
+            POOL_FREE(FreeListChunkOfData, myPtrs[itr]);
+        }
+    }
+
+    return true;
+}
+
+bool test_free_list_reuse_and_invalid_frees(void)
+{
+    FreeListChunkOfData* first = POOL_GET(FreeListChunkOfData);
+    FreeListChunkOfData* second = POOL_GET(FreeListChunkOfData);
+
+    // The last freed object is handed out first
+    POOL_FREE(FreeListChunkOfData, first);
+    if(POOL_GET(FreeListChunkOfData) != first)
+    {
+        fprintf(stderr, "Error: free list pool didn't reuse the last freed object\n");
+        return false;
+    }
+
+    // Double frees and pointers from outside of the pool are ignored, otherwise the same object
+    // would be handed out twice
+    FreeListChunkOfData not_pooled;
+    POOL_FREE(FreeListChunkOfData, second);
+    POOL_FREE(FreeListChunkOfData, second);
+    POOL_FREE(FreeListChunkOfData, &not_pooled);
+
+    FreeListChunkOfData* third = POOL_GET(FreeListChunkOfData);
+    FreeListChunkOfData* fourth = POOL_GET(FreeListChunkOfData);
+    if(third != second || fourth == second || fourth == &not_pooled)
+    {
+        fprintf(stderr, "Error: free list pool was corrupted by an invalid free\n");
+        return false;
+    }
+
+    POOL_FREE(FreeListChunkOfData, first);
+    POOL_FREE(FreeListChunkOfData, third);
+    POOL_FREE(FreeListChunkOfData, fourth);
+
+    return true;
+}
+
+bool test_handles(void)
+{
+    FreeListChunkOfData* chunk = POOL_GET(FreeListChunkOfData);
+    PoolHandle handle = POOL_HANDLE(FreeListChunkOfData, chunk);
+
+    if(POOL_FROM_HANDLE(FreeListChunkOfData, handle) != chunk)
+    {
+        fprintf(stderr, "Error: handle to a live object didn't resolve\n");
+        return false;
+    }
+
+    POOL_FREE(FreeListChunkOfData, chunk);
+    if(POOL_FROM_HANDLE(FreeListChunkOfData, handle) != NULL)
+    {
+        fprintf(stderr, "Error: handle to a freed object resolved\n");
+        return false;
+    }
+
+    // The same object is reused, the old handle is still stale
+    FreeListChunkOfData* reused = POOL_GET(FreeListChunkOfData);
+    if(reused != chunk || POOL_FROM_HANDLE(FreeListChunkOfData, handle) != NULL)
+    {
+        fprintf(stderr, "Error: handle to a reused object resolved\n");
+        return false;
+    }
+
+    if(POOL_FROM_HANDLE(FreeListChunkOfData, POOL_HANDLE(FreeListChunkOfData, reused)) != reused)
+    {
+        fprintf(stderr, "Error: new handle to a reused object didn't resolve\n");
+        return false;
+    }
+
+    POOL_FREE(FreeListChunkOfData, reused);
+
+    // Without POOL_HANDLES only freed objects are detected
+    ChunkOfData* bitset_chunk = POOL_GET(ChunkOfData);
+    PoolHandle bitset_handle = POOL_HANDLE(ChunkOfData, bitset_chunk);
+    POOL_FREE(ChunkOfData, bitset_chunk);
+    if(POOL_FROM_HANDLE(ChunkOfData, bitset_handle) != NULL)
+    {
+        fprintf(stderr, "Error: handle to a freed object resolved\n");
+        return false;
+    }
+
+    return true;
+}
+
+bool test_stats(void)
+{
+    const PoolStats* stats[2];
+    if(pool_get_stats(stats, 2) != 2 || strcmp(stats[1]->name, "FreeListChunkOfData") != 0)
+    {
+        fprintf(stderr, "Error: pool stats aren't in POOLS_DEF_FILE order\n");
+        return false;
+    }
+
+    const PoolStats* free_list_stats = stats[1];
+    pool_reset_stats();
+
+    FreeListChunkOfData* myPtrs[TEST_SIZE];
+    for(int i = 0; i < TEST_SIZE; i++)
+    {
+        myPtrs[i] = POOL_GET(FreeListChunkOfData);
+    }
+
+    // One more than the capacity
+    if(POOL_GET(FreeListChunkOfData) != NULL) return false;
+
+    for(int i = 0; i < TEST_SIZE / 2; i++)
+    {
+        POOL_FREE(FreeListChunkOfData, myPtrs[i]);
+    }
+
+    // An invalid free doesn't change the count
+    POOL_FREE(FreeListChunkOfData, myPtrs[0]);
+
+    if(free_list_stats->num_in_use != TEST_SIZE / 2 ||
+       free_list_stats->high_water_mark != TEST_SIZE ||
+       free_list_stats->failed_gets != 1)
+    {
+        fprintf(stderr, "Error: wrong pool stats\n");
+        return false;
+    }
+
+    pool_reset_stats();
+    if(free_list_stats->high_water_mark != TEST_SIZE / 2 || free_list_stats->failed_gets != 0)
+    {
+        fprintf(stderr, "Error: pool stats weren't reset\n");
+        return false;
+    }
+
+    char line[64];
+    pool_stats_to_str(free_list_stats, line, sizeof(line));
+    if(strcmp(line, "FreeListChunkOfData 120/240 max 120 failed 0") != 0)
+    {
+        fprintf(stderr, "Error: wrong pool stats string \"%s\"\n", line);
+        return false;
+    }
+
+    for(int i = TEST_SIZE / 2; i < TEST_SIZE; i++)
+    {
+        POOL_FREE(FreeListChunkOfData, myPtrs[i]);
+    }
+
+    return true;
+}
+
 int main(void)
 {
     // Test it twice to make sure empty works, kinda hacky.
@@ -107,6 +291,15 @@ int main(void)
     printf("Testing Pool Fill and Empty.\n");
     if(!test_fill_and_empty()) return UNDEFINED;
 
+    printf("Testing Free List Pool Fill and Empty.\n");
+    if(!test_free_list_fill_and_empty()) return UNDEFINED;
+    printf("Testing Free List Pool Reuse and Invalid Frees.\n");
+    if(!test_free_list_reuse_and_invalid_frees()) return UNDEFINED;
+    printf("Testing Pool Handles.\n");
+    if(!test_handles()) return UNDEFINED;
+    printf("Testing Pool Stats.\n");
+    if(!test_stats()) return UNDEFINED;
+
     printf("-------------------------------------------------------------------------------\n");
     printf("Pool Tests Passed :)\n");
     printf("-------------------------------------------------------------------------------\n");
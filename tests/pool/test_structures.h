@@ -15,4 +15,7 @@ typedef struct
     int my_type;
 } ChunkOfData;
 
+// Same data in a pool with the free list backend and handles
+typedef ChunkOfData FreeListChunkOfData;
+
 #endif // POOL_TEST_STRUCTURES
@@ -0,0 +1,198 @@
+// The timers don't count on the host, the tests set the cascaded timer registers to the cycle count
+// they want the profiler to read.
+#include "profiler.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+static u32 cycles = 0;
+
+static void set_cycles(u32 new_cycles)
+{
+    cycles = new_cycles;
+    REG_TM3D = cycles >> 16;
+    REG_TM2D = cycles & 0xFFFF;
+}
+
+static void run_zone(enum ProfilerZone zone, u32 zone_cycles)
+{
+    profiler_zone_begin(zone);
+    set_cycles(cycles + zone_cycles);
+    profiler_zone_end(zone);
+}
+
+// One frame without a missed VBLANK
+static void run_frame(u32 game_update_cycles)
+{
+    profiler_vblank();
+    profiler_frame_begin();
+    run_zone(PROFILER_ZONE_MM_FRAME, 1000);
+    run_zone(PROFILER_ZONE_GAME_UPDATE, game_update_cycles);
+}
+
+// Runs frames until the window of the frames run so far, including the current one, is published
+static void finish_window(int frames_run)
+{
+    for (int i = frames_run; i < PROFILER_WINDOW; i++)
+    {
+        run_frame(0);
+    }
+    // Closes the last frame of the window
+    profiler_vblank();
+    profiler_frame_begin();
+}
+
+// Stats are only published once a full window of frames is done
+// - profiler_init
+// - profiler_zone_begin
+// - profiler_zone_end
+// - profiler_frame_begin
+// - profiler_get_stats
+void test_window_stats(void)
+{
+    profiler_init();
+    set_cycles(0);
+    const ProfilerStats* stats = profiler_get_stats();
+
+    // The first frame_begin() opens the first frame
+    profiler_vblank();
+    profiler_frame_begin();
+    run_zone(PROFILER_ZONE_MM_FRAME, 1000);
+    run_zone(PROFILER_ZONE_GAME_UPDATE, 6000);
+    for (int i = 1; i < PROFILER_WINDOW - 1; i++)
+    {
+        run_frame(6000);
+    }
+    profiler_vblank();
+    profiler_frame_begin();
+    run_zone(PROFILER_ZONE_MM_FRAME, 1000);
+    // A zone entered twice in a frame adds up
+    run_zone(PROFILER_ZONE_GAME_UPDATE, 60000);
+    run_zone(PROFILER_ZONE_GAME_UPDATE, 60000);
+
+    // The last frame isn't done yet
+    assert(stats->frames == PROFILER_WINDOW - 1);
+    assert(stats->zones[PROFILER_ZONE_GAME_UPDATE].max == 0);
+
+    profiler_vblank();
+    profiler_frame_begin();
+
+    assert(stats->frames == PROFILER_WINDOW);
+    assert(stats->zones[PROFILER_ZONE_MM_FRAME].min == 1000);
+    assert(stats->zones[PROFILER_ZONE_MM_FRAME].max == 1000);
+    assert(stats->zones[PROFILER_ZONE_GAME_UPDATE].min == 6000);
+    assert(stats->zones[PROFILER_ZONE_GAME_UPDATE].max == 120000);
+    assert(
+        stats->zones[PROFILER_ZONE_GAME_UPDATE].avg ==
+        (6000 * (PROFILER_WINDOW - 1) + 120000) / PROFILER_WINDOW
+    );
+    assert(stats->zones[PROFILER_ZONE_DRAW].max == 0);
+    assert(stats->missed_vblanks == 0);
+    assert(stats->last_drop_zone == PROFILER_ZONE_NONE);
+    // No frame waited in profiler_wait_vblank()
+    assert(stats->free_cycles == 0);
+
+    // The next window starts over, with the frame that was just started and is left empty
+    finish_window(1);
+    assert(stats->frames == 2 * PROFILER_WINDOW);
+    assert(stats->zones[PROFILER_ZONE_GAME_UPDATE].max == 0);
+    assert(stats->zones[PROFILER_ZONE_MM_FRAME].min == 0);
+    assert(stats->zones[PROFILER_ZONE_MM_FRAME].max == 1000);
+}
+
+// A frame spanning several VBLANKs is blamed on its most expensive zone
+// - profiler_vblank
+void test_missed_vblanks(void)
+{
+    profiler_init();
+    set_cycles(0);
+    const ProfilerStats* stats = profiler_get_stats();
+
+    run_frame(1000);
+    run_zone(PROFILER_ZONE_DRAW, PROFILER_FRAME_CYCLES);
+
+    // The frame took 3 VBLANKs
+    profiler_vblank();
+    profiler_vblank();
+    profiler_vblank();
+    profiler_frame_begin();
+
+    assert(stats->missed_vblanks == 2);
+    assert(stats->last_drop_zone == PROFILER_ZONE_DRAW);
+    assert(stats->zones[PROFILER_ZONE_DRAW].drops == 1);
+    assert(stats->zones[PROFILER_ZONE_GAME_UPDATE].drops == 0);
+
+    run_zone(PROFILER_ZONE_GAME_UPDATE, 2 * PROFILER_FRAME_CYCLES);
+    profiler_vblank();
+    profiler_vblank();
+    profiler_frame_begin();
+
+    assert(stats->missed_vblanks == 3);
+    assert(stats->last_drop_zone == PROFILER_ZONE_GAME_UPDATE);
+    assert(stats->zones[PROFILER_ZONE_GAME_UPDATE].drops == 1);
+
+    // Frames on time don't change the drops
+    run_frame(1000);
+    run_frame(1000);
+    assert(stats->missed_vblanks == 3);
+    assert(stats->last_drop_zone == PROFILER_ZONE_GAME_UPDATE);
+}
+
+// The high half of the timer carries into the cycle count of a zone
+void test_timer_carry(void)
+{
+    profiler_init();
+    set_cycles(0xFFF0);
+    const ProfilerStats* stats = profiler_get_stats();
+
+    profiler_vblank();
+    profiler_frame_begin();
+    run_zone(PROFILER_ZONE_AFFINE_BACKGROUND, 0x20);
+    // The 32 bit counter wraps too
+    set_cycles(0xFFFFFFF0);
+    run_zone(PROFILER_ZONE_AFFINE_BACKGROUND, 0x20);
+    finish_window(1);
+
+    assert(stats->zones[PROFILER_ZONE_AFFINE_BACKGROUND].max == 0x40);
+}
+
+// Commits finishing past the last VBLANK scanline count as missed
+// - profiler_check_commit_deadline
+void test_commit_deadline(void)
+{
+    profiler_init();
+    const ProfilerStats* stats = profiler_get_stats();
+
+    REG_VCOUNT = SCREEN_HEIGHT;
+    profiler_check_commit_deadline();
+    REG_VCOUNT = 227;
+    profiler_check_commit_deadline();
+    assert(stats->missed_commit_deadlines == 0);
+
+    REG_VCOUNT = 0;
+    profiler_check_commit_deadline();
+    REG_VCOUNT = SCREEN_HEIGHT - 1;
+    profiler_check_commit_deadline();
+    assert(stats->missed_commit_deadlines == 2);
+}
+
+int main(void)
+{
+    printf("Testing Profiler Window Stats.\n");
+    test_window_stats();
+
+    printf("Testing Profiler Missed VBlanks.\n");
+    test_missed_vblanks();
+
+    printf("Testing Profiler Timer Carry.\n");
+    test_timer_carry();
+
+    printf("Testing Profiler Commit Deadline.\n");
+    test_commit_deadline();
+
+    printf("-------------------------------------------------------------------------------\n");
+    printf("Profiler Tests Passed :)\n");
+    printf("-------------------------------------------------------------------------------\n");
+
+    return 0;
+}
@@ -19,4 +19,10 @@ run_test() {
 run_test bitset
 run_test pool
 run_test list
+run_test vector
+run_test tile_cache
+run_test affine_wave
+run_test profiler
+run_test timeline
 run_test util
+run_test hand_analysis
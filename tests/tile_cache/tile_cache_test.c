@@ -0,0 +1,148 @@
+#include "tile_cache.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define TEST_NUM_SLOTS 4
+
+TILE_CACHE_DEFINE(my_cool_cache, TEST_NUM_SLOTS)
+
+// Acquire a key and check whether it had to be uploaded
+static int acquire(int key, bool expected_upload)
+{
+    bool upload;
+    int slot = tile_cache_acquire(&my_cool_cache, key, &upload);
+    assert(slot >= 0 && slot < TEST_NUM_SLOTS);
+    assert(upload == expected_upload);
+    return slot;
+}
+
+// A new cache has every slot free
+// - TILE_CACHE_DEFINE
+// - tile_cache_get_num_free
+// - tile_cache_get_largest_free_run
+// - tile_cache_clear
+void test_create_and_clear(void)
+{
+    assert(my_cool_cache.num_slots == TEST_NUM_SLOTS);
+    assert(tile_cache_get_num_free(&my_cool_cache) == TEST_NUM_SLOTS);
+    assert(tile_cache_get_largest_free_run(&my_cool_cache) == TEST_NUM_SLOTS);
+
+    tile_cache_clear(&my_cool_cache);
+
+    assert(tile_cache_get_num_free(&my_cool_cache) == TEST_NUM_SLOTS);
+    assert(my_cool_cache.stats.hits == 0 && my_cool_cache.stats.misses == 0);
+}
+
+// The same key shares its slot and is only uploaded the first time
+// - tile_cache_acquire
+// - tile_cache_release
+void test_shared_key(void)
+{
+    int slot = acquire(7, true);
+    assert(acquire(7, false) == slot);
+    assert(tile_cache_get_num_free(&my_cool_cache) == TEST_NUM_SLOTS - 1);
+
+    // A different key gets another slot
+    assert(acquire(8, true) != slot);
+
+    // Still referenced once
+    tile_cache_release(&my_cool_cache, slot);
+    assert(my_cool_cache.slots[slot].ref_count == 1);
+    tile_cache_release(&my_cool_cache, slot);
+    assert(my_cool_cache.slots[slot].ref_count == 0);
+    // Releasing an unreferenced or out of range slot does nothing
+    tile_cache_release(&my_cool_cache, slot);
+    tile_cache_release(&my_cool_cache, -1);
+    tile_cache_release(&my_cool_cache, TEST_NUM_SLOTS);
+    assert(my_cool_cache.slots[slot].ref_count == 0);
+
+    // The tiles are still there after the last release
+    assert(acquire(7, false) == slot);
+
+    assert(my_cool_cache.stats.hits == 2);
+    assert(my_cool_cache.stats.misses == 2);
+    assert(my_cool_cache.stats.evictions == 0);
+
+    tile_cache_clear(&my_cool_cache);
+}
+
+// Unreferenced slots are reused least recently used first, referenced ones never
+void test_lru_eviction(void)
+{
+    int slots[TEST_NUM_SLOTS];
+
+    for (int key = 0; key < TEST_NUM_SLOTS; key++)
+    {
+        slots[key] = acquire(key, true);
+    }
+    assert(tile_cache_get_num_free(&my_cool_cache) == 0);
+
+    // Every slot is referenced
+    bool upload = true;
+    assert(tile_cache_acquire(&my_cool_cache, 100, &upload) == -1);
+    assert(!upload);
+    assert(my_cool_cache.stats.failures == 1);
+
+    for (int key = 0; key < TEST_NUM_SLOTS; key++)
+    {
+        tile_cache_release(&my_cool_cache, slots[key]);
+    }
+
+    // Key 0 is used again so key 1 is the least recently used now
+    tile_cache_release(&my_cool_cache, acquire(0, false));
+
+    assert(acquire(100, true) == slots[1]);
+    assert(my_cool_cache.stats.evictions == 1);
+
+    // Key 1 was evicted and has to be uploaded again, in the slot of key 2
+    assert(acquire(1, true) == slots[2]);
+    assert(acquire(0, false) == slots[0]);
+
+    tile_cache_clear(&my_cool_cache);
+}
+
+// The largest free run shows the referenced slots splitting the free ones
+void test_fragmentation(void)
+{
+    int slots[TEST_NUM_SLOTS];
+
+    for (int key = 0; key < TEST_NUM_SLOTS; key++)
+    {
+        slots[key] = acquire(key, true);
+    }
+    assert(tile_cache_get_largest_free_run(&my_cool_cache) == 0);
+
+    // Free slots 0 and 2, slot 1 is between them
+    tile_cache_release(&my_cool_cache, slots[0]);
+    tile_cache_release(&my_cool_cache, slots[2]);
+    assert(tile_cache_get_num_free(&my_cool_cache) == 2);
+    assert(tile_cache_get_largest_free_run(&my_cool_cache) == 1);
+
+    tile_cache_release(&my_cool_cache, slots[1]);
+    assert(tile_cache_get_largest_free_run(&my_cool_cache) == 3);
+
+    tile_cache_clear(&my_cool_cache);
+}
+
+int main(void)
+{
+    printf("Testing Tile Cache Create and Clear.\n");
+    test_create_and_clear();
+
+    printf("Testing Tile Cache Shared Key.\n");
+    test_shared_key();
+
+    printf("Testing Tile Cache LRU Eviction.\n");
+    test_lru_eviction();
+
+    printf("Testing Tile Cache Fragmentation.\n");
+    test_fragmentation();
+
+    printf("-------------------------------------------------------------------------------\n");
+    printf("Tile Cache Tests Passed :)\n");
+    printf("-------------------------------------------------------------------------------\n");
+
+    return 0;
+}
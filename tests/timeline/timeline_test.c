@@ -0,0 +1,281 @@
+#include "timeline.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+#define MAX_LOG 64
+
+// The frames at which the actions ran, in order
+typedef struct
+{
+    char id;
+    int run;
+    uint32_t frame;
+} LogEntry;
+
+static Timeline timeline;
+static LogEntry log_entries[MAX_LOG];
+static int log_len = 0;
+static int countdown = 0;
+
+static void log_run(char id, int run)
+{
+    assert(log_len < MAX_LOG);
+    log_entries[log_len++] = (LogEntry){id, run, timeline.frame};
+}
+
+static void assert_log(int idx, char id, int run, uint32_t frame)
+{
+    assert(idx < log_len);
+    assert(log_entries[idx].id == id);
+    assert(log_entries[idx].run == run);
+    assert(log_entries[idx].frame == frame);
+}
+
+static void run_frames(int frames)
+{
+    for (int i = 0; i < frames; i++)
+    {
+        timeline_update(&timeline);
+    }
+}
+
+static bool action_a(int run)
+{
+    log_run('a', run);
+    return false;
+}
+
+static bool action_b(int run)
+{
+    log_run('b', run);
+    return false;
+}
+
+static bool action_countdown(int run)
+{
+    log_run('c', run);
+    return --countdown == 0;
+}
+
+static const TimelineStep b_steps[] = {
+    {.delay = 2, .action = action_b},
+};
+
+static bool action_start_b(int run)
+{
+    log_run('s', run);
+    timeline_start_track(&timeline, 0, b_steps, 1);
+    return false;
+}
+
+static const TimelineStep zero_delay_steps[] = {
+    {.action = action_b},
+};
+
+static bool action_start_now_on_track_0(int run)
+{
+    log_run('s', run);
+    timeline_start_track(&timeline, 0, zero_delay_steps, 1);
+    return false;
+}
+
+// Waits, single runs and repeated runs of a sequence
+// - timeline_init
+// - timeline_start_track
+// - timeline_update
+// - timeline_is_done
+void test_sequence(void)
+{
+    static const TimelineStep steps[] = {
+        {.delay = 3, .action = action_a},
+        {.delay = 1, .interval = 2, .runs = 3, .action = action_b},
+        {.delay = 4},
+        {.action = action_a},
+    };
+
+    log_len = 0;
+    timeline_init(&timeline, 1);
+    assert(timeline_is_done(&timeline));
+    timeline_start_track(&timeline, 0, steps, 4);
+    assert(!timeline_is_done(&timeline));
+
+    run_frames(20);
+
+    assert(log_len == 5);
+    assert_log(0, 'a', 0, 3);
+    assert_log(1, 'b', 0, 4);
+    assert_log(2, 'b', 1, 6);
+    assert_log(3, 'b', 2, 8);
+    // The wait step and the step without a delay
+    assert_log(4, 'a', 0, 12);
+    assert(timeline_is_done(&timeline));
+}
+
+// Tracks play side by side, in track order on the same frame
+void test_parallel_tracks(void)
+{
+    static const TimelineStep a_steps[] = {
+        {.delay = 1, .interval = 1, .runs = 3, .action = action_a},
+    };
+    static const TimelineStep b_repeat_steps[] = {
+        {.delay = 2, .interval = 2, .runs = 2, .action = action_b},
+    };
+
+    log_len = 0;
+    timeline_init(&timeline, 1);
+    timeline_start_track(&timeline, 1, a_steps, 1);
+    timeline_start_track(&timeline, 0, b_repeat_steps, 1);
+
+    run_frames(10);
+
+    assert(log_len == 5);
+    assert_log(0, 'a', 0, 1);
+    assert_log(1, 'b', 0, 2);
+    assert_log(2, 'a', 1, 2);
+    assert_log(3, 'a', 2, 3);
+    assert_log(4, 'b', 1, 4);
+}
+
+// Steps repeated until their action returns true, which also ends fixed steps early
+void test_until_done(void)
+{
+    static const TimelineStep steps[] = {
+        {.delay = 5, .interval = 5, .runs = TIMELINE_UNTIL_DONE, .action = action_countdown},
+        {.delay = 1, .action = action_a},
+        {.delay = 10, .interval = 1, .runs = 10, .action = action_countdown},
+    };
+
+    log_len = 0;
+    countdown = 3;
+    timeline_init(&timeline, 1);
+    timeline_start_track(&timeline, 0, steps, 3);
+
+    run_frames(20);
+    assert(log_len == 4);
+    assert_log(0, 'c', 0, 5);
+    assert_log(2, 'c', 2, 15);
+    assert_log(3, 'a', 0, 16);
+
+    countdown = 2;
+    run_frames(20);
+    assert(log_len == 6);
+    assert_log(4, 'c', 0, 26);
+    assert_log(5, 'c', 1, 27);
+    assert(timeline_is_done(&timeline));
+}
+
+// Actions starting sequences, on their own track or on one that was already gone over this frame
+void test_chaining(void)
+{
+    static const TimelineStep steps[] = {
+        {.delay = 1, .action = action_start_b},
+        {.delay = 1, .action = action_a}, // Never runs, the track was given another sequence
+    };
+    static const TimelineStep start_steps[] = {
+        {.delay = 1, .action = action_start_now_on_track_0},
+    };
+
+    log_len = 0;
+    timeline_init(&timeline, 1);
+    timeline_start_track(&timeline, 0, steps, 2);
+
+    run_frames(10);
+    assert(log_len == 2);
+    assert_log(0, 's', 0, 1);
+    assert_log(1, 'b', 0, 3);
+    assert(timeline_is_done(&timeline));
+
+    // A sequence started with nothing to wait for runs on the next update
+    log_len = 0;
+    timeline_start_track(&timeline, 0, zero_delay_steps, 1);
+    run_frames(1);
+    assert(log_len == 1);
+    assert_log(0, 'b', 0, 11);
+
+    // Started from an action, it runs on the frame of the action even on a track gone over already
+    log_len = 0;
+    timeline_init(&timeline, 1);
+    timeline_start_track(&timeline, 2, start_steps, 1);
+    run_frames(1);
+    assert(log_len == 2);
+    assert_log(0, 's', 0, 1);
+    assert_log(1, 'b', 0, 1);
+    assert(timeline_is_done(&timeline));
+}
+
+// Frame counts divided by the speed, and waits rescaled when it changes
+// - timeline_set_speed
+void test_speed(void)
+{
+    static const TimelineStep steps[] = {
+        {.delay = 5, .interval = 1, .runs = 2, .action = action_a},
+        {.delay = 40, .interval = 20, .runs = 2, .action = action_b},
+    };
+
+    log_len = 0;
+    timeline_init(&timeline, 2);
+    timeline_start_track(&timeline, 0, steps, 2);
+
+    run_frames(10);
+    // 5 frames round up to 3, the interval of 1 frame doesn't go below 1
+    assert(log_len == 2);
+    assert_log(0, 'a', 0, 3);
+    assert_log(1, 'a', 1, 4);
+
+    // 40 frames at speed 2 is 20, 14 of them left at frame 10, so 28 at speed 1
+    assert(timeline.next_due == 24);
+    timeline_set_speed(&timeline, 1);
+    assert(timeline.next_due == 38);
+
+    run_frames(50);
+    assert(log_len == 4);
+    assert_log(2, 'b', 0, 38);
+    assert_log(3, 'b', 1, 58);
+}
+
+// Nothing runs before the next due frame
+void test_next_due(void)
+{
+    static const TimelineStep steps[] = {
+        {.delay = 30, .interval = 100, .runs = TIMELINE_UNTIL_DONE, .action = action_a},
+    };
+
+    log_len = 0;
+    timeline_init(&timeline, 1);
+    timeline_start_track(&timeline, 0, steps, 1);
+    assert(timeline.next_due == 30);
+
+    run_frames(29);
+    assert(log_len == 0);
+    run_frames(1);
+    assert(log_len == 1);
+    assert(timeline.next_due == 130);
+}
+
+int main(void)
+{
+    printf("Testing Timeline Sequence.\n");
+    test_sequence();
+
+    printf("Testing Timeline Parallel Tracks.\n");
+    test_parallel_tracks();
+
+    printf("Testing Timeline Until Done.\n");
+    test_until_done();
+
+    printf("Testing Timeline Chaining.\n");
+    test_chaining();
+
+    printf("Testing Timeline Speed.\n");
+    test_speed();
+
+    printf("Testing Timeline Next Due.\n");
+    test_next_due();
+
+    printf("-------------------------------------------------------------------------------\n");
+    printf("Timeline Tests Passed :)\n");
+    printf("-------------------------------------------------------------------------------\n");
+
+    return 0;
+}
@@ -0,0 +1,5 @@
+#include "list.h"
+#include <stddef.h>
+
+POOL_ENTRY(ListNode, MAX_LIST_NODES, POOL_FREE_LIST);
+
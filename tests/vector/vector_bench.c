@@ -0,0 +1,159 @@
+// Compares the Vector with the List the Jokers were kept in, for the operations done on the owned
+// Jokers with a full hand of them.
+// Times are host nanoseconds per operation, they only give the ratio between the containers.
+#include "list.h"
+#include "vector.h"
+
+#include <stdio.h>
+#include <time.h>
+
+// MAX_JOKERS_HELD_SIZE
+#define NUM_ENTRIES 5
+#define ITERATIONS  1000000
+
+VECTOR_DEFINE(vector, NUM_ENTRIES)
+static List list;
+
+static int entries[NUM_ENTRIES];
+
+// Keeps the compiler from dropping the calls
+static volatile int sink;
+
+static double s_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void s_print_result(const char* name, double list_ns, double vector_ns)
+{
+    printf(
+        "%-24s list %8.1f ns   vector %8.1f ns   x%.2f\n",
+        name,
+        list_ns / ITERATIONS,
+        vector_ns / ITERATIONS,
+        list_ns / vector_ns
+    );
+}
+
+// Like the scoring loops going through every Joker
+static void s_bench_iteration(void)
+{
+    double start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        ListItr itr = list_itr_create(&list);
+        int* data;
+        int sum = 0;
+        while ((data = list_itr_next(&itr)))
+        {
+            sum += *data;
+        }
+        sink = sum;
+    }
+    double list_ns = s_now_ns() - start;
+
+    start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        VectorItr itr = vector_itr_create(&vector);
+        int* data;
+        int sum = 0;
+        while ((data = vector_itr_next(&itr)))
+        {
+            sum += *data;
+        }
+        sink = sum;
+    }
+    double vector_ns = s_now_ns() - start;
+
+    s_print_result("iterate all", list_ns, vector_ns);
+}
+
+// Like the scoring steps looking up the Joker of each step by index
+static void s_bench_get_at_idx(void)
+{
+    double start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        sink = *(int*)list_get_at_idx(&list, i % NUM_ENTRIES);
+    }
+    double list_ns = s_now_ns() - start;
+
+    start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        sink = *(int*)vector_get_at_idx(&vector, i % NUM_ENTRIES);
+    }
+    double vector_ns = s_now_ns() - start;
+
+    s_print_result("get at idx", list_ns, vector_ns);
+}
+
+// Like the player moving a Joker around
+static void s_bench_swap(void)
+{
+    double start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        list_swap(&list, i % NUM_ENTRIES, (i + 1) % NUM_ENTRIES);
+    }
+    double list_ns = s_now_ns() - start;
+
+    start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        vector_swap(&vector, i % NUM_ENTRIES, (i + 1) % NUM_ENTRIES);
+    }
+    double vector_ns = s_now_ns() - start;
+
+    s_print_result("swap", list_ns, vector_ns);
+}
+
+// Like selling a Joker and buying another one
+static void s_bench_remove_and_push(void)
+{
+    double start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        int idx = i % NUM_ENTRIES;
+        void* data = list_get_at_idx(&list, idx);
+        list_remove_at_idx(&list, idx);
+        list_push_back(&list, data);
+    }
+    double list_ns = s_now_ns() - start;
+
+    start = s_now_ns();
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        int idx = i % NUM_ENTRIES;
+        void* data = vector_get_at_idx(&vector, idx);
+        vector_remove_at_idx(&vector, idx);
+        vector_push_back(&vector, data);
+    }
+    double vector_ns = s_now_ns() - start;
+
+    s_print_result("remove and push back", list_ns, vector_ns);
+}
+
+int main(void)
+{
+    list = list_create();
+
+    for (int i = 0; i < NUM_ENTRIES; i++)
+    {
+        entries[i] = i;
+        list_push_back(&list, &entries[i]);
+        vector_push_back(&vector, &entries[i]);
+    }
+
+    s_bench_iteration();
+    s_bench_get_at_idx();
+    s_bench_swap();
+    s_bench_remove_and_push();
+
+    list_clear(&list);
+
+    return 0;
+}
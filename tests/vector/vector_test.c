@@ -0,0 +1,278 @@
+#include "vector.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define TEST_CAPACITY 8
+
+VECTOR_DEFINE(my_cool_vector, TEST_CAPACITY)
+
+// Check the vector holds exactly the expected entries, through every way of reading it
+static void assert_entries(int* expected[], int len)
+{
+    assert(vector_get_len(&my_cool_vector) == len);
+    assert(vector_is_empty(&my_cool_vector) == (len == 0));
+
+    VectorItr itr = vector_itr_create(&my_cool_vector);
+    int* data;
+    int index = 0;
+
+    while((data = vector_itr_next(&itr)))
+    {
+        assert(data == expected[index]);
+        assert(vector_get_at_idx(&my_cool_vector, index) == expected[index]);
+        assert(itr.current_idx == index);
+        index++;
+    }
+    assert(index == len);
+
+    VectorItr rev_itr = rev_vector_itr_create(&my_cool_vector);
+    index = len - 1;
+    while((data = vector_itr_next(&rev_itr)))
+    {
+        assert(data == expected[index]);
+        index--;
+    }
+    assert(index == -1);
+
+    assert(vector_get_at_idx(&my_cool_vector, len) == NULL);
+}
+
+// As simple as it gets, just needs to be initialized correctly
+// - VECTOR_DEFINE
+// - vector_is_empty
+// - vector_get_len
+// - vector_clear
+void create_and_clear_vector(void)
+{
+    assert(my_cool_vector.cap == TEST_CAPACITY);
+    assert_entries(NULL, 0);
+
+    vector_clear(&my_cool_vector);
+
+    assert_entries(NULL, 0);
+}
+
+// Push to both ends, make sure the order is as expected
+// - vector_push_back
+// - vector_push_front
+// - vector_get_at_idx
+// - vector_itr_create
+// - rev_vector_itr_create
+// - vector_itr_next
+// - vector_clear
+void push_back_and_front(void)
+{
+    int test_data[3] = {0, 1, 2};
+
+    assert(vector_push_back(&my_cool_vector, &test_data[1]));
+    assert_entries((int*[]){&test_data[1]}, 1);
+
+    assert(vector_push_front(&my_cool_vector, &test_data[0]));
+    assert(vector_push_back(&my_cool_vector, &test_data[2]));
+    assert_entries((int*[]){&test_data[0], &test_data[1], &test_data[2]}, 3);
+
+    vector_clear(&my_cool_vector);
+    assert_entries(NULL, 0);
+}
+
+// Test inserting at head, middle, and tail of vector
+// - vector_insert
+// - vector_push_back
+void test_vector_insertion(void)
+{
+    int test_data[4] = {0, 1, 2, 3};
+    int head_val = 0xDEADBEEF;
+    int middle_val = 0x1337;
+    int tail_val = 0x10101010;
+
+    for(int i = 0; i < 4; i++)
+    {
+        assert(vector_push_back(&my_cool_vector, &test_data[i]));
+    }
+
+    assert(vector_insert(&my_cool_vector, &head_val, 0));
+    assert(vector_insert(&my_cool_vector, &middle_val, 2));
+    // large index to force it to append it to the end of the vector
+    assert(vector_insert(&my_cool_vector, &tail_val, 100));
+
+    assert_entries(
+        (int*[]){
+            &head_val,
+            &test_data[0],
+            &middle_val,
+            &test_data[1],
+            &test_data[2],
+            &test_data[3],
+            &tail_val,
+        },
+        7
+    );
+
+    vector_clear(&my_cool_vector);
+}
+
+// Test removing entries keeps the order of the others
+// - vector_remove_at_idx
+// - vector_find
+void test_vector_removal(void)
+{
+    int test_data[5] = {0, 1, 2, 3, 4};
+
+    for(int i = 0; i < 5; i++)
+    {
+        assert(vector_push_back(&my_cool_vector, &test_data[i]));
+    }
+
+    assert(vector_find(&my_cool_vector, &test_data[3]) == 3);
+
+    // remove the middle, the head and the tail entries
+    assert(vector_remove_at_idx(&my_cool_vector, 2));
+    assert(vector_remove_at_idx(&my_cool_vector, 0));
+    assert(vector_remove_at_idx(&my_cool_vector, 2));
+    // can't remove entry 2 now (doesn't exist)
+    assert(!vector_remove_at_idx(&my_cool_vector, 2));
+
+    assert_entries((int*[]){&test_data[1], &test_data[3]}, 2);
+    assert(vector_find(&my_cool_vector, &test_data[3]) == 1);
+    assert(vector_find(&my_cool_vector, &test_data[2]) == -1);
+
+    vector_clear(&my_cool_vector);
+}
+
+// Remove entries while iterating in both directions, every entry must still be visited once
+// - vector_itr_remove_current
+void test_vector_itr_removal(void)
+{
+    int test_data[5] = {0, 1, 2, 3, 4};
+
+    for(int i = 0; i < 5; i++)
+    {
+        assert(vector_push_back(&my_cool_vector, &test_data[i]));
+    }
+
+    VectorItr itr = vector_itr_create(&my_cool_vector);
+    int* data;
+    int expected = 0;
+
+    // remove the even entries
+    while((data = vector_itr_next(&itr)))
+    {
+        assert(*data == expected++);
+        if(*data % 2 == 0)
+        {
+            vector_itr_remove_current(&itr);
+        }
+    }
+    assert(expected == 5);
+    assert_entries((int*[]){&test_data[1], &test_data[3]}, 2);
+
+    // removing twice does nothing
+    itr = vector_itr_create(&my_cool_vector);
+    vector_itr_next(&itr);
+    vector_itr_remove_current(&itr);
+    vector_itr_remove_current(&itr);
+    assert_entries((int*[]){&test_data[3]}, 1);
+
+    for(int i = 0; i < 3; i++)
+    {
+        assert(vector_push_front(&my_cool_vector, &test_data[i]));
+    }
+
+    // 2 -> 1 -> 0 -> 3, remove the last two while going backwards
+    VectorItr rev_itr = rev_vector_itr_create(&my_cool_vector);
+    int visited = 0;
+    while((data = vector_itr_next(&rev_itr)))
+    {
+        if(visited++ < 2)
+        {
+            vector_itr_remove_current(&rev_itr);
+        }
+    }
+    assert(visited == 4);
+    assert_entries((int*[]){&test_data[2], &test_data[1]}, 2);
+
+    vector_clear(&my_cool_vector);
+}
+
+// Test swapping entries
+// - vector_swap
+void test_vector_swap(void)
+{
+    int test_data[5] = {0, 1, 2, 3, 4};
+
+    for(int i = 0; i < 5; i++)
+    {
+        assert(vector_push_back(&my_cool_vector, &test_data[i]));
+    }
+
+    // swap nothing, out of range
+    assert(!vector_swap(&my_cool_vector, 100, 100));
+    assert(!vector_swap(&my_cool_vector, 0, 5));
+    // swap nothing, in range
+    assert(vector_swap(&my_cool_vector, 0, 0));
+
+    assert(vector_swap(&my_cool_vector, 0, 2));
+    assert(vector_swap(&my_cool_vector, 4, 3));
+
+    assert_entries(
+        (int*[]){&test_data[2], &test_data[1], &test_data[0], &test_data[4], &test_data[3]},
+        5
+    );
+
+    vector_clear(&my_cool_vector);
+}
+
+// Fill the vector up to and over its capacity, nothing can be added to a full vector
+// - vector_is_full
+void test_vector_full(void)
+{
+    int test_data[TEST_CAPACITY + 1];
+    int* expected[TEST_CAPACITY];
+
+    for(int i = 0; i < TEST_CAPACITY; i++)
+    {
+        assert(!vector_is_full(&my_cool_vector));
+        assert(vector_push_back(&my_cool_vector, &test_data[i]));
+        expected[i] = &test_data[i];
+    }
+
+    assert(vector_is_full(&my_cool_vector));
+    assert(!vector_push_back(&my_cool_vector, &test_data[TEST_CAPACITY]));
+    assert(!vector_push_front(&my_cool_vector, &test_data[TEST_CAPACITY]));
+    assert(!vector_insert(&my_cool_vector, &test_data[TEST_CAPACITY], 1));
+    assert_entries(expected, TEST_CAPACITY);
+
+    vector_clear(&my_cool_vector);
+}
+
+int main(void)
+{
+    printf("Testing Vector Create and Clear.\n");
+    create_and_clear_vector();
+
+    printf("Testing Vector Push Back and Front.\n");
+    push_back_and_front();
+
+    printf("Testing Vector Insertion.\n");
+    test_vector_insertion();
+
+    printf("Testing Vector Removal.\n");
+    test_vector_removal();
+
+    printf("Testing Vector Iterator Removal.\n");
+    test_vector_itr_removal();
+
+    printf("Testing Vector Swap.\n");
+    test_vector_swap();
+
+    printf("Testing Vector Full.\n");
+    test_vector_full();
+
+    printf("-------------------------------------------------------------------------------\n");
+    printf("Vector Tests Passed :)\n");
+    printf("-------------------------------------------------------------------------------\n");
+
+    return 0;
+}